@@ -59,8 +59,12 @@ typedef enum
     ARNETWORK_ERROR_MANAGER_NEW_RECEIVER, /**< Receiver creation error */
     ARNETWORK_ERROR_NEW_BUFFER, /**< Buffer creation error */
     ARNETWORK_ERROR_NEW_RINGBUFFER, /**< RingBuffer creation error */
+    ARNETWORK_ERROR_MANAGER_NEW_NOTIFIER, /**< Notifier creation error */
+    ARNETWORK_ERROR_MANAGER_MEMORY_BUDGET, /**< The memory budget of the Manager would be exceeded */
+    ARNETWORK_ERROR_MANAGER_MEMORY_LOCK, /**< The memory of the Manager can not be locked in RAM */
     ARNETWORK_ERROR_IOBUFFER = -3000, /**< Unknown IOBuffer error */
     ARNETWORK_ERROR_IOBUFFER_BAD_ACK,  /**< Bad sequence number for the acknowledge */
+    ARNETWORK_ERROR_IOBUFFER_DATA_BORROWED, /**< A data of the IOBuffer is borrowed and must be released first */
     ARNETWORK_ERROR_RECEIVER = -5000, /**< Unknown Receiver error */
     ARNETWORK_ERROR_RECEIVER_BUFFER_END, /**< Receiver buffer too small */
     ARNETWORK_ERROR_RECEIVER_BAD_FRAME, /**< Bad frame content on network */
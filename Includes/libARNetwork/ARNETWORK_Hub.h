@@ -0,0 +1,130 @@
+/*
+    Copyright (C) 2014 Parrot SA
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions
+    are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in
+      the documentation and/or other materials provided with the 
+      distribution.
+    * Neither the name of Parrot nor the names
+      of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written
+      permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+    "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+    LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+    FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+    COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+    INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+    BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+    OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED 
+    AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+    OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+    OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+    SUCH DAMAGE.
+*/
+/**
+ * @file ARNETWORK_Hub.h
+ * @brief hub driving the senders and the receivers of several Managers from a shared pool of threads
+ * @date 19/10/2026
+ */
+
+#ifndef _ARNETWORK_HUB_H_
+#define _ARNETWORK_HUB_H_
+
+#include <libARNetwork/ARNETWORK_Error.h>
+#include <libARNetwork/ARNETWORK_Manager.h>
+
+/**
+ * @brief hub driving the senders and the receivers of several Managers
+ * @details The senders of the Managers are scheduled by their next due time, and processed by the threads calling ARNETWORK_Hub_SendingThreadRun().
+ * The receivers of the Managers added with a file descriptor are processed, when it becomes readable, by the threads calling ARNETWORK_Hub_ReceivingThreadRun() (Linux only).
+ * The number of threads of each kind is chosen by the application, by the number of threads it runs.
+ * @warning ARNETWORK_Manager_SendingThreadRun() must not be called for a Manager added to the hub,
+ * nor ARNETWORK_Manager_ReceivingThreadRun() for a Manager added with a file descriptor.
+ * @note The wait strategy of the senders of the Managers is not used by the hub.
+ * @see ARNETWORK_Hub_New()
+ */
+typedef struct ARNETWORK_Hub_t ARNETWORK_Hub_t;
+
+/**
+ * @brief Create a new hub
+ * @warning This function allocate memory
+ * @post ARNETWORK_Hub_Delete() must be called to delete the hub and free the memory allocated.
+ * @param[in] maxNumberOfManagers maximum number of Managers added at once to the hub
+ * @param[out] error error output ; can be NULL
+ * @return the new hub
+ * @see ARNETWORK_Hub_Delete()
+ */
+ARNETWORK_Hub_t* ARNETWORK_Hub_New (int maxNumberOfManagers, eARNETWORK_ERROR *error);
+
+/**
+ * @brief Delete the hub
+ * @warning This function free memory
+ * @details Waits the end of the wake-ups of the hub in progress, called by the Managers still added when they get new data.
+ * @warning The threads running the hub must be stopped and joined before, the Managers are not deleted.
+ * @param hubPtrAddr address of the pointer on the hub
+ * @see ARNETWORK_Hub_New()
+ */
+void ARNETWORK_Hub_Delete (ARNETWORK_Hub_t **hubPtrAddr);
+
+/**
+ * @brief Add a Manager to the hub
+ * @details The sender of the Manager is processed at once by the sending threads of the hub.
+ * @param hubPtr pointer on the hub
+ * @param managerPtr pointer on the Manager to add
+ * @param[in] receiveFd file descriptor readable when data are received by the networkAL of the Manager (the socket of reception of a wifi networkAL) ;
+ * a negative value to keep the reception in the thread calling ARNETWORK_Manager_ReceivingThreadRun()
+ * @return ARNETWORK_ERROR_BAD_PARAMETER if the Manager is already added, or if a file descriptor is given on a system without epoll ;
+ * ARNETWORK_ERROR_BUFFER_SIZE if the hub is full
+ * @see ARNETWORK_Hub_RemoveManager()
+ */
+eARNETWORK_ERROR ARNETWORK_Hub_AddManager (ARNETWORK_Hub_t *hubPtr, ARNETWORK_Manager_t *managerPtr, int receiveFd);
+
+/**
+ * @brief Remove a Manager from the hub
+ * @details Waits the end of the processing of the Manager by the threads of the hub, and the end of the wake-ups of the hub in progress for the new data of the Manager.
+ * @warning must not be called from a callback of the Manager
+ * @param hubPtr pointer on the hub
+ * @param managerPtr pointer on the Manager to remove
+ * @return ARNETWORK_ERROR_BAD_PARAMETER if the Manager is not in the hub
+ * @see ARNETWORK_Hub_AddManager()
+ */
+eARNETWORK_ERROR ARNETWORK_Hub_RemoveManager (ARNETWORK_Hub_t *hubPtr, ARNETWORK_Manager_t *managerPtr);
+
+/**
+ * @brief Manage the sending of the data of the Managers of the hub
+ * @warning This function must be called in its own thread ; several threads can call it for the same hub.
+ * @post Before join the thread calling this function, ARNETWORK_Hub_Stop() must be called.
+ * @param data thread data of type ARNETWORK_Hub_t*
+ * @return NULL
+ * @see ARNETWORK_Hub_Stop()
+ */
+void* ARNETWORK_Hub_SendingThreadRun (void *data);
+
+/**
+ * @brief Manage the reception of the data of the Managers added to the hub with a file descriptor
+ * @warning This function must be called in its own thread ; several threads can call it for the same hub.
+ * @post Before join the thread calling this function, ARNETWORK_Hub_Stop() must be called.
+ * @note On a system without epoll, this function returns at once.
+ * @param data thread data of type ARNETWORK_Hub_t*
+ * @return NULL
+ * @see ARNETWORK_Hub_Stop()
+ */
+void* ARNETWORK_Hub_ReceivingThreadRun (void *data);
+
+/**
+ * @brief stop the threads of sending and reception of the hub
+ * @details Used to kill the threads calling ARNETWORK_Hub_SendingThreadRun() and ARNETWORK_Hub_ReceivingThreadRun().
+ * @param hubPtr pointer on the hub
+ * @see ARNETWORK_Hub_SendingThreadRun()
+ * @see ARNETWORK_Hub_ReceivingThreadRun()
+ */
+void ARNETWORK_Hub_Stop (ARNETWORK_Hub_t *hubPtr);
+
+#endif /* _ARNETWORK_HUB_H_ */
@@ -57,6 +57,24 @@
  */
 #define ARNETWORK_IOBUFFERPARAM_DATACOPYMAXSIZE_USE_MAX -1
 
+/**
+ * @brief Maximum number of fragments of a fragmenting IOBuffer waiting their acknowledgement (maximum sendingBurstSize of a fragmenting IOBuffer)
+ */
+#define ARNETWORK_IOBUFFERPARAM_FRAGMENTING_WINDOW_MAX 64
+
+/**
+ * @brief Policy of an output buffer full when a new data is received, because the application reads slower than the data arrive
+ */
+typedef enum
+{
+    ARNETWORK_IOBUFFERPARAM_OVERFLOW_POLICY_DEFAULT = 0, /**< drop the oldest data if isOverwriting is set, otherwise drop the new data */
+    ARNETWORK_IOBUFFERPARAM_OVERFLOW_POLICY_DROP_NEWEST, /**< drop the new data */
+    ARNETWORK_IOBUFFERPARAM_OVERFLOW_POLICY_DROP_OLDEST, /**< drop the oldest data, not yet read, to store the new data */
+    ARNETWORK_IOBUFFERPARAM_OVERFLOW_POLICY_CONFLATE, /**< replace the most recent data, not yet read, by the new data ; the consumer always gets the latest value */
+    ARNETWORK_IOBUFFERPARAM_OVERFLOW_POLICY_BACKPRESSURE, /**< don't acknowledge the new data, so the sender sends it again later ; for the ARNETWORKAL_FRAME_TYPE_DATA_WITH_ACK buffers, otherwise the new data is dropped */
+    ARNETWORK_IOBUFFERPARAM_OVERFLOW_POLICY_MAX, /**< unused, iterator maximum value */
+} eARNETWORK_IOBUFFERPARAM_OVERFLOW_POLICY;
+
 /*****************************************
  *
  *             IOBufferParam header:
@@ -78,6 +96,17 @@ typedef struct
     int32_t dataCopyMaxSize; /**< Maximum Size, in byte, of the data copied in the buffer (the IOBuffer allocates a buffer of numberOfCell X dataCopyMaxSize ).
                                A value of ARNETWORK_IOBUFFERPARAM_DATACOPYMAXSIZE_USE_MAX automatically allocates the maximum size allowed by the underlying media. */
     int isOverwriting; /**< Indicator of overwriting possibility (1 = true | 0 = false)*/
+    int isAggregating; /**< Indicator of aggregation (1 = true | 0 = false) ; the data queued are packed in one frame, and split again by the receiver. Must be set on both the input buffer and the output buffer. An aggregate is acknowledged as a whole, and uses one sequence number (default 0) */
+    int isFragmenting; /**< Indicator of large messages (1 = true | 0 = false) ; each data is split in fragments sized for the network, reassembled by the receiver before to be stored in the output buffer.
+                            Only for the ARNETWORKAL_FRAME_TYPE_DATA_WITH_ACK buffers, not aggregating. Must be set on both the input buffer and the output buffer.
+                            The dataCopyMaxSize is then not limited by the size of a frame. Each fragment has its sequence number and acknowledgement ; up to sendingBurstSize fragments (at most ARNETWORK_IOBUFFERPARAM_FRAGMENTING_WINDOW_MAX) are sent without waiting their acknowledgement.
+                            The callback of the data is called with ARNETWORK_MANAGER_CALLBACK_STATUS_ACK_RECEIVED once all its fragments are acknowledged (default 0) */
+    eARNETWORK_IOBUFFERPARAM_OVERFLOW_POLICY overflowPolicy; /**< Policy of an output buffer full when a new data is received (default ARNETWORK_IOBUFFERPARAM_OVERFLOW_POLICY_DEFAULT) ; not used by the input buffers */
+    int isCreditFlowControlled; /**< Indicator of credit-based flow control (1 = true | 0 = false) ; the output buffer advertises its free cells to the peer, on its acknowledgements and on the ping frames, and the input buffer sends no more data than the credits advertised by the peer.
+                                     Must be set on both the input buffer and the output buffer ; not available for the fragmenting buffers. Until the first advertisement the credits are not limited (default 0) */
+    int sendingWaitTimeUs; /**< Time in microsecond between 2 send when the IOBuffer is used with a ARNetwork_Sender ; replaces sendingWaitTimeMs if greater than 0, 0 or -1 if not used (default 0) */
+    int ackTimeoutUs; /**< Timeout in microsecond before retry to send the data waiting an acknowledgement ; replaces ackTimeoutMs if greater than 0, 0 or -1 if not used (default 0) */
+    int sendingBurstSize; /**< Maximum number of data sent in one pass of the ARNetwork_Sender, while the network buffer is not full ; 0 is taken as 1 (default 1). Not used for the ARNETWORKAL_FRAME_TYPE_DATA_WITH_ACK buffers, which wait each acknowledgement */
 
 }ARNETWORK_IOBufferParam_t;
 
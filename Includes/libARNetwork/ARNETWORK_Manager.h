@@ -41,6 +41,7 @@
 #include <libARNetwork/ARNETWORK_Error.h>
 #include <libARNetwork/ARNETWORK_IOBufferParam.h>
 #include <libARNetworkAL/ARNETWORKAL_Manager.h>
+#include <sys/uio.h>
 
 /**
  * @brief status return by the callback.
@@ -67,6 +68,104 @@ typedef enum
     ARNETWORK_MANAGER_CALLBACK_STATUS_DONE, /**< the use of the data is done, the date will not more used */
 } eARNETWORK_MANAGER_CALLBACK_STATUS;
 
+/**
+ * @brief congestion control algorithm used by the sender.
+ */
+typedef enum
+{
+    ARNETWORK_MANAGER_CONGESTION_CONTROL_NONE = 0, /**< no congestion control, the buffers are sent as fast as their parameters allow (default) */
+    ARNETWORK_MANAGER_CONGESTION_CONTROL_AIMD, /**< additive increase / multiplicative decrease, driven by the acknowledgements and the retries */
+    ARNETWORK_MANAGER_CONGESTION_CONTROL_DELAY, /**< delay based (LEDBAT like), driven by the queuing delay measured on the ping and acknowledgement round trip times */
+    ARNETWORK_MANAGER_CONGESTION_CONTROL_MAX, /**< Max of the enum, do not use */
+} eARNETWORK_MANAGER_CONGESTION_CONTROL;
+
+/**
+ * @brief state of the congestion control.
+ */
+typedef enum
+{
+    ARNETWORK_MANAGER_CONGESTION_STATE_DISABLED = 0, /**< congestion control disabled */
+    ARNETWORK_MANAGER_CONGESTION_STATE_SLOW_START, /**< no congestion seen yet, the window grows exponentially */
+    ARNETWORK_MANAGER_CONGESTION_STATE_AVOIDANCE, /**< the window grows linearly */
+    ARNETWORK_MANAGER_CONGESTION_STATE_RECOVERY, /**< the window has just been reduced after a loss or a delay increase */
+} eARNETWORK_MANAGER_CONGESTION_STATE;
+
+/**
+ * @brief status of the congestion control of a manager.
+ * @see ARNETWORK_Manager_GetCongestionControlStatus()
+ */
+typedef struct
+{
+    eARNETWORK_MANAGER_CONGESTION_CONTROL algorithm; /**< congestion control algorithm in use */
+    eARNETWORK_MANAGER_CONGESTION_STATE state; /**< current state of the congestion control */
+    int congestionWindow; /**< number of throttled data allowed to be sent per round trip time */
+    int smoothedRttMs; /**< smoothed round trip time in millisecond (negative if not yet measured) */
+    int minRttMs; /**< minimum round trip time seen in millisecond (negative if not yet measured) */
+    uint32_t numberOfLossEvents; /**< number of window reductions due to retries */
+    uint32_t numberOfDelayEvents; /**< number of window reductions due to the queuing delay */
+    uint32_t numberOfThrottledSends; /**< number of times a data has been delayed by the congestion window */
+} ARNETWORK_Manager_CongestionControlStatus_t;
+
+/**
+ * @brief quality of the link seen by an output buffer, over sliding windows.
+ * @note the losses are the gaps of the sequence numbers: the losses recovered by the retries of the ARNETWORKAL_FRAME_TYPE_DATA_WITH_ACK buffers are not seen, except as duplicates when the acknowledgement is lost.
+ * @see ARNETWORK_Manager_GetLinkQuality()
+ */
+typedef struct
+{
+    float lossPercentage1s; /**< percentage of the frames lost during the last second [0-100] ; negative if no frame was expected */
+    float lossPercentage10s; /**< percentage of the frames lost during the last 10 seconds [0-100] ; negative if no frame was expected */
+    float lossPercentage60s; /**< percentage of the frames lost during the last minute [0-100] ; negative if no frame was expected */
+    float meanLossBurstLength; /**< mean number of consecutive frames lost during the last minute ; 0 without loss */
+    int jitterUs; /**< interarrival jitter in microsecond, smoothed as in RFC 3550 */
+    uint32_t numberOfDuplicates; /**< number of frames received twice since the creation of the buffer */
+    uint32_t numberOfLate; /**< number of frames received after a more recent frame since the creation of the buffer */
+} ARNETWORK_Manager_LinkQuality_t;
+
+/**
+ * @brief wait strategy of the sender thread, between two sends.
+ * @see ARNETWORK_Manager_SetSenderWaitStrategy()
+ */
+typedef enum
+{
+    ARNETWORK_MANAGER_SENDER_WAIT_STRATEGY_BLOCK = 0, /**< the sender blocks on a condition, and the producers signal it for each new data (default) */
+    ARNETWORK_MANAGER_SENDER_WAIT_STRATEGY_SPIN_THEN_BLOCK, /**< the sender yields the CPU in a loop for an adaptive time before blocking ; the producers do not signal a spinning sender */
+    ARNETWORK_MANAGER_SENDER_WAIT_STRATEGY_MAX, /**< Max of the enum, do not use */
+} eARNETWORK_MANAGER_SENDER_WAIT_STRATEGY;
+
+/**
+ * @brief record of a data read by the ARNETWORK_Manager_ReadDataBatch() functions
+ */
+typedef struct
+{
+    int offset; /**< offset of the data in the arena given to the read */
+    int size; /**< size of the data */
+} ARNETWORK_Manager_DataRecord_t;
+
+/**
+ * @brief kind of a buffer of the Manager
+ * @see ARNETWORK_Manager_BufferFootprint_t
+ */
+typedef enum
+{
+    ARNETWORK_MANAGER_BUFFER_KIND_INPUT = 0, /**< input buffer of the application */
+    ARNETWORK_MANAGER_BUFFER_KIND_OUTPUT, /**< output buffer of the application */
+    ARNETWORK_MANAGER_BUFFER_KIND_ACK, /**< buffer of acknowledgement created for an output buffer */
+    ARNETWORK_MANAGER_BUFFER_KIND_INTERNAL, /**< internal buffer of the Manager (ping, pong, coalesced acknowledgments) */
+    ARNETWORK_MANAGER_BUFFER_KIND_MAX, /**< Max of the enum, do not use */
+} eARNETWORK_MANAGER_BUFFER_KIND;
+
+/**
+ * @brief memory allocated by a buffer of the Manager
+ * @see ARNETWORK_Manager_GetMemoryFootprint()
+ */
+typedef struct
+{
+    int ID; /**< identifier of the buffer */
+    eARNETWORK_MANAGER_BUFFER_KIND kind; /**< kind of the buffer */
+    int size; /**< size in byte of the memory allocated by the buffer: its cells of data descriptors and of data copies, and its fragmentation state */
+} ARNETWORK_Manager_BufferFootprint_t;
+
 /**
  * @brief callback use when the data are sent or have a timeout
  * @warning the callback can't call the ARNETWORK's functions
@@ -79,6 +178,58 @@ typedef enum
  */
 typedef eARNETWORK_MANAGER_CALLBACK_RETURN (*ARNETWORK_Manager_Callback_t) (int IoBufferId, uint8_t *dataPtr, void *customData, eARNETWORK_MANAGER_CALLBACK_STATUS status);
 
+/**
+ * @brief callback use when a data is received in an output buffer
+ * @warning the callback is called by the receiving thread, with the output buffer locked: it can't call the ARNETWORK's functions on this output buffer, and should return quickly
+ * @param[in] IoBufferId identifier of the output IoBuffer is calling back
+ * @param[in] dataPtr pointer on the data, in the frame received ; only valid during the call
+ * @param[in] dataSize size of the data
+ * @param[in] customData custom data given to ARNETWORK_Manager_SetOutputCallback()
+ * @see ARNETWORK_Manager_SetOutputCallback()
+ */
+typedef void (*ARNETWORK_Manager_OutputCallback_t) (int IoBufferId, uint8_t *dataPtr, int dataSize, void *customData);
+
+/**
+ * @brief callback use when the application lags behind the data received in an output buffer
+ * @details called once when the number of data waiting to be read reaches the lag threshold, and again after it went below the threshold
+ * @warning the callback is called by the receiving thread, with the output buffer locked: it can't call the ARNETWORK's functions on this output buffer, and should return quickly
+ * @param[in] IoBufferId identifier of the output IoBuffer is calling back
+ * @param[in] numberOfData number of data waiting to be read
+ * @param[in] numberOfCells maximum number of data stored by the output buffer
+ * @param[in] customData custom data given to ARNETWORK_Manager_SetConsumerLagCallback()
+ * @see ARNETWORK_Manager_SetConsumerLagCallback()
+ */
+typedef void (*ARNETWORK_Manager_ConsumerLagCallback_t) (int IoBufferId, int numberOfData, int numberOfCells, void *customData);
+
+/**
+ * @brief status of the reading of an output buffer by the application
+ * @see ARNETWORK_Manager_GetConsumerStatus()
+ * @see eARNETWORK_IOBUFFERPARAM_OVERFLOW_POLICY
+ */
+typedef struct
+{
+    int numberOfData; /**< number of data waiting to be read */
+    int numberOfCells; /**< maximum number of data stored by the output buffer */
+    uint32_t numberOfDroppedNewest; /**< number of data received dropped because the output buffer was full */
+    uint32_t numberOfDroppedOldest; /**< number of data not read dropped to store a new data */
+    uint32_t numberOfConflated; /**< number of data not read replaced by a new data */
+    uint32_t numberOfAcksWithheld; /**< number of data not acknowledged because the output buffer was full ; the sender sends them again */
+} ARNETWORK_Manager_ConsumerStatus_t;
+
+/**
+ * @brief completion of a data sent, reported through the completion queue instead of a call of its callback
+ * @see ARNETWORK_Manager_EnableCompletionQueue()
+ * @see ARNETWORK_Manager_DrainCompletions()
+ */
+typedef struct
+{
+    int ID; /**< identifier of the input buffer of the data */
+    uint8_t *dataPtr; /**< pointer on the data sent without copy ; NULL for a data copied in the Manager, whose copy can be already reused, and for the ARNETWORK_MANAGER_CALLBACK_STATUS_DONE status */
+    void *customData; /**< custom data given with the data */
+    ARNETWORK_Manager_Callback_t callback; /**< callback given with the data ; the application can call it with the fields of the completion */
+    eARNETWORK_MANAGER_CALLBACK_STATUS status; /**< status of the data */
+} ARNETWORK_Manager_Completion_t;
+
 /**
  * @brief network manager allow to send and receive data acknowledged or not.
  */
@@ -112,6 +263,70 @@ typedef void (*ARNETWORK_Manager_OnDisconnect_t) (ARNETWORK_Manager_t *manager,
  */
 ARNETWORK_Manager_t* ARNETWORK_Manager_New(ARNETWORKAL_Manager_t *networkALManager, unsigned int numberOfInput, ARNETWORK_IOBufferParam_t *inputParamArr, unsigned int numberOfOutput, ARNETWORK_IOBufferParam_t *outputParamArr, int pingDelayMs, ARNETWORK_Manager_OnDisconnect_t onDisconnectCallback, void* customData, eARNETWORK_ERROR *error);
 
+/**
+ * @brief Create a new Manager with a memory budget
+ * @details Same as ARNETWORK_Manager_New(), but the memory allocated by the Manager, as reported by ARNETWORK_Manager_GetMemoryFootprint(),
+ * can not exceed memoryBudget: the creation fails if the buffers requested do not fit in it, and later ARNETWORK_Manager_AddInputBuffer(),
+ * ARNETWORK_Manager_AddOutputBuffer() and the first ARNETWORK_Manager_SetTrace() fail if they would exceed it.
+ * The footprint of the creation and of the buffers added is computed from their parameters: nothing is allocated when they do not fit.
+ * @warning This function allocate memory
+ * @post ARNETWORK_Manager_Delete() must be called to delete the Network and free the memory allocated.
+ * @param[in] networkALManager An initialized @ref ARNETWORKAL_Manager_t instance which will be used for all network operations
+ * @param[in] numberOfInput Number of input buffer
+ * @param[in] inputParamArr array of the parameters of creation of the inputs. The array must contain as many parameters as the number of input buffer.
+ * @param[in] numberOfOutput Number of output buffer
+ * @param[in] outputParamArr array of the parameters of creation of the outputs. The array must contain as many parameters as the number of output buffer.
+ * @param[in] pingDelayMs Minimum amount of time (ms) between two pings. Put a negative value to disable ping, and zero to use default value
+ * @param[in] onDisconnectCallback fuction called on disconnect.
+ * @param[in] customData custom Data sent to the callbacks.
+ * @param[in] memoryBudget Maximum memory, in byte, the Manager can allocate ; 0 to not limit it
+ * @param[out] error error output ; ARNETWORK_ERROR_MANAGER_MEMORY_BUDGET if the Manager does not fit in memoryBudget
+ * @return the new Manager ; NULL if an error occurred
+ * @note The memory of the networkALManager and of the data sent without copy is not counted.
+ * @see ARNETWORK_Manager_New()
+ * @see ARNETWORK_Manager_GetMemoryFootprint()
+ */
+ARNETWORK_Manager_t* ARNETWORK_Manager_NewWithMemoryBudget(ARNETWORKAL_Manager_t *networkALManager, unsigned int numberOfInput, ARNETWORK_IOBufferParam_t *inputParamArr, unsigned int numberOfOutput, ARNETWORK_IOBufferParam_t *outputParamArr, int pingDelayMs, ARNETWORK_Manager_OnDisconnect_t onDisconnectCallback, void* customData, int memoryBudget, eARNETWORK_ERROR *error);
+
+/**
+ * @brief Get the size of the arena in which a Manager is created by ARNETWORK_Manager_NewWithArena()
+ * @param[in] networkALManager An initialized @ref ARNETWORKAL_Manager_t instance which will be used for all network operations
+ * @param[in] numberOfInput Number of input buffer
+ * @param[in] inputParamArr array of the parameters of creation of the inputs. The array must contain as many parameters as the number of input buffer.
+ * @param[in] numberOfOutput Number of output buffer
+ * @param[in] outputParamArr array of the parameters of creation of the outputs. The array must contain as many parameters as the number of output buffer.
+ * @return size in byte of the arena ; a negative value is an error (@ref eARNETWORK_ERROR)
+ * @see ARNETWORK_Manager_NewWithArena()
+ */
+int ARNETWORK_Manager_GetArenaSize(ARNETWORKAL_Manager_t *networkALManager, unsigned int numberOfInput, ARNETWORK_IOBufferParam_t *inputParamArr, unsigned int numberOfOutput, ARNETWORK_IOBufferParam_t *outputParamArr);
+
+/**
+ * @brief Create a new Manager in one contiguous arena
+ * @details Same as ARNETWORK_Manager_New(), but the Manager, its tables and all its buffers (structures, ring buffers and their cells)
+ * are carved from one arena, each allocation aligned on a cache line, instead of allocated one by one.
+ * The sender, the receiver, the notifier and the trace keep their own allocations.
+ * The buffers added later by ARNETWORK_Manager_AddInputBuffer() or ARNETWORK_Manager_AddOutputBuffer() are allocated out of the arena,
+ * and the memory of the buffers removed is only freed by the deletion of the Manager.
+ * @warning This function allocate memory
+ * @post ARNETWORK_Manager_Delete() must be called to delete the Network and free the memory allocated.
+ * @param[in] networkALManager An initialized @ref ARNETWORKAL_Manager_t instance which will be used for all network operations
+ * @param[in] numberOfInput Number of input buffer
+ * @param[in] inputParamArr array of the parameters of creation of the inputs. The array must contain as many parameters as the number of input buffer.
+ * @param[in] numberOfOutput Number of output buffer
+ * @param[in] outputParamArr array of the parameters of creation of the outputs. The array must contain as many parameters as the number of output buffer.
+ * @param[in] pingDelayMs Minimum amount of time (ms) between two pings. Put a negative value to disable ping, and zero to use default value
+ * @param[in] onDisconnectCallback fuction called on disconnect.
+ * @param[in] customData custom Data sent to the callbacks.
+ * @param[in] arenaPtr memory of the arena, kept by the caller until the deletion of the Manager ; NULL to allocate it
+ * @param[in] arenaSize size of the memory of arenaPtr, at least ARNETWORK_Manager_GetArenaSize() ; ignored if arenaPtr is NULL
+ * @param[in] isArenaLocked 1 to lock the arena in RAM with mlock() ; otherwise 0
+ * @param[out] error error output ; ARNETWORK_ERROR_BUFFER_SIZE if arenaSize is too small, ARNETWORK_ERROR_MANAGER_MEMORY_LOCK if the arena can not be locked
+ * @return the new Manager ; NULL if an error occurred
+ * @see ARNETWORK_Manager_GetArenaSize()
+ * @see ARNETWORK_Manager_New()
+ */
+ARNETWORK_Manager_t* ARNETWORK_Manager_NewWithArena(ARNETWORKAL_Manager_t *networkALManager, unsigned int numberOfInput, ARNETWORK_IOBufferParam_t *inputParamArr, unsigned int numberOfOutput, ARNETWORK_IOBufferParam_t *outputParamArr, int pingDelayMs, ARNETWORK_Manager_OnDisconnect_t onDisconnectCallback, void* customData, void *arenaPtr, int arenaSize, int isArenaLocked, eARNETWORK_ERROR *error);
+
 /**
  * @brief Delete the Manager
  * @warning This function free memory
@@ -156,6 +371,86 @@ void ARNETWORK_Manager_Stop(ARNETWORK_Manager_t *managerPtr);
  */
 eARNETWORK_ERROR ARNETWORK_Manager_Flush(ARNETWORK_Manager_t *managerPtr);
 
+/**
+ * @brief Reset the Manager in place, to reuse it for a new connection without deleting and creating it again
+ * @details All buffers are flushed, their data being cancelled ; their sequence numbers, acknowledgements, timers, credits and statistics are reset,
+ * as well as the ping, the delayed acknowledgements and the congestion control. The memory, the buffers and the settings of the Manager are kept.
+ * The reset is done at once for the threads of the Manager, which can run during it.
+ * The readers waiting for data keep waiting, and the data borrowed by ARNETWORK_Manager_ReadDataBorrow() is kept until it is released.
+ * After ARNETWORK_Manager_Stop() and the join of the threads, the Manager is ready to run again: the threads can be started again after the reset.
+ * @warning must not be called from a callback of the Manager, nor between ARNETWORK_Manager_Stop() and the join of the threads
+ * @param managerPtr pointer on the Manager
+ * @return error eARNETWORK_ERROR
+ * @see ARNETWORK_Manager_Flush()
+ */
+eARNETWORK_ERROR ARNETWORK_Manager_Reset(ARNETWORK_Manager_t *managerPtr);
+
+/**
+ * @brief Add an input buffer to the Manager
+ * @details The buffer can be added while the threads of the Manager run ; they take it at their next processing.
+ * @warning This function allocate memory
+ * @warning must not be called from a callback of the Manager
+ * @param managerPtr pointer on the Manager
+ * @param[in] inputParamPtr parameters of creation of the input buffer ; its identifier must not be used by another input buffer
+ * @return error eARNETWORK_ERROR ; ARNETWORK_ERROR_MANAGER_MEMORY_BUDGET if the buffer does not fit in the memory budget of the Manager
+ * @see ARNETWORK_Manager_RemoveInputBuffer()
+ */
+eARNETWORK_ERROR ARNETWORK_Manager_AddInputBuffer(ARNETWORK_Manager_t *managerPtr, ARNETWORK_IOBufferParam_t *inputParamPtr);
+
+/**
+ * @brief Add an output buffer, and its buffer of acknowledgement, to the Manager
+ * @details The buffer can be added while the threads of the Manager run ; they take it at their next processing.
+ * The data received for the buffer before its addition are dropped.
+ * @warning This function allocate memory
+ * @warning must not be called from a callback of the Manager
+ * @param managerPtr pointer on the Manager
+ * @param[in] outputParamPtr parameters of creation of the output buffer ; its identifier must not be used by another output buffer
+ * @return error eARNETWORK_ERROR ; ARNETWORK_ERROR_MANAGER_MEMORY_BUDGET if the buffers do not fit in the memory budget of the Manager
+ * @see ARNETWORK_Manager_RemoveOutputBuffer()
+ */
+eARNETWORK_ERROR ARNETWORK_Manager_AddOutputBuffer(ARNETWORK_Manager_t *managerPtr, ARNETWORK_IOBufferParam_t *outputParamPtr);
+
+/**
+ * @brief Remove an input buffer from the Manager
+ * @details The buffer can be removed while the threads of the Manager run ; its data not sent are dropped without call of their callback.
+ * The calls of the application using the buffer, such as ARNETWORK_Manager_SendDataWithTimeout() waiting a free cell, return ARNETWORK_ERROR_ID_UNKNOWN ; the buffer is freed by the last of them.
+ * @warning This function free memory
+ * @warning must not be called from a callback of the Manager
+ * @param managerPtr pointer on the Manager
+ * @param[in] inputBufferID identifier of the input buffer to remove
+ * @return error eARNETWORK_ERROR
+ * @see ARNETWORK_Manager_AddInputBuffer()
+ */
+eARNETWORK_ERROR ARNETWORK_Manager_RemoveInputBuffer(ARNETWORK_Manager_t *managerPtr, int inputBufferID);
+
+/**
+ * @brief Remove an output buffer, and its buffer of acknowledgement, from the Manager
+ * @details The buffer can be removed while the threads of the Manager run ; its data not read are dropped.
+ * The calls of the application using the buffer, such as ARNETWORK_Manager_ReadData() or ARNETWORK_Manager_ReadAny() waiting a data, return ARNETWORK_ERROR_ID_UNKNOWN ; the buffer is freed by the last of them.
+ * @warning This function free memory
+ * @warning must not be called from a callback of the Manager
+ * @param managerPtr pointer on the Manager
+ * @param[in] outputBufferID identifier of the output buffer to remove
+ * @return error eARNETWORK_ERROR ; ARNETWORK_ERROR_IOBUFFER_DATA_BORROWED if a data of the buffer is borrowed, it must be released before the removal
+ * @see ARNETWORK_Manager_AddOutputBuffer()
+ */
+eARNETWORK_ERROR ARNETWORK_Manager_RemoveOutputBuffer(ARNETWORK_Manager_t *managerPtr, int outputBufferID);
+
+/**
+ * @brief Get the memory allocated by the Manager, with a breakdown by buffer
+ * @details The buffers of acknowledgement and the internal buffers, created by the Manager, are reported with the buffers of the application.
+ * The total also counts the Manager itself, its tables of buffers, the sender, the receiver, the notifier and the trace.
+ * @param managerPtr pointer on the Manager
+ * @param[out] footprintArr array to store the memory allocated by each buffer ; can be NULL if maxNumberOfFootprints is 0
+ * @param[in] maxNumberOfFootprints size of footprintArr
+ * @param[out] numberOfFootprintsPtr pointer to store the number of buffers of the Manager ; can be NULL
+ * @param[out] totalSizePtr pointer to store the total memory, in byte, allocated by the Manager ; can be NULL
+ * @return error eARNETWORK_ERROR ; ARNETWORK_ERROR_BUFFER_SIZE if footprintArr is too small, then only its maxNumberOfFootprints first entries are stored,
+ * but numberOfFootprintsPtr and totalSizePtr are set
+ * @see ARNETWORK_Manager_NewWithMemoryBudget()
+ */
+eARNETWORK_ERROR ARNETWORK_Manager_GetMemoryFootprint(ARNETWORK_Manager_t *managerPtr, ARNETWORK_Manager_BufferFootprint_t *footprintArr, int maxNumberOfFootprints, int *numberOfFootprintsPtr, int *totalSizePtr);
+
 /**
  * @brief Add data to send in a IOBuffer
  * @param managerPtr pointer on the Manager
@@ -169,6 +464,40 @@ eARNETWORK_ERROR ARNETWORK_Manager_Flush(ARNETWORK_Manager_t *managerPtr);
  */
 eARNETWORK_ERROR ARNETWORK_Manager_SendData(ARNETWORK_Manager_t *managerPtr, int inputBufferID, uint8_t *dataPtr, int dataSize, void *customData, ARNETWORK_Manager_Callback_t callback, int doDataCopy);
 
+/**
+ * @brief Add, with timeout, data to send in a IOBuffer
+ * @details If the input buffer is full, the calling thread waits, without spinning, for the sender to free a cell or for the timeout.
+ * Each data freed (sent, acknowledged or cancelled) wakes one waiting thread.
+ * @param managerPtr pointer on the Manager
+ * @param[in] inputBufferID identifier of the input buffer in which the data must be stored
+ * @param[in] dataPtr pointer on the data to send
+ * @param[in] dataSize size of the data to send
+ * @param[in] customData custom data sent to the callback
+ * @param[in] callback pointer on the callback to call when the data is sent or an error occurred
+ * @param[in] doDataCopy indicator to copy the data in the ARNETWORK_Manager
+ * @param[in] timeoutMs maximum time, in millisecond, to wait a free cell ; 0 to not wait, as ARNETWORK_Manager_SendData()
+ * @return error eARNETWORK_ERROR ; ARNETWORK_ERROR_BUFFER_SIZE if the input buffer is still full at the timeout
+ * @see ARNETWORK_Manager_SendData()
+ */
+eARNETWORK_ERROR ARNETWORK_Manager_SendDataWithTimeout(ARNETWORK_Manager_t *managerPtr, int inputBufferID, uint8_t *dataPtr, int dataSize, void *customData, ARNETWORK_Manager_Callback_t callback, int doDataCopy, int timeoutMs);
+
+/**
+ * @brief Add data, gathered from several pieces, to send in a IOBuffer
+ * @details The pieces (a header, a command identifier and a payload for example) are concatenated in order.
+ * With doDataCopy, they are gathered directly in the storage of the IOBuffer, without intermediate buffer ; the pieces and the array can be reused at the return.
+ * Without doDataCopy, the data must be in one piece, kept until the callback is called, as with ARNETWORK_Manager_SendData().
+ * @param managerPtr pointer on the Manager
+ * @param[in] inputBufferID identifier of the input buffer in which the data must be stored
+ * @param[in] iov array of the pieces of the data to send ; their iov_base must not be NULL
+ * @param[in] iovcnt number of pieces, at least 1
+ * @param[in] customData custom data sent to the callback
+ * @param[in] callback pointer on the callback to call when the data is sent or an error occurred
+ * @param[in] doDataCopy indicator to copy the data in the ARNETWORK_Manager ; must be 1 if iovcnt is more than 1
+ * @return error eARNETWORK_ERROR
+ * @see ARNETWORK_Manager_SendData()
+ */
+eARNETWORK_ERROR ARNETWORK_Manager_SendDataV(ARNETWORK_Manager_t *managerPtr, int inputBufferID, const struct iovec *iov, int iovcnt, void *customData, ARNETWORK_Manager_Callback_t callback, int doDataCopy);
+
 /**
  * @brief Read data received in a IOBuffer using variable size data (blocking function)
  * @warning This is a blocking function.
@@ -177,7 +506,7 @@ eARNETWORK_ERROR ARNETWORK_Manager_SendData(ARNETWORK_Manager_t *managerPtr, int
  * @param[in] outputBufferID identifier of the output buffer in which the data must be read
  * @param[out] dataPtr pointer on the data read
  * @param[in] dataLimitSize limit size of the copy
- * @param[out] readSizePtr pointer to store the size of the data read
+ * @param[out] readSizePtr pointer to store the size of the data read ; size needed to read the data if ARNETWORK_ERROR_BUFFER_SIZE is returned
  * @return error eARNETWORK_ERROR type
  */
 eARNETWORK_ERROR ARNETWORK_Manager_ReadData(ARNETWORK_Manager_t *managerPtr, int outputBufferID, uint8_t *dataPtr, int dataLimitSize, int *readSizePtr);
@@ -188,7 +517,7 @@ eARNETWORK_ERROR ARNETWORK_Manager_ReadData(ARNETWORK_Manager_t *managerPtr, int
  * @param[in] outputBufferID identifier of the output buffer in which the data must be read
  * @param[out] dataPtr pointer on the data read
  * @param[in] dataLimitSize limit size of the copy
- * @param[out] readSizePtr pointer to store the size of the data read
+ * @param[out] readSizePtr pointer to store the size of the data read ; size needed to read the data if ARNETWORK_ERROR_BUFFER_SIZE is returned
  * @return error eARNETWORK_ERROR type
  */
 eARNETWORK_ERROR ARNETWORK_Manager_TryReadData(ARNETWORK_Manager_t *managerPtr, int outputBufferID, uint8_t *dataPtr, int dataLimitSize, int *readSizePtr);
@@ -199,12 +528,162 @@ eARNETWORK_ERROR ARNETWORK_Manager_TryReadData(ARNETWORK_Manager_t *managerPtr,
  * @param[in] outputBufferID identifier of the output buffer in which the data must be read
  * @param[out] dataPtr pointer on the data read
  * @param[in] dataLimitSize limit size of the copy
- * @param[out] readSizePtr pointer to store the size of the data read
+ * @param[out] readSizePtr pointer to store the size of the data read ; size needed to read the data if ARNETWORK_ERROR_BUFFER_SIZE is returned
  * @param[in] timeoutMs maximum time in millisecond to wait if there is no data to read
  * @return error eARNETWORK_ERROR type
  */
 eARNETWORK_ERROR ARNETWORK_Manager_ReadDataWithTimeout(ARNETWORK_Manager_t *managerPtr, int outputBufferID, uint8_t *dataPtr, int dataLimitSize, int *readSizePtr, int timeoutMs);
 
+/**
+ * @brief Read many data received in a IOBuffer in one call (blocking function)
+ * @details Waits for one data, then reads, under one lock of the IOBuffer, all the data available up to maxNumberOfRecords.
+ * The data are copied one after the other in the arena ; the reading stops when the next data doesn't fit in the arena.
+ * @warning This is a blocking function.
+ * @warning Applications which need to close the manager should NOT use this function
+ * @param managerPtr pointer on the Manager
+ * @param[in] outputBufferID identifier of the output buffer in which the data must be read
+ * @param[out] arenaPtr pointer on the arena in which the data are copied
+ * @param[in] arenaSize size of the arena
+ * @param[out] recordArr array of records to store the offset and the size of each data read
+ * @param[in] maxNumberOfRecords size of recordArr ; maximum number of data read
+ * @param[out] numberOfRecordsPtr pointer to store the number of data read
+ * @return error eARNETWORK_ERROR type ; if the first data doesn't fit in the arena, ARNETWORK_ERROR_BUFFER_SIZE is returned and the size needed is stored in the first record
+ */
+eARNETWORK_ERROR ARNETWORK_Manager_ReadDataBatch(ARNETWORK_Manager_t *managerPtr, int outputBufferID, uint8_t *arenaPtr, int arenaSize, ARNETWORK_Manager_DataRecord_t *recordArr, int maxNumberOfRecords, int *numberOfRecordsPtr);
+
+/**
+ * @brief try to read many data received in a IOBuffer in one call (non-blocking function)
+ * @param managerPtr pointer on the Manager
+ * @param[in] outputBufferID identifier of the output buffer in which the data must be read
+ * @param[out] arenaPtr pointer on the arena in which the data are copied
+ * @param[in] arenaSize size of the arena
+ * @param[out] recordArr array of records to store the offset and the size of each data read
+ * @param[in] maxNumberOfRecords size of recordArr ; maximum number of data read
+ * @param[out] numberOfRecordsPtr pointer to store the number of data read
+ * @return error eARNETWORK_ERROR type
+ * @see ARNETWORK_Manager_ReadDataBatch()
+ */
+eARNETWORK_ERROR ARNETWORK_Manager_TryReadDataBatch(ARNETWORK_Manager_t *managerPtr, int outputBufferID, uint8_t *arenaPtr, int arenaSize, ARNETWORK_Manager_DataRecord_t *recordArr, int maxNumberOfRecords, int *numberOfRecordsPtr);
+
+/**
+ * @brief Read, with timeout, many data received in a IOBuffer in one call
+ * @param managerPtr pointer on the Manager
+ * @param[in] outputBufferID identifier of the output buffer in which the data must be read
+ * @param[out] arenaPtr pointer on the arena in which the data are copied
+ * @param[in] arenaSize size of the arena
+ * @param[out] recordArr array of records to store the offset and the size of each data read
+ * @param[in] maxNumberOfRecords size of recordArr ; maximum number of data read
+ * @param[out] numberOfRecordsPtr pointer to store the number of data read
+ * @param[in] timeoutMs maximum time in millisecond to wait if there is no data to read
+ * @return error eARNETWORK_ERROR type
+ * @see ARNETWORK_Manager_ReadDataBatch()
+ */
+eARNETWORK_ERROR ARNETWORK_Manager_ReadDataBatchWithTimeout(ARNETWORK_Manager_t *managerPtr, int outputBufferID, uint8_t *arenaPtr, int arenaSize, ARNETWORK_Manager_DataRecord_t *recordArr, int maxNumberOfRecords, int *numberOfRecordsPtr, int timeoutMs);
+
+/**
+ * @brief Get the file descriptor readable when output buffers of the Manager are ready to be read
+ * @details The file descriptor can be polled (poll, select, epoll ...) to serve many output buffers, of many Managers, from one thread.
+ * It becomes readable when an output buffer goes from empty to not empty ; it is cleared by ARNETWORK_Manager_GetReadyBuffers().
+ * As this notification is edge-triggered, the ready buffers should be read until they are empty
+ * (ARNETWORK_ERROR_BUFFER_EMPTY returned by ARNETWORK_Manager_TryReadData()) before to poll again.
+ * @warning The file descriptor belongs to the Manager: it must not be read, written or closed by the application.
+ * It is closed by ARNETWORK_Manager_Delete().
+ * @param managerPtr pointer on the Manager
+ * @return the file descriptor, or ARNETWORK_ERROR_BAD_PARAMETER if managerPtr is NULL
+ * @see ARNETWORK_Manager_GetReadyBuffers()
+ */
+int ARNETWORK_Manager_GetReadyFd(ARNETWORK_Manager_t *managerPtr);
+
+/**
+ * @brief Clear the file descriptor returned by ARNETWORK_Manager_GetReadyFd() and get the output buffers ready to be read
+ * @param managerPtr pointer on the Manager
+ * @param[out] outputBufferIDArr array to store the identifiers of the output buffers having data to read
+ * @param[in] maxNumberOfIDs size of outputBufferIDArr
+ * @param[out] numberOfIDsPtr pointer to store the number of identifiers stored
+ * @return error eARNETWORK_ERROR type
+ * @see ARNETWORK_Manager_GetReadyFd()
+ */
+eARNETWORK_ERROR ARNETWORK_Manager_GetReadyBuffers(ARNETWORK_Manager_t *managerPtr, int *outputBufferIDArr, int maxNumberOfIDs, int *numberOfIDsPtr);
+
+/**
+ * @brief Read, with timeout, a data received in any of several IOBuffers
+ * @details The calling thread waits, on a notification shared by the output buffers of the Manager, until one of the listed buffers has a data to read.
+ * One thread can so read several output buffers. The buffers are checked in the order of the array: the first ones have priority.
+ * @note It can be used with ARNETWORK_Manager_ReadData() by other threads on the same buffers ; the data is then read by only one of them.
+ * @param managerPtr pointer on the Manager
+ * @param[in] outputBufferIDArr identifiers of the output buffers in which a data can be read
+ * @param[in] numberOfIDs number of identifiers of outputBufferIDArr
+ * @param[out] dataPtr pointer on the data read
+ * @param[in] dataLimitSize limit size of the copy
+ * @param[out] readSizePtr pointer to store the size of the data read ; size needed to read the data if ARNETWORK_ERROR_BUFFER_SIZE is returned
+ * @param[out] outputBufferIDPtr pointer to store the identifier of the output buffer read, or of the buffer of the error ; -1 on timeout
+ * @param[in] timeoutMs maximum time in millisecond to wait if there is no data to read ; 0 to not wait
+ * @return error eARNETWORK_ERROR type ; ARNETWORK_ERROR_BUFFER_EMPTY if no data is received before the timeout
+ * @see ARNETWORK_Manager_ReadDataWithTimeout()
+ */
+eARNETWORK_ERROR ARNETWORK_Manager_ReadAny(ARNETWORK_Manager_t *managerPtr, const int *outputBufferIDArr, int numberOfIDs, uint8_t *dataPtr, int dataLimitSize, int *readSizePtr, int *outputBufferIDPtr, int timeoutMs);
+
+/**
+ * @brief Borrow, with timeout, a data received in IOBuffer, without copy
+ * @details The data is given in the storage of the output buffer, where it can be parsed in place.
+ * It must be released by ARNETWORK_Manager_ReleaseData() ; only one data can be borrowed at a time in an output buffer,
+ * and the other data of the buffer can't be read until it is released.
+ * While the data is borrowed, the new data received in a full overwriting buffer are dropped instead of overwriting it.
+ * @param managerPtr pointer on the ARNETWORK_Manager_t
+ * @param[in] outputBufferID identifier of the output buffer in which the data must be borrowed
+ * @param[out] dataPtrPtr pointer to store the address of the data borrowed
+ * @param[out] dataSizePtr pointer to store the size of the data borrowed
+ * @param[in] timeoutMs maximum time in millisecond to wait if there is no data to read ; negative to wait without timeout
+ * @return error eARNETWORK_ERROR type ; ARNETWORK_ERROR_IOBUFFER_DATA_BORROWED if a data is already borrowed in the buffer
+ * @see ARNETWORK_Manager_ReleaseData()
+ */
+eARNETWORK_ERROR ARNETWORK_Manager_ReadDataBorrow(ARNETWORK_Manager_t *managerPtr, int outputBufferID, uint8_t **dataPtrPtr, int *dataSizePtr, int timeoutMs);
+
+/**
+ * @brief Release the data borrowed by ARNETWORK_Manager_ReadDataBorrow()
+ * @warning The address of the data borrowed must not be used after the release
+ * @param managerPtr pointer on the ARNETWORK_Manager_t
+ * @param[in] outputBufferID identifier of the output buffer in which the data is borrowed
+ * @return error eARNETWORK_ERROR type ; ARNETWORK_ERROR_BAD_PARAMETER if no data is borrowed in the buffer
+ */
+eARNETWORK_ERROR ARNETWORK_Manager_ReleaseData(ARNETWORK_Manager_t *managerPtr, int outputBufferID);
+
+/**
+ * @brief Sets the callback receiving the data of an output buffer, without copy
+ * @details While a callback is set, the data received in the output buffer are given to the callback by the receiving thread,
+ * instead of being copied in the output buffer: they can't be read by the ARNETWORK_Manager_ReadData() functions.
+ * The data already stored in the output buffer can still be read.
+ * @param managerPtr address of the Manager
+ * @param[in] outputBufferID identifier of the output buffer
+ * @param[in] callback callback receiving the data ; NULL to store the data in the output buffer again
+ * @param[in] customData custom data given to the callback
+ * @return error eARNETWORK_ERROR
+ * @see ARNETWORK_Manager_OutputCallback_t
+ */
+eARNETWORK_ERROR ARNETWORK_Manager_SetOutputCallback(ARNETWORK_Manager_t *managerPtr, int outputBufferID, ARNETWORK_Manager_OutputCallback_t callback, void *customData);
+
+/**
+ * @brief Sets the callback reporting the lag of the application reading an output buffer
+ * @param managerPtr address of the Manager
+ * @param[in] outputBufferID identifier of the output buffer
+ * @param[in] lagThreshold number of data waiting to be read from which the lag is reported ; between 1 and the numberOfCell of the output buffer
+ * @param[in] callback callback reporting the lag ; NULL to stop the reports
+ * @param[in] customData custom data given to the callback
+ * @return error eARNETWORK_ERROR
+ * @see ARNETWORK_Manager_ConsumerLagCallback_t
+ */
+eARNETWORK_ERROR ARNETWORK_Manager_SetConsumerLagCallback(ARNETWORK_Manager_t *managerPtr, int outputBufferID, int lagThreshold, ARNETWORK_Manager_ConsumerLagCallback_t callback, void *customData);
+
+/**
+ * @brief Gets the status of the reading of an output buffer by the application: the data waiting and the counters of its overflow policy
+ * @param managerPtr address of the Manager
+ * @param[in] outputBufferID identifier of the output buffer
+ * @param[out] status pointer on the status to fill
+ * @return error eARNETWORK_ERROR
+ * @see eARNETWORK_IOBUFFERPARAM_OVERFLOW_POLICY
+ */
+eARNETWORK_ERROR ARNETWORK_Manager_GetConsumerStatus(ARNETWORK_Manager_t *managerPtr, int outputBufferID, ARNETWORK_Manager_ConsumerStatus_t *status);
+
 /**
  * @brief Flush an input buffer
  * @param managerPtr Pointer to the ARNETWORK_Manager_t
@@ -215,6 +694,7 @@ eARNETWORK_ERROR ARNETWORK_Manager_FlushInputBuffer(ARNETWORK_Manager_t *manager
 
 /**
  * @brief Flush an output buffer
+ * @details The data borrowed by ARNETWORK_Manager_ReadDataBorrow() is kept until it is released by ARNETWORK_Manager_ReleaseData().
  * @param managerPtr Pointer to the ARNETWORK_Manager_t
  * @param[in] outBufferID Identifier of the buffer to flush
  * @return error eARNETWORK_ERROR type
@@ -240,6 +720,16 @@ int ARNETWORK_Manager_GetEstimatedLatency (ARNETWORK_Manager_t *managerPtr);
  */
 int ARNETWORK_Manager_GetEstimatedMissPercentage (ARNETWORK_Manager_t *managerPtr, int outBufferID);
 
+/**
+ * @brief Gets the quality of the link seen by an output buffer over the last 1, 10 and 60 seconds
+ * @note Unlike ARNETWORK_Manager_GetEstimatedMissPercentage(), computed since the creation of the buffer, the losses are counted over sliding windows
+ * @param managerPtr Pointer to the ARNETWORK_Manager_t
+ * @param outBufferID Identifier of the buffer
+ * @param[out] linkQuality Pointer on the link quality to fill
+ * @return error eARNETWORK_ERROR type
+ */
+eARNETWORK_ERROR ARNETWORK_Manager_GetLinkQuality (ARNETWORK_Manager_t *managerPtr, int outBufferID, ARNETWORK_Manager_LinkQuality_t *linkQuality);
+
 /**
  * @brief Sets the minimum time between two network sends for the given ARNETWORK_Manager_t
  * Default value is 1ms
@@ -251,4 +741,168 @@ int ARNETWORK_Manager_GetEstimatedMissPercentage (ARNETWORK_Manager_t *managerPt
  */
 eARNETWORK_ERROR ARNETWORK_Manager_SetMinimumTimeBetweenSends (ARNETWORK_Manager_t *managerPtr, int minimumTimeMs);
 
+/**
+ * @brief Sets the minimum time between two network sends for the given ARNETWORK_Manager_t, in microsecond
+ * Default value is 1000us. A lower value allows the buffers with a sendingWaitTimeUs under one millisecond to be sent at their rate
+ * @warning The @ref ARNETWORKAL_FRAME_TYPE_DATA_LOW_LATENCY buffers are not affected by this setting
+ * @warning Setting a bad minimum time can result in erratic behavior of the library
+ * @param managerPtr Pointer to the ARNETWORK_Manager_t
+ * @param minimumTimeUs Minimum time, in microseconds, between two network sends
+ * @return error eARNETWORK_ERROR type
+ * @see ARNETWORK_Manager_SetMinimumTimeBetweenSends()
+ */
+eARNETWORK_ERROR ARNETWORK_Manager_SetMinimumTimeBetweenSendsUs (ARNETWORK_Manager_t *managerPtr, int minimumTimeUs);
+
+/**
+ * @brief Sets the congestion control algorithm used by the sender of the given ARNETWORK_Manager_t
+ * Default value is ARNETWORK_MANAGER_CONGESTION_CONTROL_NONE
+ * @note The congestion control throttles the ARNETWORKAL_FRAME_TYPE_DATA and ARNETWORKAL_FRAME_TYPE_DATA_WITH_ACK buffers.
+ * The @ref ARNETWORKAL_FRAME_TYPE_DATA_LOW_LATENCY buffers, the acknowledgements and the pings are never throttled.
+ * @note The congestion control is fed by the ping round trip time, the acknowledgement round trip time and the retries.
+ * Without ping and without buffer of data with ack, the congestion control has no measure and does not throttle anything.
+ * @param managerPtr Pointer to the ARNETWORK_Manager_t
+ * @param algorithm Congestion control algorithm to use
+ * @return error eARNETWORK_ERROR type
+ */
+eARNETWORK_ERROR ARNETWORK_Manager_SetCongestionControl (ARNETWORK_Manager_t *managerPtr, eARNETWORK_MANAGER_CONGESTION_CONTROL algorithm);
+
+/**
+ * @brief Gets the status of the congestion control of the given ARNETWORK_Manager_t
+ * @param managerPtr Pointer to the ARNETWORK_Manager_t
+ * @param[out] status Pointer to store the congestion control status
+ * @return error eARNETWORK_ERROR type
+ */
+eARNETWORK_ERROR ARNETWORK_Manager_GetCongestionControlStatus (ARNETWORK_Manager_t *managerPtr, ARNETWORK_Manager_CongestionControlStatus_t *status);
+
+/**
+ * @brief Enables or disables the direct send of the @ref ARNETWORKAL_FRAME_TYPE_DATA_LOW_LATENCY data
+ * Default value is 0 (disabled)
+ * @note When enabled, ARNETWORK_Manager_SendData() on a low latency buffer pushes and sends the frame from the calling thread, if the sending thread is not sending at the same time.
+ * Otherwise the data is queued and the sending thread is signaled, as when disabled. The calling thread can then be blocked by the network send,
+ * and the callback of the data can be called with the ARNETWORK_MANAGER_CALLBACK_STATUS_SENT status by the calling thread.
+ * The data sent by the calling thread are not paced by the sendingWaitTimeMs of their buffer, which applies only to the data sent by the sending thread.
+ * @param managerPtr Pointer to the ARNETWORK_Manager_t
+ * @param isDirectSend 1 to enable the direct send, 0 to disable it
+ * @return error eARNETWORK_ERROR type
+ */
+eARNETWORK_ERROR ARNETWORK_Manager_SetLowLatencyDirectSend (ARNETWORK_Manager_t *managerPtr, int isDirectSend);
+
+/**
+ * @brief Sets the wait strategy of the sender of the given ARNETWORK_Manager_t
+ * Default value is ARNETWORK_MANAGER_SENDER_WAIT_STRATEGY_BLOCK
+ * @note With ARNETWORK_MANAGER_SENDER_WAIT_STRATEGY_SPIN_THEN_BLOCK, a new data is seen by the sender without a wake up of its thread,
+ * at the cost of CPU time while it spins. The spin time adapts itself: it grows when data arrive during the spin and shrinks when they do not,
+ * between maxSpinTimeUs / 16 and maxSpinTimeUs.
+ * @param managerPtr Pointer to the ARNETWORK_Manager_t
+ * @param strategy Wait strategy to use
+ * @param maxSpinTimeUs Maximum time, in microseconds, spent spinning before blocking. Not used with ARNETWORK_MANAGER_SENDER_WAIT_STRATEGY_BLOCK
+ * @return error eARNETWORK_ERROR type
+ */
+eARNETWORK_ERROR ARNETWORK_Manager_SetSenderWaitStrategy (ARNETWORK_Manager_t *managerPtr, eARNETWORK_MANAGER_SENDER_WAIT_STRATEGY strategy, int maxSpinTimeUs);
+
+/**
+ * @brief Enables or disables the binary trace of the given ARNETWORK_Manager_t
+ * @details When enabled, the enqueues, sends, retries, acknowledgements, receptions, pushes and drops of data are recorded,
+ * without formatting, in one ring of entries by role of thread (application, sender, receiver).
+ * The recording is lock-free and costs a clock reading and a few stores by event ; the oldest entries are overwritten.
+ * The trace is written by ARNETWORK_Manager_DumpTrace() and decoded offline.
+ * @param managerPtr pointer on the Manager
+ * @param[in] numberOfEntries number of entries of each ring, rounded up to a power of 2 ; only used at the first enabling,
+ * the rings are then kept until the deletion of the Manager ; 0 to disable the recording
+ * @return error eARNETWORK_ERROR ; ARNETWORK_ERROR_MANAGER_MEMORY_BUDGET if the rings do not fit in the memory budget of the Manager
+ * @see ARNETWORK_Manager_DumpTrace()
+ */
+eARNETWORK_ERROR ARNETWORK_Manager_SetTrace (ARNETWORK_Manager_t *managerPtr, int numberOfEntries);
+
+/**
+ * @brief Writes the binary trace of the given ARNETWORK_Manager_t in a file descriptor
+ * @details The format is described in ARNETWORK_Trace.h ; the trace should be disabled before the dump,
+ * otherwise the entries recorded during the dump may be inconsistent.
+ * @param managerPtr pointer on the Manager
+ * @param[in] fd file descriptor in which the trace is written (file, pipe, socket ...)
+ * @return error eARNETWORK_ERROR
+ * @see ARNETWORK_TraceFileHeader_t
+ */
+eARNETWORK_ERROR ARNETWORK_Manager_DumpTrace (ARNETWORK_Manager_t *managerPtr, int fd);
+
+/**
+ * @brief Sets the delayed acknowledgment policy of the given ARNETWORK_Manager_t
+ * @details When enabled, the acknowledgments of the data received are not sent one by one in the buffers of acknowledgement:
+ * they are packed, for all the output buffers, in one frame sent when maxNumberOfAcks acknowledgments are pending
+ * or when the oldest pending acknowledgment has been delayed for maxDelayUs, whichever comes first.
+ * The output buffers set by ARNETWORK_Manager_SetImmediateAck() send at once their acknowledgment, with the pending ones.
+ * Default is disabled (each acknowledgment is sent alone and immediately).
+ * @warning The remote Manager must understand the coalesced acknowledgments, i.e. be built from a version of the library with this function.
+ * @note A buffer with acknowledgment sends its next data only after the acknowledgment of the previous one:
+ * the delay is added to its round trip time, and should stay small compared to its ackTimeoutMs.
+ * @param managerPtr Pointer to the ARNETWORK_Manager_t
+ * @param maxNumberOfAcks Number of pending acknowledgments triggering the sending ; 0 to disable the delayed acknowledgments
+ * @param maxDelayUs Maximum time, in microseconds, an acknowledgment can be delayed
+ * @return error eARNETWORK_ERROR type
+ * @see ARNETWORK_Manager_SetImmediateAck()
+ */
+eARNETWORK_ERROR ARNETWORK_Manager_SetDelayedAck (ARNETWORK_Manager_t *managerPtr, int maxNumberOfAcks, int maxDelayUs);
+
+/**
+ * @brief Sets an output buffer as latency-critical for its acknowledgments
+ * @details The acknowledgments of the data received by this output buffer are sent immediately, even if the acknowledgments are delayed.
+ * @param managerPtr Pointer to the ARNETWORK_Manager_t
+ * @param[in] outputBufferID Identifier of the output buffer, of type ARNETWORKAL_FRAME_TYPE_DATA_WITH_ACK
+ * @param[in] isImmediate 1 to acknowledge immediately the data of the buffer, 0 to follow the delayed acknowledgment policy
+ * @return error eARNETWORK_ERROR type
+ * @see ARNETWORK_Manager_SetDelayedAck()
+ */
+eARNETWORK_ERROR ARNETWORK_Manager_SetImmediateAck (ARNETWORK_Manager_t *managerPtr, int outputBufferID, int isImmediate);
+
+/**
+ * @brief Enable the completion queue of the data sent
+ * @details The completions of the data of the input buffers (sent, acknowledged, cancelled, timeout, freed, done) are stored in a lock-free queue
+ * instead of calling their callback from the threads of the Manager ; the application drains them in batches, from its own thread,
+ * through ARNETWORK_Manager_DrainCompletions(). The file descriptor returned by ARNETWORK_Manager_GetCompletionFd() can be polled to wait for them.
+ * The decision on a timeout is taken by the policy of the input buffer, set by ARNETWORK_Manager_SetTimeoutPolicy() ; the return of the callback is not used.
+ * If the queue is full, the callback is called by the thread of the completion, as without queue, so that no completion is lost.
+ * The completion queue can't be disabled.
+ * @warning A data sent without copy must be kept until its completion with the ARNETWORK_MANAGER_CALLBACK_STATUS_FREE status is drained.
+ * @param managerPtr Pointer to the ARNETWORK_Manager_t
+ * @param[in] numberOfCompletions Number of completions the queue can store, rounded up to a power of two ; at most 65536
+ * @return error eARNETWORK_ERROR type ; ARNETWORK_ERROR_BAD_PARAMETER if the queue is already enabled
+ * @see ARNETWORK_Manager_DrainCompletions()
+ */
+eARNETWORK_ERROR ARNETWORK_Manager_EnableCompletionQueue (ARNETWORK_Manager_t *managerPtr, int numberOfCompletions);
+
+/**
+ * @brief Get a file descriptor to poll, readable when completions are waiting to be drained
+ * @details It becomes readable when a completion is stored in the empty queue ; it is cleared by ARNETWORK_Manager_DrainCompletions(),
+ * and becomes readable again if completions are left in the queue.
+ * @warning The file descriptor belongs to the Manager: it must not be read, written or closed by the application.
+ * It is closed by ARNETWORK_Manager_Delete().
+ * @param managerPtr Pointer to the ARNETWORK_Manager_t
+ * @return the file descriptor, or ARNETWORK_ERROR_BAD_PARAMETER if managerPtr is NULL or the completion queue is not enabled
+ * @see ARNETWORK_Manager_EnableCompletionQueue()
+ */
+int ARNETWORK_Manager_GetCompletionFd (ARNETWORK_Manager_t *managerPtr);
+
+/**
+ * @brief Drain the completions of the data sent, in their order
+ * @warning must not be called by several threads at once
+ * @param managerPtr Pointer to the ARNETWORK_Manager_t
+ * @param[out] completionArr array to store the completions
+ * @param[in] maxNumberOfCompletions size of completionArr
+ * @param[out] numberOfCompletionsPtr pointer to store the number of completions drained
+ * @return error eARNETWORK_ERROR type ; ARNETWORK_ERROR_BUFFER_EMPTY if no completion was waiting
+ * @see ARNETWORK_Manager_EnableCompletionQueue()
+ */
+eARNETWORK_ERROR ARNETWORK_Manager_DrainCompletions (ARNETWORK_Manager_t *managerPtr, ARNETWORK_Manager_Completion_t *completionArr, int maxNumberOfCompletions, int *numberOfCompletionsPtr);
+
+/**
+ * @brief Sets the decision taken on a timeout of an input buffer whose completions are queued
+ * @details Default is ARNETWORK_MANAGER_CALLBACK_RETURN_DATA_POP. It is not used without completion queue, the return of the callback is used.
+ * @param managerPtr Pointer to the ARNETWORK_Manager_t
+ * @param[in] inputBufferID Identifier of the input buffer
+ * @param[in] policy ARNETWORK_MANAGER_CALLBACK_RETURN_DATA_POP, ARNETWORK_MANAGER_CALLBACK_RETURN_RETRY or ARNETWORK_MANAGER_CALLBACK_RETURN_FLUSH
+ * @return error eARNETWORK_ERROR type
+ * @see ARNETWORK_Manager_EnableCompletionQueue()
+ */
+eARNETWORK_ERROR ARNETWORK_Manager_SetTimeoutPolicy (ARNETWORK_Manager_t *managerPtr, int inputBufferID, eARNETWORK_MANAGER_CALLBACK_RETURN policy);
+
 #endif /* _ARNETWORK_MANAGER_H_ */
@@ -0,0 +1,139 @@
+/*
+    Copyright (C) 2014 Parrot SA
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions
+    are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in
+      the documentation and/or other materials provided with the 
+      distribution.
+    * Neither the name of Parrot nor the names
+      of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written
+      permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+    "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+    LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+    FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+    COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+    INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+    BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+    OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED 
+    AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+    OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+    OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+    SUCH DAMAGE.
+*/
+/**
+ * @file ARNETWORK_Trace.h
+ * @brief binary format of the trace of the sending and the receiving paths
+ * @date 19/10/2026
+ */
+
+#ifndef _ARNETWORK_TRACE_H_
+#define _ARNETWORK_TRACE_H_
+
+#include <inttypes.h>
+
+/*****************************************
+ *
+ *             define :
+ *
+ *****************************************/
+
+/**
+ * @brief Magic number at the start of a trace dump ("ARNT")
+ */
+#define ARNETWORK_TRACE_FILE_MAGIC (0x544E5241)
+
+/**
+ * @brief Version of the format of a trace dump
+ */
+#define ARNETWORK_TRACE_FILE_VERSION (1)
+
+/*****************************************
+ *
+ *             type :
+ *
+ *****************************************/
+
+/**
+ * @brief role of the thread recording the trace entries ; each role has its own ring of entries
+ */
+typedef enum
+{
+    ARNETWORK_TRACE_ROLE_APPLICATION = 0, /**< threads of the application calling the ARNETWORK_Manager functions */
+    ARNETWORK_TRACE_ROLE_SENDER, /**< sending thread, or application thread sending a data directly */
+    ARNETWORK_TRACE_ROLE_RECEIVER, /**< receiving thread */
+    ARNETWORK_TRACE_ROLE_MAX, /**< Max of the enum, do not use */
+} eARNETWORK_TRACE_ROLE;
+
+/**
+ * @brief event recorded in the trace
+ */
+typedef enum
+{
+    ARNETWORK_TRACE_EVENT_ENQUEUE = 0, /**< data added in an input buffer ; size: size of the data */
+    ARNETWORK_TRACE_EVENT_SEND, /**< frame sent ; seq: sequence number, size: size of the frame data, info: number of data in the frame */
+    ARNETWORK_TRACE_EVENT_RETRY, /**< frame sent again after an acknowledgement timeout ; seq: sequence number, size: size of the frame data, info: number of retries remaining before the timeout (-1 if infinite) */
+    ARNETWORK_TRACE_EVENT_ACK, /**< acknowledgement received for an input buffer ; seq: sequence number acknowledged, info: eARNETWORK_ERROR */
+    ARNETWORK_TRACE_EVENT_RECEIVE, /**< frame received ; seq: sequence number, size: size of the frame, info: eARNETWORKAL_FRAME_TYPE */
+    ARNETWORK_TRACE_EVENT_PUSH, /**< data pushed in an output buffer ; seq: sequence number of the frame, size: size of the data */
+    ARNETWORK_TRACE_EVENT_DROP, /**< data dropped ; seq: sequence number if known, size: size of the data if known, info: eARNETWORK_TRACE_DROP_REASON */
+    ARNETWORK_TRACE_EVENT_MAX, /**< Max of the enum, do not use */
+} eARNETWORK_TRACE_EVENT;
+
+/**
+ * @brief reason of a ARNETWORK_TRACE_EVENT_DROP event
+ */
+typedef enum
+{
+    ARNETWORK_TRACE_DROP_REASON_INPUT_FULL = 0, /**< the input buffer is full */
+    ARNETWORK_TRACE_DROP_REASON_OUTPUT_FULL, /**< the output buffer is full */
+    ARNETWORK_TRACE_DROP_REASON_OLD_FRAME, /**< the frame received is older than the last one, or a duplicate */
+    ARNETWORK_TRACE_DROP_REASON_ACK_TIMEOUT, /**< no acknowledgement received after all the retries */
+    ARNETWORK_TRACE_DROP_REASON_MAX, /**< Max of the enum, do not use */
+} eARNETWORK_TRACE_DROP_REASON;
+
+/**
+ * @brief entry of the trace (16 bytes)
+ */
+typedef struct
+{
+    uint32_t timeUs; /**< time of the event, in microsecond of the monotonic clock, modulo 2^32 */
+    uint8_t event; /**< eARNETWORK_TRACE_EVENT */
+    uint8_t bufferID; /**< identifier of the buffer concerned */
+    uint8_t seq; /**< sequence number, see eARNETWORK_TRACE_EVENT */
+    uint8_t role; /**< eARNETWORK_TRACE_ROLE of the thread recording the entry */
+    int32_t size; /**< size, see eARNETWORK_TRACE_EVENT */
+    int32_t info; /**< information depending on the event, see eARNETWORK_TRACE_EVENT */
+} ARNETWORK_TraceEntry_t;
+
+/**
+ * @brief header of a trace dump, in the byte order of the host
+ * @details The header is followed, for each role, by an ARNETWORK_TraceRingHeader_t and the entries of the ring, from the oldest to the newest.
+ */
+typedef struct
+{
+    uint32_t magic; /**< ARNETWORK_TRACE_FILE_MAGIC */
+    uint16_t version; /**< ARNETWORK_TRACE_FILE_VERSION */
+    uint16_t entrySize; /**< size of an ARNETWORK_TraceEntry_t */
+    uint32_t numberOfRings; /**< number of rings dumped */
+    uint32_t dumpTimeUs; /**< time of the dump, in microsecond of the monotonic clock, modulo 2^32 */
+} ARNETWORK_TraceFileHeader_t;
+
+/**
+ * @brief header of the entries of a ring in a trace dump
+ */
+typedef struct
+{
+    uint32_t role; /**< eARNETWORK_TRACE_ROLE of the ring */
+    uint32_t numberOfEntries; /**< number of entries following this header */
+    uint32_t numberOfLostEntries; /**< number of entries overwritten before the dump */
+} ARNETWORK_TraceRingHeader_t;
+
+#endif /* _ARNETWORK_TRACE_H_ */
@@ -41,5 +41,7 @@
 #include <libARNetwork/ARNETWORK_Error.h>
 #include <libARNetwork/ARNETWORK_IOBufferParam.h>
 #include <libARNetwork/ARNETWORK_Manager.h>
+#include <libARNetwork/ARNETWORK_Trace.h>
+#include <libARNetwork/ARNETWORK_Hub.h>
 
 #endif /* _ARNETWORK_H_ */
@@ -0,0 +1,273 @@
+/*
+    Copyright (C) 2014 Parrot SA
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions
+    are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in
+      the documentation and/or other materials provided with the 
+      distribution.
+    * Neither the name of Parrot nor the names
+      of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written
+      permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+    "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+    LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+    FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+    COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+    INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+    BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+    OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED 
+    AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+    OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+    OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+    SUCH DAMAGE.
+*/
+/**
+ * @file ARNETWORK_Arena.c
+ * @brief contiguous memory in which a Manager and its buffers are allocated
+ * @date 19/10/2026
+ **/
+
+/*****************************************
+ *
+ *             include file :
+ *
+ *****************************************/
+
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <sys/mman.h>
+
+#include <libARSAL/ARSAL_Print.h>
+
+#include <libARNetwork/ARNETWORK_Error.h>
+
+#include "ARNETWORK_Arena.h"
+
+/*****************************************
+ *
+ *             define :
+ *
+ *****************************************/
+
+#define ARNETWORK_ARENA_TAG "ARNETWORK_Arena"
+
+/*****************************************
+ *
+ *             private header:
+ *
+ *****************************************/
+
+/**
+ * @brief check if memory is allocated in the arena
+ * @param arenaPtr the pointer on the arena ; can be NULL
+ * @param ptr memory to check
+ * @return 1 if ptr is in the arena, otherwise 0
+ */
+static int ARNETWORK_Arena_Contains (ARNETWORK_Arena_t *arenaPtr, void *ptr);
+
+/*****************************************
+ *
+ *             implementation :
+ *
+ *****************************************/
+
+ARNETWORK_Arena_t* ARNETWORK_Arena_New (void *memory, size_t size, int isLocked, eARNETWORK_ERROR *error)
+{
+    /** -- Create a new arena -- */
+
+    /** local declarations */
+    eARNETWORK_ERROR localError = ARNETWORK_OK;
+    ARNETWORK_Arena_t *arenaPtr = NULL;
+    size_t alignmentOffset = 0;
+
+    if (size < ARNETWORK_ARENA_ALIGNMENT)
+    {
+        localError = ARNETWORK_ERROR_BAD_PARAMETER;
+    }
+
+    if (localError == ARNETWORK_OK)
+    {
+        arenaPtr = malloc (sizeof (ARNETWORK_Arena_t));
+        if (arenaPtr != NULL)
+        {
+            arenaPtr->userMemory = memory;
+            arenaPtr->userSize = size;
+            arenaPtr->isAllocated = 0;
+            arenaPtr->isLocked = 0;
+
+            if (arenaPtr->userMemory == NULL)
+            {
+                /** the memory is not initialized: only the pages used are mapped, only the allocations set to 0 are written */
+                arenaPtr->userMemory = malloc (size);
+                arenaPtr->isAllocated = 1;
+                if (arenaPtr->userMemory == NULL)
+                {
+                    localError = ARNETWORK_ERROR_ALLOC;
+                }
+            }
+        }
+        else
+        {
+            localError = ARNETWORK_ERROR_ALLOC;
+        }
+    }
+
+    if (localError == ARNETWORK_OK)
+    {
+        alignmentOffset = (ARNETWORK_ARENA_ALIGNMENT - ((uintptr_t) arenaPtr->userMemory % ARNETWORK_ARENA_ALIGNMENT)) % ARNETWORK_ARENA_ALIGNMENT;
+        arenaPtr->memory = arenaPtr->userMemory + alignmentOffset;
+        arenaPtr->size = size - alignmentOffset;
+        arenaPtr->offset = 0;
+
+        if (isLocked)
+        {
+            if (mlock (arenaPtr->userMemory, size) == 0)
+            {
+                arenaPtr->isLocked = 1;
+            }
+            else
+            {
+                ARSAL_PRINT (ARSAL_PRINT_ERROR, ARNETWORK_ARENA_TAG, "mlock of %zu bytes failed, errno %d", size, errno);
+                localError = ARNETWORK_ERROR_MANAGER_MEMORY_LOCK;
+            }
+        }
+    }
+
+    /** delete the arena if an error occurred */
+    if (localError != ARNETWORK_OK)
+    {
+        ARNETWORK_Arena_Delete (&arenaPtr);
+    }
+
+    if (error != NULL)
+    {
+        *error = localError;
+    }
+
+    return arenaPtr;
+}
+
+void ARNETWORK_Arena_Delete (ARNETWORK_Arena_t **arenaPtrAddr)
+{
+    /** -- Delete the arena -- */
+
+    if (arenaPtrAddr != NULL)
+    {
+        if ((*arenaPtrAddr) != NULL)
+        {
+            if ((*arenaPtrAddr)->isLocked)
+            {
+                munlock ((*arenaPtrAddr)->userMemory, (*arenaPtrAddr)->userSize);
+            }
+
+            if ((*arenaPtrAddr)->isAllocated)
+            {
+                free ((*arenaPtrAddr)->userMemory);
+            }
+
+            free (*arenaPtrAddr);
+        }
+        *arenaPtrAddr = NULL;
+    }
+}
+
+void* ARNETWORK_Arena_Malloc (ARNETWORK_Arena_t *arenaPtr, size_t size)
+{
+    /** -- Allocate memory in the arena -- */
+
+    /** local declarations */
+    void *ptr = NULL;
+    size_t allocationSize = ARNETWORK_Arena_GetAllocationSize (size);
+
+    if (arenaPtr == NULL)
+    {
+        ptr = malloc (size);
+    }
+    else if (allocationSize <= arenaPtr->size - arenaPtr->offset)
+    {
+        ptr = arenaPtr->memory + arenaPtr->offset;
+        arenaPtr->offset += allocationSize;
+    }
+    else
+    {
+        ARSAL_PRINT (ARSAL_PRINT_ERROR, ARNETWORK_ARENA_TAG, "arena full: %zu bytes requested, %zu bytes left", size, arenaPtr->size - arenaPtr->offset);
+    }
+
+    return ptr;
+}
+
+void* ARNETWORK_Arena_Calloc (ARNETWORK_Arena_t *arenaPtr, size_t number, size_t size)
+{
+    /** -- Allocate memory set to 0 in the arena -- */
+
+    /** local declarations */
+    void *ptr = NULL;
+
+    if (arenaPtr == NULL)
+    {
+        ptr = calloc (number, size);
+    }
+    else
+    {
+        /** the memory of the arena is not initialized: only this allocation is set to 0 */
+        ptr = ARNETWORK_Arena_Malloc (arenaPtr, number * size);
+        if (ptr != NULL)
+        {
+            memset (ptr, 0, number * size);
+        }
+    }
+
+    return ptr;
+}
+
+void* ARNETWORK_Arena_Realloc (ARNETWORK_Arena_t *arenaPtr, void *ptr, size_t oldSize, size_t newSize)
+{
+    /** -- Resize memory allocated in the arena or by malloc() -- */
+
+    /** local declarations */
+    void *newPtr = NULL;
+
+    if (ARNETWORK_Arena_Contains (arenaPtr, ptr))
+    {
+        newPtr = malloc (newSize);
+        if (newPtr != NULL)
+        {
+            memcpy (newPtr, ptr, (oldSize < newSize) ? oldSize : newSize);
+        }
+    }
+    else
+    {
+        newPtr = realloc (ptr, newSize);
+    }
+
+    return newPtr;
+}
+
+void ARNETWORK_Arena_Free (ARNETWORK_Arena_t *arenaPtr, void *ptr)
+{
+    /** -- Free memory allocated in the arena or by malloc() -- */
+
+    if (!ARNETWORK_Arena_Contains (arenaPtr, ptr))
+    {
+        free (ptr);
+    }
+}
+
+/*****************************************
+ *
+ *             private implementation:
+ *
+ *****************************************/
+
+static int ARNETWORK_Arena_Contains (ARNETWORK_Arena_t *arenaPtr, void *ptr)
+{
+    return ((arenaPtr != NULL) && ((uint8_t *) ptr >= arenaPtr->memory) && ((uint8_t *) ptr < arenaPtr->memory + arenaPtr->size));
+}
@@ -0,0 +1,135 @@
+/*
+    Copyright (C) 2014 Parrot SA
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions
+    are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in
+      the documentation and/or other materials provided with the 
+      distribution.
+    * Neither the name of Parrot nor the names
+      of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written
+      permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+    "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+    LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+    FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+    COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+    INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+    BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+    OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED 
+    AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+    OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+    OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+    SUCH DAMAGE.
+*/
+/**
+ * @file ARNETWORK_Arena.h
+ * @brief contiguous memory in which a Manager and its buffers are allocated
+ * @date 19/10/2026
+ */
+
+#ifndef _ARNETWORK_ARENA_PRIVATE_H_
+#define _ARNETWORK_ARENA_PRIVATE_H_
+
+#include <stddef.h>
+#include <inttypes.h>
+#include <libARNetwork/ARNETWORK_Error.h>
+
+/**
+ * Alignment of the allocations in the arena ; size of a cache line
+ */
+#define ARNETWORK_ARENA_ALIGNMENT (64)
+
+/**
+ * @brief contiguous memory, allocated by increasing offsets and released at once
+ * @details The allocations are aligned on ARNETWORK_ARENA_ALIGNMENT ; the memory is not initialized, only ARNETWORK_Arena_Calloc() sets it to 0.
+ * The memory released in the arena is not reused: it is freed by the deletion of the arena.
+ * @warning before to be used the arena must be created through ARNETWORK_Arena_New()
+ * @post after its using the arena must be deleted through ARNETWORK_Arena_Delete()
+ */
+typedef struct
+{
+    uint8_t *memory; /**< memory of the arena, aligned on ARNETWORK_ARENA_ALIGNMENT */
+    size_t size; /**< size of the memory */
+    size_t offset; /**< offset of the next allocation in the memory */
+    uint8_t *userMemory; /**< memory given at the creation, or allocated by the arena */
+    size_t userSize; /**< size of userMemory */
+    int isAllocated; /**< Indicator of userMemory allocated by the arena (1 = true | 0 = false) */
+    int isLocked; /**< Indicator of userMemory locked in RAM (1 = true | 0 = false) */
+
+}ARNETWORK_Arena_t;
+
+/**
+ * @brief get the size taken in an arena by an allocation
+ * @param[in] size size of the allocation
+ * @return size rounded up to ARNETWORK_ARENA_ALIGNMENT ; an allocation of 0 byte takes ARNETWORK_ARENA_ALIGNMENT bytes
+ */
+static inline size_t ARNETWORK_Arena_GetAllocationSize (size_t size)
+{
+    return (size > 0) ? ((size + ARNETWORK_ARENA_ALIGNMENT - 1) & ~((size_t) ARNETWORK_ARENA_ALIGNMENT - 1)) : ARNETWORK_ARENA_ALIGNMENT;
+}
+
+/**
+ * @brief Create a new arena
+ * @warning This function allocate memory
+ * @post ARNETWORK_Arena_Delete() must be called to delete the arena and free the memory allocated
+ * @param[in] memory memory of the arena, kept by the caller until the deletion of the arena ; NULL to allocate it
+ * @param[in] size size of the memory ; ARNETWORK_ARENA_ALIGNMENT - 1 bytes at most are lost to align it
+ * @param[in] isLocked 1 to lock the memory in RAM with mlock() ; otherwise 0
+ * @param[out] error error output
+ * @return Pointer on the new arena ; NULL if an error occurred
+ * @see ARNETWORK_Arena_Delete()
+ */
+ARNETWORK_Arena_t* ARNETWORK_Arena_New (void *memory, size_t size, int isLocked, eARNETWORK_ERROR *error);
+
+/**
+ * @brief Delete the arena
+ * @warning This function free memory
+ * @param arenaPtrAddr address of the pointer on the arena to delete
+ * @see ARNETWORK_Arena_New()
+ */
+void ARNETWORK_Arena_Delete (ARNETWORK_Arena_t **arenaPtrAddr);
+
+/**
+ * @brief Allocate memory in the arena
+ * @param arenaPtr the pointer on the arena ; NULL to allocate the memory by malloc()
+ * @param[in] size size of the memory
+ * @return Pointer on the memory, not initialized ; NULL if the arena is full
+ */
+void* ARNETWORK_Arena_Malloc (ARNETWORK_Arena_t *arenaPtr, size_t size);
+
+/**
+ * @brief Allocate memory set to 0 in the arena
+ * @param arenaPtr the pointer on the arena ; NULL to allocate the memory by calloc()
+ * @param[in] number number of elements
+ * @param[in] size size of one element
+ * @return Pointer on the memory ; NULL if the arena is full
+ */
+void* ARNETWORK_Arena_Calloc (ARNETWORK_Arena_t *arenaPtr, size_t number, size_t size);
+
+/**
+ * @brief Resize memory allocated in the arena or by malloc()
+ * @details The memory of the arena can not grow: it is moved out of the arena, in memory allocated by malloc().
+ * @param arenaPtr the pointer on the arena ; can be NULL
+ * @param ptr memory to resize ; can be NULL
+ * @param[in] oldSize size of the memory to resize
+ * @param[in] newSize new size of the memory
+ * @return Pointer on the memory resized ; NULL if an error occurred, then ptr is unchanged
+ */
+void* ARNETWORK_Arena_Realloc (ARNETWORK_Arena_t *arenaPtr, void *ptr, size_t oldSize, size_t newSize);
+
+/**
+ * @brief Free memory allocated in the arena or by malloc()
+ * @details The memory of the arena is only freed by the deletion of the arena.
+ * @param arenaPtr the pointer on the arena ; can be NULL
+ * @param ptr memory to free ; can be NULL
+ */
+void ARNETWORK_Arena_Free (ARNETWORK_Arena_t *arenaPtr, void *ptr);
+
+#endif /** _ARNETWORK_ARENA_PRIVATE_H_ */
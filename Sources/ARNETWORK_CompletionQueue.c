@@ -0,0 +1,295 @@
+/*
+    Copyright (C) 2014 Parrot SA
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions
+    are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in
+      the documentation and/or other materials provided with the 
+      distribution.
+    * Neither the name of Parrot nor the names
+      of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written
+      permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+    "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+    LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+    FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+    COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+    INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+    BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+    OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED 
+    AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+    OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+    OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+    SUCH DAMAGE.
+*/
+/**
+ * @file ARNETWORK_CompletionQueue.c
+ * @brief queue of the completions of the data sent, drained by the application from its own thread
+ * @date 19/10/2026
+ **/
+
+/*****************************************
+ *
+ *             include file :
+ *
+ *****************************************/
+
+#include <stdlib.h>
+
+#include <libARSAL/ARSAL_Print.h>
+
+#include <libARNetwork/ARNETWORK_Error.h>
+
+#include "ARNETWORK_CompletionQueue.h"
+
+/*****************************************
+ *
+ *             define :
+ *
+ *****************************************/
+
+#define ARNETWORK_COMPLETIONQUEUE_TAG "ARNETWORK_CompletionQueue"
+
+/*****************************************
+ *
+ *             private header:
+ *
+ *****************************************/
+
+/**
+ * @brief get the number of cells of a completion queue
+ * @param[in] numberOfCompletions minimum number of completions stored
+ * @return the power of two greater than or equal to numberOfCompletions
+ */
+static size_t ARNETWORK_CompletionQueue_GetNumberOfCells (int numberOfCompletions);
+
+/*****************************************
+ *
+ *             implementation :
+ *
+ *****************************************/
+
+ARNETWORK_CompletionQueue_t* ARNETWORK_CompletionQueue_New (int numberOfCompletions, eARNETWORK_ERROR *error)
+{
+    /** -- Create a new completion queue -- */
+
+    /** local declarations */
+    eARNETWORK_ERROR localError = ARNETWORK_OK;
+    ARNETWORK_CompletionQueue_t *queuePtr = NULL;
+    size_t numberOfCells = 0;
+    size_t cellIndex = 0;
+
+    if ((numberOfCompletions <= 0) || (numberOfCompletions > ARNETWORK_COMPLETIONQUEUE_NUMBER_OF_COMPLETIONS_MAX))
+    {
+        localError = ARNETWORK_ERROR_BAD_PARAMETER;
+    }
+
+    if (localError == ARNETWORK_OK)
+    {
+        queuePtr = malloc (sizeof (ARNETWORK_CompletionQueue_t));
+        if (queuePtr != NULL)
+        {
+            numberOfCells = ARNETWORK_CompletionQueue_GetNumberOfCells (numberOfCompletions);
+            queuePtr->mask = numberOfCells - 1;
+            queuePtr->tail = 0;
+            queuePtr->head = 0;
+            queuePtr->isSignaled = 0;
+            queuePtr->numberOfOverflows = 0;
+            queuePtr->notifierPtr = NULL;
+            queuePtr->cellArr = malloc (numberOfCells * sizeof (ARNETWORK_CompletionQueue_Cell_t));
+            if (queuePtr->cellArr == NULL)
+            {
+                localError = ARNETWORK_ERROR_ALLOC;
+            }
+        }
+        else
+        {
+            localError = ARNETWORK_ERROR_ALLOC;
+        }
+    }
+
+    if (localError == ARNETWORK_OK)
+    {
+        /** the cell of each position is free for it */
+        for (cellIndex = 0; cellIndex < numberOfCells; cellIndex++)
+        {
+            queuePtr->cellArr[cellIndex].sequence = cellIndex;
+        }
+
+        queuePtr->notifierPtr = ARNETWORK_Notifier_New (&localError);
+    }
+
+    /** delete the completion queue if an error occurred */
+    if (localError != ARNETWORK_OK)
+    {
+        ARSAL_PRINT (ARSAL_PRINT_ERROR, ARNETWORK_COMPLETIONQUEUE_TAG, "error: %s", ARNETWORK_Error_ToString (localError));
+        ARNETWORK_CompletionQueue_Delete (&queuePtr);
+    }
+
+    if (error != NULL)
+    {
+        *error = localError;
+    }
+
+    return queuePtr;
+}
+
+void ARNETWORK_CompletionQueue_Delete (ARNETWORK_CompletionQueue_t **queuePtrAddr)
+{
+    /** -- Delete the completion queue -- */
+
+    if (queuePtrAddr != NULL)
+    {
+        if ((*queuePtrAddr) != NULL)
+        {
+            ARNETWORK_Notifier_Delete (&((*queuePtrAddr)->notifierPtr));
+            free ((*queuePtrAddr)->cellArr);
+            free (*queuePtrAddr);
+        }
+        *queuePtrAddr = NULL;
+    }
+}
+
+int ARNETWORK_CompletionQueue_Push (ARNETWORK_CompletionQueue_t *queuePtr, const ARNETWORK_Manager_Completion_t *completion)
+{
+    /** -- Push a completion in the queue -- */
+
+    /** local declarations */
+    ARNETWORK_CompletionQueue_Cell_t *cell = NULL;
+    size_t position = __atomic_load_n (&(queuePtr->tail), __ATOMIC_RELAXED);
+    size_t sequence = 0;
+    int isPushed = 0;
+    int isFull = 0;
+
+    /** reserve the position at the tail: its cell must have been drained */
+    while ((!isPushed) && (!isFull))
+    {
+        cell = &(queuePtr->cellArr[position & queuePtr->mask]);
+        sequence = __atomic_load_n (&(cell->sequence), __ATOMIC_ACQUIRE);
+
+        if (sequence == position)
+        {
+            /** on failure, position is updated with the tail taken by another producer */
+            isPushed = __atomic_compare_exchange_n (&(queuePtr->tail), &position, position + 1, 1, __ATOMIC_RELAXED, __ATOMIC_RELAXED);
+        }
+        else if ((ptrdiff_t) (sequence - position) < 0)
+        {
+            /** the cell still stores the completion of the previous lap */
+            isFull = 1;
+        }
+        else
+        {
+            /** another producer has taken this position */
+            position = __atomic_load_n (&(queuePtr->tail), __ATOMIC_RELAXED);
+        }
+    }
+
+    if (isPushed)
+    {
+        /** publish the completion to the consumer */
+        cell->completion = *completion;
+        __atomic_store_n (&(cell->sequence), position + 1, __ATOMIC_RELEASE);
+
+        /** signal the queue becoming not empty once, until the next drain */
+        if (__atomic_exchange_n (&(queuePtr->isSignaled), 1, __ATOMIC_SEQ_CST) == 0)
+        {
+            ARNETWORK_Notifier_Signal (queuePtr->notifierPtr);
+        }
+    }
+    else
+    {
+        if (__atomic_add_fetch (&(queuePtr->numberOfOverflows), 1, __ATOMIC_RELAXED) == 1)
+        {
+            ARSAL_PRINT (ARSAL_PRINT_WARNING, ARNETWORK_COMPLETIONQUEUE_TAG, "completion queue full, the completions are called back synchronously");
+        }
+    }
+
+    return isPushed;
+}
+
+int ARNETWORK_CompletionQueue_Drain (ARNETWORK_CompletionQueue_t *queuePtr, ARNETWORK_Manager_Completion_t *completionArr, int maxNumberOfCompletions)
+{
+    /** -- Drain the completions of the queue -- */
+
+    /** local declarations */
+    ARNETWORK_CompletionQueue_Cell_t *cell = NULL;
+    int numberOfCompletions = 0;
+    int isEmpty = 0;
+
+    /** clear the notifier before the drain: a completion pushed from now signals it again */
+    __atomic_store_n (&(queuePtr->isSignaled), 0, __ATOMIC_SEQ_CST);
+    ARNETWORK_Notifier_Clear (queuePtr->notifierPtr);
+
+    while ((numberOfCompletions < maxNumberOfCompletions) && (!isEmpty))
+    {
+        cell = &(queuePtr->cellArr[queuePtr->head & queuePtr->mask]);
+
+        if (__atomic_load_n (&(cell->sequence), __ATOMIC_ACQUIRE) == queuePtr->head + 1)
+        {
+            completionArr[numberOfCompletions] = cell->completion;
+            numberOfCompletions++;
+
+            /** free the cell for the position of the next lap */
+            __atomic_store_n (&(cell->sequence), queuePtr->head + queuePtr->mask + 1, __ATOMIC_RELEASE);
+            queuePtr->head++;
+        }
+        else
+        {
+            isEmpty = 1;
+        }
+    }
+
+    /** the completions left in the queue are notified again */
+    if ((!isEmpty) && (__atomic_exchange_n (&(queuePtr->isSignaled), 1, __ATOMIC_SEQ_CST) == 0))
+    {
+        ARNETWORK_Notifier_Signal (queuePtr->notifierPtr);
+    }
+
+    return numberOfCompletions;
+}
+
+int ARNETWORK_CompletionQueue_GetMemoryFootprint (ARNETWORK_CompletionQueue_t *queuePtr, int numberOfCompletions)
+{
+    /** -- Get the memory allocated by a completion queue -- */
+
+    /** local declarations */
+    int size = 0;
+
+    if (queuePtr != NULL)
+    {
+        size = sizeof (ARNETWORK_CompletionQueue_t) + sizeof (ARNETWORK_Notifier_t) + (queuePtr->mask + 1) * sizeof (ARNETWORK_CompletionQueue_Cell_t);
+    }
+    else if ((numberOfCompletions > 0) && (numberOfCompletions <= ARNETWORK_COMPLETIONQUEUE_NUMBER_OF_COMPLETIONS_MAX))
+    {
+        size = sizeof (ARNETWORK_CompletionQueue_t) + sizeof (ARNETWORK_Notifier_t) + ARNETWORK_CompletionQueue_GetNumberOfCells (numberOfCompletions) * sizeof (ARNETWORK_CompletionQueue_Cell_t);
+    }
+
+    return size;
+}
+
+/*****************************************
+ *
+ *             private implementation:
+ *
+ *****************************************/
+
+static size_t ARNETWORK_CompletionQueue_GetNumberOfCells (int numberOfCompletions)
+{
+    /** -- get the number of cells of a completion queue -- */
+
+    /** local declarations */
+    size_t numberOfCells = 1;
+
+    while (numberOfCells < (size_t) numberOfCompletions)
+    {
+        numberOfCells <<= 1;
+    }
+
+    return numberOfCells;
+}
@@ -0,0 +1,127 @@
+/*
+    Copyright (C) 2014 Parrot SA
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions
+    are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in
+      the documentation and/or other materials provided with the 
+      distribution.
+    * Neither the name of Parrot nor the names
+      of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written
+      permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+    "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+    LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+    FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+    COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+    INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+    BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+    OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED 
+    AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+    OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+    OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+    SUCH DAMAGE.
+*/
+/**
+ * @file ARNETWORK_CompletionQueue.h
+ * @brief queue of the completions of the data sent, drained by the application from its own thread
+ * @date 19/10/2026
+ */
+
+#ifndef _ARNETWORK_COMPLETIONQUEUE_PRIVATE_H_
+#define _ARNETWORK_COMPLETIONQUEUE_PRIVATE_H_
+
+#include <stddef.h>
+#include <inttypes.h>
+#include <libARNetwork/ARNETWORK_Error.h>
+#include <libARNetwork/ARNETWORK_Manager.h>
+#include "ARNETWORK_Notifier.h"
+
+/**
+ * maximum number of completions of a completion queue
+ */
+#define ARNETWORK_COMPLETIONQUEUE_NUMBER_OF_COMPLETIONS_MAX (65536)
+
+/**
+ * @brief cell of the completion queue
+ */
+typedef struct
+{
+    size_t sequence; /**< position for which the cell can be written (equal to it) or read (equal to it + 1). Must be accessed with atomic operations */
+    ARNETWORK_Manager_Completion_t completion; /**< completion stored in the cell */
+
+}ARNETWORK_CompletionQueue_Cell_t;
+
+/**
+ * @brief bounded lock-free queue of completions, with many producers and one consumer
+ * @details The producers (the sending and receiving threads, and the application threads adding or flushing data) never block:
+ * a push on a full queue fails. The notifier is signaled when the queue becomes not empty.
+ * @warning before to be used the completion queue must be created through ARNETWORK_CompletionQueue_New()
+ * @post after its using the completion queue must be deleted through ARNETWORK_CompletionQueue_Delete()
+ */
+typedef struct
+{
+    ARNETWORK_CompletionQueue_Cell_t *cellArr; /**< cells of the queue */
+    size_t mask; /**< number of cells - 1 ; the number of cells is a power of two */
+    size_t tail; /**< position of the next completion pushed. Must be accessed with atomic operations */
+    size_t head; /**< position of the next completion drained ; only used by the consumer */
+    int isSignaled; /**< Boolean-like. 1 while the notifier is signaled and the queue not drained. Must be accessed with atomic operations */
+    uint32_t numberOfOverflows; /**< Number of completions not pushed because the queue was full. Must be accessed with atomic operations */
+    ARNETWORK_Notifier_t *notifierPtr; /**< notifier signaled when the queue becomes not empty */
+
+}ARNETWORK_CompletionQueue_t;
+
+/**
+ * @brief Create a new completion queue
+ * @warning This function allocate memory and open file descriptors
+ * @post ARNETWORK_CompletionQueue_Delete() must be called to delete the completion queue and free the memory allocated
+ * @param[in] numberOfCompletions minimum number of completions stored, at most ARNETWORK_COMPLETIONQUEUE_NUMBER_OF_COMPLETIONS_MAX ; rounded up to a power of two
+ * @param[out] error pointer on the error output ; can be NULL
+ * @return Pointer on the new completion queue, empty
+ * @see ARNETWORK_CompletionQueue_Delete()
+ */
+ARNETWORK_CompletionQueue_t* ARNETWORK_CompletionQueue_New (int numberOfCompletions, eARNETWORK_ERROR *error);
+
+/**
+ * @brief Delete the completion queue
+ * @warning This function free memory ; the completions not drained are lost
+ * @param queuePtrAddr address of the pointer on the completion queue to delete
+ * @see ARNETWORK_CompletionQueue_New()
+ */
+void ARNETWORK_CompletionQueue_Delete (ARNETWORK_CompletionQueue_t **queuePtrAddr);
+
+/**
+ * @brief Push a completion in the queue
+ * @note can be called from any thread, it doesn't block
+ * @param queuePtr the pointer on the completion queue
+ * @param[in] completion the completion to push
+ * @return 1 if the completion is pushed, 0 if the queue is full
+ */
+int ARNETWORK_CompletionQueue_Push (ARNETWORK_CompletionQueue_t *queuePtr, const ARNETWORK_Manager_Completion_t *completion);
+
+/**
+ * @brief Drain the completions of the queue, in the order of their push
+ * @details The notifier is cleared before the drain ; it is signaled again by the next push.
+ * @warning must not be called by several threads at once
+ * @param queuePtr the pointer on the completion queue
+ * @param[out] completionArr array to store the completions drained
+ * @param[in] maxNumberOfCompletions size of completionArr
+ * @return number of completions drained
+ */
+int ARNETWORK_CompletionQueue_Drain (ARNETWORK_CompletionQueue_t *queuePtr, ARNETWORK_Manager_Completion_t *completionArr, int maxNumberOfCompletions);
+
+/**
+ * @brief Gets the memory allocated by a completion queue
+ * @param queuePtr the pointer on the completion queue ; can be NULL
+ * @param[in] numberOfCompletions number of completions given to the creation of the queue, if queuePtr is NULL ; 0 for no queue
+ * @return Size in byte of the memory allocated, or to be allocated, by the completion queue
+ */
+int ARNETWORK_CompletionQueue_GetMemoryFootprint (ARNETWORK_CompletionQueue_t *queuePtr, int numberOfCompletions);
+
+#endif /** _ARNETWORK_COMPLETIONQUEUE_PRIVATE_H_ */
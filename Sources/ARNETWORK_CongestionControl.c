@@ -0,0 +1,433 @@
+/*
+    Copyright (C) 2014 Parrot SA
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions
+    are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in
+      the documentation and/or other materials provided with the 
+      distribution.
+    * Neither the name of Parrot nor the names
+      of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written
+      permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+    "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+    LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+    FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+    COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+    INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+    BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+    OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED 
+    AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+    OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+    OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+    SUCH DAMAGE.
+*/
+/**
+ * @file ARNETWORK_CongestionControl.c
+ * @brief congestion control of the sender, driven by the round trip times and the retries
+ * @date 19/10/2026
+ **/
+
+/*****************************************
+ *
+ *             include file :
+ *
+ *****************************************/
+
+#include <stdlib.h>
+
+#include <libARSAL/ARSAL_Print.h>
+#include <libARSAL/ARSAL_Mutex.h>
+#include <libARSAL/ARSAL_Time.h>
+
+#include <libARNetwork/ARNETWORK_Error.h>
+#include <libARNetwork/ARNETWORK_Manager.h>
+
+#include "ARNETWORK_CongestionControl.h"
+
+/*****************************************
+ *
+ *             define :
+ *
+ *****************************************/
+
+#define ARNETWORK_CONGESTIONCONTROL_TAG "ARNETWORK_CongestionControl"
+
+/*****************************************
+ *
+ *             private header:
+ *
+ *****************************************/
+
+/**
+ * @brief reset the state of the congestion control
+ * @warning The congestion control mutex must be locked before the calling of this function and unlocked after.
+ * @param congestionControlPtr the pointer on the congestion control
+ */
+static void ARNETWORK_CongestionControl_ResetState (ARNETWORK_CongestionControl_t *congestionControlPtr);
+
+/**
+ * @brief reduce the congestion window, at most once per round trip time
+ * @warning The congestion control mutex must be locked before the calling of this function and unlocked after.
+ * @param congestionControlPtr the pointer on the congestion control
+ * @param[in] now current time
+ * @return 1 if the window has been reduced, otherwise 0
+ */
+static int ARNETWORK_CongestionControl_ReduceWindow (ARNETWORK_CongestionControl_t *congestionControlPtr, struct timespec *now);
+
+/*****************************************
+ *
+ *             implementation :
+ *
+ *****************************************/
+
+ARNETWORK_CongestionControl_t* ARNETWORK_CongestionControl_New (void)
+{
+    /** -- Create a new congestion control -- */
+
+    /** local declarations */
+    ARNETWORK_CongestionControl_t *congestionControlPtr = malloc (sizeof (ARNETWORK_CongestionControl_t));
+
+    if (congestionControlPtr != NULL)
+    {
+        if (ARSAL_Mutex_Init (&(congestionControlPtr->mutex)) == 0)
+        {
+            congestionControlPtr->algorithm = ARNETWORK_MANAGER_CONGESTION_CONTROL_NONE;
+            ARNETWORK_CongestionControl_ResetState (congestionControlPtr);
+        }
+        else
+        {
+            ARSAL_PRINT (ARSAL_PRINT_ERROR, ARNETWORK_CONGESTIONCONTROL_TAG, "error: %s", ARNETWORK_Error_ToString (ARNETWORK_ERROR_MUTEX));
+            free (congestionControlPtr);
+            congestionControlPtr = NULL;
+        }
+    }
+
+    return congestionControlPtr;
+}
+
+void ARNETWORK_CongestionControl_Delete (ARNETWORK_CongestionControl_t **congestionControlPtrAddr)
+{
+    /** -- Delete the congestion control -- */
+
+    if (congestionControlPtrAddr != NULL)
+    {
+        if ((*congestionControlPtrAddr) != NULL)
+        {
+            ARSAL_Mutex_Destroy (&((*congestionControlPtrAddr)->mutex));
+
+            free (*congestionControlPtrAddr);
+        }
+        *congestionControlPtrAddr = NULL;
+    }
+}
+
+eARNETWORK_ERROR ARNETWORK_CongestionControl_SetAlgorithm (ARNETWORK_CongestionControl_t *congestionControlPtr, eARNETWORK_MANAGER_CONGESTION_CONTROL algorithm)
+{
+    /** -- Set the algorithm of the congestion control -- */
+
+    /** local declarations */
+    eARNETWORK_ERROR error = ARNETWORK_OK;
+
+    if ((congestionControlPtr == NULL) ||
+        (algorithm < ARNETWORK_MANAGER_CONGESTION_CONTROL_NONE) ||
+        (algorithm >= ARNETWORK_MANAGER_CONGESTION_CONTROL_MAX))
+    {
+        error = ARNETWORK_ERROR_BAD_PARAMETER;
+    }
+
+    if (error == ARNETWORK_OK)
+    {
+        ARSAL_Mutex_Lock (&(congestionControlPtr->mutex));
+        congestionControlPtr->algorithm = algorithm;
+        ARNETWORK_CongestionControl_ResetState (congestionControlPtr);
+        ARSAL_Mutex_Unlock (&(congestionControlPtr->mutex));
+    }
+
+    return error;
+}
+
+void ARNETWORK_CongestionControl_Reset (ARNETWORK_CongestionControl_t *congestionControlPtr)
+{
+    /** -- Reset the state of the congestion control, keeping its algorithm -- */
+
+    ARSAL_Mutex_Lock (&(congestionControlPtr->mutex));
+    ARNETWORK_CongestionControl_ResetState (congestionControlPtr);
+    ARSAL_Mutex_Unlock (&(congestionControlPtr->mutex));
+}
+
+void ARNETWORK_CongestionControl_OnRttSample (ARNETWORK_CongestionControl_t *congestionControlPtr, int rttMs, struct timespec *now)
+{
+    /** -- Feed the congestion control with a round trip time measure -- */
+
+    /** local declarations */
+    int queuingDelayMs = 0;
+
+    if ((congestionControlPtr == NULL) || (rttMs < 0))
+    {
+        return;
+    }
+
+    ARSAL_Mutex_Lock (&(congestionControlPtr->mutex));
+
+    if (congestionControlPtr->algorithm != ARNETWORK_MANAGER_CONGESTION_CONTROL_NONE)
+    {
+        /** smoothed round trip time (RFC 6298 gain) */
+        if (congestionControlPtr->smoothedRttMs < 0)
+        {
+            congestionControlPtr->smoothedRttMs = rttMs;
+        }
+        else
+        {
+            congestionControlPtr->smoothedRttMs += (rttMs - congestionControlPtr->smoothedRttMs) / 8;
+        }
+
+        /** minimum round trip time, measured again every period to follow the route changes */
+        if ((congestionControlPtr->minRttMs < 0) || (rttMs < congestionControlPtr->minRttMs))
+        {
+            congestionControlPtr->minRttMs = rttMs;
+        }
+        if ((congestionControlPtr->nextMinRttMs < 0) || (rttMs < congestionControlPtr->nextMinRttMs))
+        {
+            congestionControlPtr->nextMinRttMs = rttMs;
+        }
+        if (ARSAL_Time_ComputeTimespecMsTimeDiff (&(congestionControlPtr->minRttPeriodStartTime), now) > ARNETWORK_CONGESTIONCONTROL_MIN_RTT_PERIOD_MS)
+        {
+            congestionControlPtr->minRttMs = congestionControlPtr->nextMinRttMs;
+            congestionControlPtr->nextMinRttMs = -1;
+            congestionControlPtr->minRttPeriodStartTime = *now;
+        }
+
+        /** leave the recovery state after one round trip time */
+        if ((congestionControlPtr->state == ARNETWORK_MANAGER_CONGESTION_STATE_RECOVERY) &&
+            (ARSAL_Time_ComputeTimespecMsTimeDiff (&(congestionControlPtr->recoveryStartTime), now) > congestionControlPtr->smoothedRttMs))
+        {
+            congestionControlPtr->state = ARNETWORK_MANAGER_CONGESTION_STATE_AVOIDANCE;
+        }
+
+        queuingDelayMs = rttMs - congestionControlPtr->minRttMs;
+
+        switch (congestionControlPtr->algorithm)
+        {
+        case ARNETWORK_MANAGER_CONGESTION_CONTROL_AIMD:
+            /** a measure without loss: additive increase */
+            if (congestionControlPtr->state == ARNETWORK_MANAGER_CONGESTION_STATE_SLOW_START)
+            {
+                congestionControlPtr->congestionWindow += 1.f;
+            }
+            else if (congestionControlPtr->state == ARNETWORK_MANAGER_CONGESTION_STATE_AVOIDANCE)
+            {
+                congestionControlPtr->congestionWindow += 1.f / congestionControlPtr->congestionWindow;
+            }
+            break;
+
+        case ARNETWORK_MANAGER_CONGESTION_CONTROL_DELAY:
+            if (queuingDelayMs > 2 * ARNETWORK_CONGESTIONCONTROL_TARGET_DELAY_MS)
+            {
+                /** the queue is building up quickly: multiplicative decrease */
+                if (ARNETWORK_CongestionControl_ReduceWindow (congestionControlPtr, now))
+                {
+                    congestionControlPtr->numberOfDelayEvents++;
+                }
+            }
+            else if (congestionControlPtr->state == ARNETWORK_MANAGER_CONGESTION_STATE_SLOW_START)
+            {
+                if (queuingDelayMs > ARNETWORK_CONGESTIONCONTROL_TARGET_DELAY_MS / 2)
+                {
+                    congestionControlPtr->state = ARNETWORK_MANAGER_CONGESTION_STATE_AVOIDANCE;
+                }
+                else
+                {
+                    congestionControlPtr->congestionWindow += 1.f;
+                }
+            }
+            else if (congestionControlPtr->state == ARNETWORK_MANAGER_CONGESTION_STATE_AVOIDANCE)
+            {
+                /** LEDBAT: move the window proportionally to the distance to the target delay */
+                congestionControlPtr->congestionWindow += (float)(ARNETWORK_CONGESTIONCONTROL_TARGET_DELAY_MS - queuingDelayMs) / ARNETWORK_CONGESTIONCONTROL_TARGET_DELAY_MS;
+            }
+            break;
+
+        default:
+            break;
+        }
+
+        if (congestionControlPtr->congestionWindow < ARNETWORK_CONGESTIONCONTROL_MIN_WINDOW)
+        {
+            congestionControlPtr->congestionWindow = ARNETWORK_CONGESTIONCONTROL_MIN_WINDOW;
+        }
+        else if (congestionControlPtr->congestionWindow > ARNETWORK_CONGESTIONCONTROL_MAX_WINDOW)
+        {
+            congestionControlPtr->congestionWindow = ARNETWORK_CONGESTIONCONTROL_MAX_WINDOW;
+        }
+    }
+
+    ARSAL_Mutex_Unlock (&(congestionControlPtr->mutex));
+}
+
+void ARNETWORK_CongestionControl_OnLoss (ARNETWORK_CongestionControl_t *congestionControlPtr, struct timespec *now)
+{
+    /** -- Feed the congestion control with a loss -- */
+
+    if (congestionControlPtr == NULL)
+    {
+        return;
+    }
+
+    ARSAL_Mutex_Lock (&(congestionControlPtr->mutex));
+
+    if ((congestionControlPtr->algorithm != ARNETWORK_MANAGER_CONGESTION_CONTROL_NONE) &&
+        (ARNETWORK_CongestionControl_ReduceWindow (congestionControlPtr, now)))
+    {
+        congestionControlPtr->numberOfLossEvents++;
+    }
+
+    ARSAL_Mutex_Unlock (&(congestionControlPtr->mutex));
+}
+
+int ARNETWORK_CongestionControl_CanSend (ARNETWORK_CongestionControl_t *congestionControlPtr, struct timespec *now)
+{
+    /** -- Ask the congestion control if a throttled data can be sent now -- */
+
+    /** local declarations */
+    int canSend = 1;
+    int elapsedMs = 0;
+
+    if (congestionControlPtr == NULL)
+    {
+        return canSend;
+    }
+
+    ARSAL_Mutex_Lock (&(congestionControlPtr->mutex));
+
+    /** no throttling while the round trip time is unknown */
+    if ((congestionControlPtr->algorithm != ARNETWORK_MANAGER_CONGESTION_CONTROL_NONE) &&
+        (congestionControlPtr->smoothedRttMs >= 0))
+    {
+        /** refill the tokens: one congestion window per round trip time */
+        elapsedMs = ARSAL_Time_ComputeTimespecMsTimeDiff (&(congestionControlPtr->lastRefillTime), now);
+        if (elapsedMs > 0)
+        {
+            congestionControlPtr->tokens += congestionControlPtr->congestionWindow * elapsedMs / ((congestionControlPtr->smoothedRttMs > 0) ? congestionControlPtr->smoothedRttMs : 1);
+            if (congestionControlPtr->tokens > congestionControlPtr->congestionWindow)
+            {
+                congestionControlPtr->tokens = congestionControlPtr->congestionWindow;
+            }
+            congestionControlPtr->lastRefillTime = *now;
+        }
+
+        if (congestionControlPtr->tokens >= 1.f)
+        {
+            congestionControlPtr->tokens -= 1.f;
+        }
+        else
+        {
+            congestionControlPtr->numberOfThrottledSends++;
+            canSend = 0;
+        }
+    }
+
+    ARSAL_Mutex_Unlock (&(congestionControlPtr->mutex));
+
+    return canSend;
+}
+
+int ARNETWORK_CongestionControl_GetWaitTimeMs (ARNETWORK_CongestionControl_t *congestionControlPtr)
+{
+    /** -- Get the time to wait before a throttled data can be sent -- */
+
+    /** local declarations */
+    int waitTimeMs = 0;
+
+    if (congestionControlPtr == NULL)
+    {
+        return waitTimeMs;
+    }
+
+    ARSAL_Mutex_Lock (&(congestionControlPtr->mutex));
+
+    if ((congestionControlPtr->algorithm != ARNETWORK_MANAGER_CONGESTION_CONTROL_NONE) &&
+        (congestionControlPtr->smoothedRttMs >= 0) &&
+        (congestionControlPtr->tokens < 1.f))
+    {
+        waitTimeMs = (int)((1.f - congestionControlPtr->tokens) * congestionControlPtr->smoothedRttMs / congestionControlPtr->congestionWindow) + 1;
+    }
+
+    ARSAL_Mutex_Unlock (&(congestionControlPtr->mutex));
+
+    return waitTimeMs;
+}
+
+void ARNETWORK_CongestionControl_GetStatus (ARNETWORK_CongestionControl_t *congestionControlPtr, ARNETWORK_Manager_CongestionControlStatus_t *status)
+{
+    /** -- Get the status of the congestion control -- */
+
+    ARSAL_Mutex_Lock (&(congestionControlPtr->mutex));
+
+    status->algorithm = congestionControlPtr->algorithm;
+    status->state = congestionControlPtr->state;
+    status->congestionWindow = (int)congestionControlPtr->congestionWindow;
+    status->smoothedRttMs = congestionControlPtr->smoothedRttMs;
+    status->minRttMs = congestionControlPtr->minRttMs;
+    status->numberOfLossEvents = congestionControlPtr->numberOfLossEvents;
+    status->numberOfDelayEvents = congestionControlPtr->numberOfDelayEvents;
+    status->numberOfThrottledSends = congestionControlPtr->numberOfThrottledSends;
+
+    ARSAL_Mutex_Unlock (&(congestionControlPtr->mutex));
+}
+
+/*****************************************
+ *
+ *             private implementation:
+ *
+ *****************************************/
+
+static void ARNETWORK_CongestionControl_ResetState (ARNETWORK_CongestionControl_t *congestionControlPtr)
+{
+    /** -- reset the state of the congestion control -- */
+
+    congestionControlPtr->state = (congestionControlPtr->algorithm == ARNETWORK_MANAGER_CONGESTION_CONTROL_NONE) ? ARNETWORK_MANAGER_CONGESTION_STATE_DISABLED : ARNETWORK_MANAGER_CONGESTION_STATE_SLOW_START;
+    congestionControlPtr->congestionWindow = ARNETWORK_CONGESTIONCONTROL_INITIAL_WINDOW;
+    congestionControlPtr->tokens = ARNETWORK_CONGESTIONCONTROL_INITIAL_WINDOW;
+    congestionControlPtr->smoothedRttMs = -1;
+    congestionControlPtr->minRttMs = -1;
+    congestionControlPtr->nextMinRttMs = -1;
+    congestionControlPtr->numberOfLossEvents = 0;
+    congestionControlPtr->numberOfDelayEvents = 0;
+    congestionControlPtr->numberOfThrottledSends = 0;
+    ARSAL_Time_GetTime (&(congestionControlPtr->lastRefillTime));
+    congestionControlPtr->minRttPeriodStartTime = congestionControlPtr->lastRefillTime;
+    congestionControlPtr->recoveryStartTime = congestionControlPtr->lastRefillTime;
+}
+
+static int ARNETWORK_CongestionControl_ReduceWindow (ARNETWORK_CongestionControl_t *congestionControlPtr, struct timespec *now)
+{
+    /** -- reduce the congestion window, at most once per round trip time -- */
+
+    /** local declarations */
+    int isReduced = 0;
+
+    if (congestionControlPtr->state != ARNETWORK_MANAGER_CONGESTION_STATE_RECOVERY)
+    {
+        congestionControlPtr->congestionWindow /= 2.f;
+        if (congestionControlPtr->congestionWindow < ARNETWORK_CONGESTIONCONTROL_MIN_WINDOW)
+        {
+            congestionControlPtr->congestionWindow = ARNETWORK_CONGESTIONCONTROL_MIN_WINDOW;
+        }
+        if (congestionControlPtr->tokens > congestionControlPtr->congestionWindow)
+        {
+            congestionControlPtr->tokens = congestionControlPtr->congestionWindow;
+        }
+        congestionControlPtr->state = ARNETWORK_MANAGER_CONGESTION_STATE_RECOVERY;
+        congestionControlPtr->recoveryStartTime = *now;
+        isReduced = 1;
+    }
+
+    return isReduced;
+}
@@ -0,0 +1,168 @@
+/*
+    Copyright (C) 2014 Parrot SA
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions
+    are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in
+      the documentation and/or other materials provided with the 
+      distribution.
+    * Neither the name of Parrot nor the names
+      of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written
+      permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+    "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+    LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+    FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+    COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+    INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+    BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+    OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED 
+    AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+    OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+    OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+    SUCH DAMAGE.
+*/
+/**
+ * @file ARNETWORK_CongestionControl.h
+ * @brief congestion control of the sender, driven by the round trip times and the retries
+ * @date 10/19/2026
+ */
+
+#ifndef _ARNETWORK_CONGESTIONCONTROL_PRIVATE_H_
+#define _ARNETWORK_CONGESTIONCONTROL_PRIVATE_H_
+
+#include <libARSAL/ARSAL_Mutex.h>
+#include <libARSAL/ARSAL_Time.h>
+#include <libARNetwork/ARNETWORK_Error.h>
+#include <libARNetwork/ARNETWORK_Manager.h>
+
+/**
+ * Initial congestion window, in data per round trip time
+ */
+#define ARNETWORK_CONGESTIONCONTROL_INITIAL_WINDOW (10)
+
+/**
+ * Minimum congestion window, in data per round trip time
+ */
+#define ARNETWORK_CONGESTIONCONTROL_MIN_WINDOW (2)
+
+/**
+ * Maximum congestion window, in data per round trip time
+ */
+#define ARNETWORK_CONGESTIONCONTROL_MAX_WINDOW (10000)
+
+/**
+ * Target queuing delay of the delay based algorithm
+ */
+#define ARNETWORK_CONGESTIONCONTROL_TARGET_DELAY_MS (100)
+
+/**
+ * Period after which the minimum round trip time is measured again
+ * This allows to follow a route change
+ */
+#define ARNETWORK_CONGESTIONCONTROL_MIN_RTT_PERIOD_MS (60000)
+
+/**
+ * @brief congestion control of the sender
+ * @warning before to be used the congestion control must be created through ARNETWORK_CongestionControl_New()
+ * @post after its using the congestion control must be deleted through ARNETWORK_CongestionControl_Delete()
+ */
+typedef struct
+{
+    eARNETWORK_MANAGER_CONGESTION_CONTROL algorithm; /**< algorithm in use */
+    eARNETWORK_MANAGER_CONGESTION_STATE state; /**< current state */
+
+    float congestionWindow; /**< number of data allowed to be sent per round trip time */
+    float tokens; /**< number of data which can be sent right now */
+    struct timespec lastRefillTime; /**< last time the tokens were refilled */
+
+    int smoothedRttMs; /**< smoothed round trip time (negative if not yet measured) */
+    int minRttMs; /**< minimum round trip time of the current period (negative if not yet measured) */
+    int nextMinRttMs; /**< minimum round trip time of the next period */
+    struct timespec minRttPeriodStartTime; /**< start time of the minimum round trip time period */
+    struct timespec recoveryStartTime; /**< time of the last window reduction */
+
+    uint32_t numberOfLossEvents; /**< number of window reductions due to retries */
+    uint32_t numberOfDelayEvents; /**< number of window reductions due to the queuing delay */
+    uint32_t numberOfThrottledSends; /**< number of sends delayed by the window */
+
+    ARSAL_Mutex_t mutex; /**< Mutex to take before to use the congestion control */
+
+}ARNETWORK_CongestionControl_t;
+
+/**
+ * @brief Create a new congestion control
+ * @warning This function allocate memory
+ * @post ARNETWORK_CongestionControl_Delete() must be called to delete the congestion control and free the memory allocated
+ * @return Pointer on the new congestion control, disabled
+ * @see ARNETWORK_CongestionControl_Delete()
+ */
+ARNETWORK_CongestionControl_t* ARNETWORK_CongestionControl_New (void);
+
+/**
+ * @brief Delete the congestion control
+ * @warning This function free memory
+ * @param congestionControlPtrAddr address of the pointer on the congestion control to delete
+ * @see ARNETWORK_CongestionControl_New()
+ */
+void ARNETWORK_CongestionControl_Delete (ARNETWORK_CongestionControl_t **congestionControlPtrAddr);
+
+/**
+ * @brief Set the algorithm of the congestion control and reset its state
+ * @param congestionControlPtr the pointer on the congestion control
+ * @param[in] algorithm algorithm to use
+ * @return eARNETWORK_ERROR
+ */
+eARNETWORK_ERROR ARNETWORK_CongestionControl_SetAlgorithm (ARNETWORK_CongestionControl_t *congestionControlPtr, eARNETWORK_MANAGER_CONGESTION_CONTROL algorithm);
+
+/**
+ * @brief Reset the state of the congestion control, as at the start of a connection ; the algorithm is kept
+ * @param congestionControlPtr the pointer on the congestion control
+ */
+void ARNETWORK_CongestionControl_Reset (ARNETWORK_CongestionControl_t *congestionControlPtr);
+
+/**
+ * @brief Feed the congestion control with a round trip time measure
+ * @param congestionControlPtr the pointer on the congestion control
+ * @param[in] rttMs round trip time measured, in millisecond
+ * @param[in] now time of the measure
+ */
+void ARNETWORK_CongestionControl_OnRttSample (ARNETWORK_CongestionControl_t *congestionControlPtr, int rttMs, struct timespec *now);
+
+/**
+ * @brief Feed the congestion control with a loss (a retry of a data waiting an acknowledgement)
+ * @param congestionControlPtr the pointer on the congestion control
+ * @param[in] now time of the loss detection
+ */
+void ARNETWORK_CongestionControl_OnLoss (ARNETWORK_CongestionControl_t *congestionControlPtr, struct timespec *now);
+
+/**
+ * @brief Ask the congestion control if a throttled data can be sent now
+ * @note If the data can be sent, it is accounted in the congestion window
+ * @param congestionControlPtr the pointer on the congestion control
+ * @param[in] now current time
+ * @return 1 if the data can be sent, otherwise 0
+ */
+int ARNETWORK_CongestionControl_CanSend (ARNETWORK_CongestionControl_t *congestionControlPtr, struct timespec *now);
+
+/**
+ * @brief Get the time to wait before a throttled data can be sent
+ * @param congestionControlPtr the pointer on the congestion control
+ * @return time to wait in millisecond, 0 if a data can be sent now
+ */
+int ARNETWORK_CongestionControl_GetWaitTimeMs (ARNETWORK_CongestionControl_t *congestionControlPtr);
+
+/**
+ * @brief Get the status of the congestion control
+ * @param congestionControlPtr the pointer on the congestion control
+ * @param[out] status pointer to store the status
+ */
+void ARNETWORK_CongestionControl_GetStatus (ARNETWORK_CongestionControl_t *congestionControlPtr, ARNETWORK_Manager_CongestionControlStatus_t *status);
+
+#endif /** _ARNETWORK_CONGESTIONCONTROL_PRIVATE_H_ */
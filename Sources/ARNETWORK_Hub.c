@@ -0,0 +1,835 @@
+/*
+    Copyright (C) 2014 Parrot SA
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions
+    are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in
+      the documentation and/or other materials provided with the 
+      distribution.
+    * Neither the name of Parrot nor the names
+      of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written
+      permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+    "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+    LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+    FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+    COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+    INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+    BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+    OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED 
+    AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+    OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+    OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+    SUCH DAMAGE.
+*/
+/**
+ * @file ARNETWORK_Hub.c
+ * @brief hub driving the senders and the receivers of several Managers from a shared pool of threads
+ * @date 19/10/2026
+ **/
+
+/*****************************************
+ *
+ *             include file :
+ *
+ *****************************************/
+
+#include <stdlib.h>
+#include <stdint.h>
+#include <unistd.h>
+#include <errno.h>
+
+#ifdef __linux__
+#include <sys/epoll.h>
+#endif
+
+#include <libARSAL/ARSAL_Print.h>
+#include <libARSAL/ARSAL_Mutex.h>
+#include <libARSAL/ARSAL_Time.h>
+
+#include <libARNetwork/ARNETWORK_Error.h>
+#include "ARNETWORK_IOBuffer.h"
+#include "ARNETWORK_Sender.h"
+#include "ARNETWORK_Receiver.h"
+#include "ARNETWORK_Notifier.h"
+
+#include <libARNetwork/ARNETWORK_Manager.h>
+#include "ARNETWORK_Manager.h"
+#include <libARNetwork/ARNETWORK_Hub.h>
+
+/*****************************************
+ *
+ *             define :
+ *
+ *****************************************/
+
+#define ARNETWORK_HUB_TAG "ARNETWORK_Hub"
+
+#define ARNETWORK_HUB_MICROSECONDS_PER_SECOND (1000000)
+#define ARNETWORK_HUB_NANOSECONDS_PER_MICROSECOND (1000)
+#define ARNETWORK_HUB_NANOSECONDS_PER_SECOND (1000000000)
+#define ARNETWORK_HUB_MICROSECONDS_PER_MILLISECOND (1000)
+
+/**
+ * data of the epoll event of the notifier stopping the receiving threads
+ */
+#define ARNETWORK_HUB_STOP_EVENT_DATA (UINT64_MAX)
+
+/**
+ * @brief slot of a Manager in the hub
+ */
+typedef struct
+{
+    ARNETWORK_Hub_t *hubPtr; /**< the hub owning the slot */
+    ARNETWORK_Manager_t *managerPtr; /**< the Manager of the slot ; NULL if the slot is free */
+    uint32_t generation; /**< number of the Managers added in the slot ; tells apart the epoll events of a previous Manager */
+    struct timespec dueTime; /**< time of the next processing of the sender */
+    int scheduleIndex; /**< index of the slot in the schedule heap ; -1 if not scheduled */
+    int isSending; /**< 1 if the sender is processed by a sending thread, otherwise 0 */
+    int isWakeUpPending; /**< 1 if new data arrived during the processing of the sender, otherwise 0 */
+    int isRemoving; /**< 1 if the Manager is being removed, otherwise 0 */
+    int receiveFd; /**< file descriptor readable when data are received ; -1 if the reception is not driven by the hub */
+    int isReceiving; /**< 1 if the receiver is processed by a receiving thread, otherwise 0 */
+} ARNETWORK_Hub_Slot_t;
+
+/**
+ * @brief hub driving the senders and the receivers of several Managers
+ */
+struct ARNETWORK_Hub_t
+{
+    ARNETWORK_Hub_Slot_t *slotArray; /**< slots of the Managers */
+    ARNETWORK_Hub_Slot_t **scheduleHeap; /**< min heap of the scheduled slots, by their due time */
+    int maxNumberOfManagers; /**< number of slots */
+    int numberOfScheduled; /**< number of slots in the schedule heap */
+    ARSAL_Mutex_t mutex; /**< mutex protecting the slots and the schedule */
+    ARSAL_Cond_t scheduleCond; /**< condition signaled when the first due time becomes earlier, or when the hub stops */
+    ARSAL_Cond_t idleCond; /**< condition signaled when the processing of a slot being removed ends */
+    int isAlive; /**< Indicator of aliving used for kill the threads calling ARNETWORK_Hub_SendingThreadRun() and ARNETWORK_Hub_ReceivingThreadRun() */
+    int epollFd; /**< epoll instance watching the file descriptors of reception ; -1 if not used */
+    ARNETWORK_Notifier_t *stopNotifier; /**< notifier waking up the receiving threads at the stop ; NULL if not used */
+};
+
+/*****************************************
+ *
+ *             private header:
+ *
+ *****************************************/
+
+/**
+ * @brief check if a time is before another
+ * @param[in] time1 first time
+ * @param[in] time2 second time
+ * @return 1 if time1 is before time2, otherwise 0
+ */
+static inline int ARNETWORK_Hub_IsBefore (const struct timespec *time1, const struct timespec *time2)
+{
+    return (time1->tv_sec < time2->tv_sec) || ((time1->tv_sec == time2->tv_sec) && (time1->tv_nsec < time2->tv_nsec));
+}
+
+/**
+ * @brief add a duration to a time
+ * @param[in,out] time the time to shift
+ * @param[in] timeUs duration in microsecond, positive
+ */
+void ARNETWORK_Hub_AddTimeUs (struct timespec *time, int timeUs);
+
+/**
+ * @brief swap two slots of the schedule heap, keeping their schedule indexes
+ * @warning the mutex of the hub must be locked
+ * @param hubPtr pointer on the hub
+ * @param index1 index of the first slot in the heap
+ * @param index2 index of the second slot in the heap
+ */
+void ARNETWORK_Hub_SwapScheduled (ARNETWORK_Hub_t *hubPtr, int index1, int index2);
+
+/**
+ * @brief restore the order of the schedule heap around a slot whose due time changed
+ * @warning the mutex of the hub must be locked
+ * @param hubPtr pointer on the hub
+ * @param index index of the slot in the heap
+ */
+void ARNETWORK_Hub_Reorder (ARNETWORK_Hub_t *hubPtr, int index);
+
+/**
+ * @brief schedule the processing of the sender of a slot, or reschedule it if already scheduled
+ * @details signals the sending threads if the slot becomes the first to process
+ * @warning the mutex of the hub must be locked
+ * @param hubPtr pointer on the hub
+ * @param slotPtr the slot to schedule
+ * @param[in] dueTime time of the processing
+ */
+void ARNETWORK_Hub_Schedule (ARNETWORK_Hub_t *hubPtr, ARNETWORK_Hub_Slot_t *slotPtr, const struct timespec *dueTime);
+
+/**
+ * @brief remove a slot from the schedule
+ * @warning the mutex of the hub must be locked
+ * @param hubPtr pointer on the hub
+ * @param slotPtr the slot to unschedule
+ */
+void ARNETWORK_Hub_Unschedule (ARNETWORK_Hub_t *hubPtr, ARNETWORK_Hub_Slot_t *slotPtr);
+
+/**
+ * @brief find the slot of a Manager
+ * @warning the mutex of the hub must be locked
+ * @param hubPtr pointer on the hub
+ * @param managerPtr the Manager
+ * @return the slot of the Manager ; NULL if the Manager is not in the hub
+ */
+ARNETWORK_Hub_Slot_t* ARNETWORK_Hub_FindSlot (ARNETWORK_Hub_t *hubPtr, ARNETWORK_Manager_t *managerPtr);
+
+/**
+ * @brief callback of the senders, called when new data are available
+ * @details the sender is processed at once, or again at the end of its current processing
+ * @param customData the slot of the sender
+ */
+void ARNETWORK_Hub_WakeUp (void *customData);
+
+/*****************************************
+ *
+ *             implementation :
+ *
+ *****************************************/
+
+ARNETWORK_Hub_t* ARNETWORK_Hub_New (int maxNumberOfManagers, eARNETWORK_ERROR *error)
+{
+    /** -- Create a new hub -- */
+
+    /** local declarations */
+    eARNETWORK_ERROR localError = ARNETWORK_OK;
+    ARNETWORK_Hub_t *hubPtr = NULL;
+    int slotIndex = 0;
+#ifdef __linux__
+    struct epoll_event event;
+#endif
+
+    /** check parameters */
+    if (maxNumberOfManagers <= 0)
+    {
+        localError = ARNETWORK_ERROR_BAD_PARAMETER;
+    }
+
+    if (localError == ARNETWORK_OK)
+    {
+        hubPtr = malloc (sizeof (ARNETWORK_Hub_t));
+        if (hubPtr != NULL)
+        {
+            hubPtr->maxNumberOfManagers = maxNumberOfManagers;
+            hubPtr->numberOfScheduled = 0;
+            hubPtr->isAlive = 1;
+            hubPtr->epollFd = -1;
+            hubPtr->stopNotifier = NULL;
+            hubPtr->slotArray = calloc (maxNumberOfManagers, sizeof (ARNETWORK_Hub_Slot_t));
+            hubPtr->scheduleHeap = calloc (maxNumberOfManagers, sizeof (ARNETWORK_Hub_Slot_t *));
+            if ((hubPtr->slotArray == NULL) || (hubPtr->scheduleHeap == NULL))
+            {
+                localError = ARNETWORK_ERROR_ALLOC;
+            }
+        }
+        else
+        {
+            localError = ARNETWORK_ERROR_ALLOC;
+        }
+    }
+
+    if (localError == ARNETWORK_OK)
+    {
+        for (slotIndex = 0; slotIndex < maxNumberOfManagers; slotIndex++)
+        {
+            hubPtr->slotArray[slotIndex].hubPtr = hubPtr;
+            hubPtr->slotArray[slotIndex].managerPtr = NULL;
+            hubPtr->slotArray[slotIndex].scheduleIndex = -1;
+            hubPtr->slotArray[slotIndex].receiveFd = -1;
+        }
+    }
+
+    /* Create the mutex/conditions */
+    if ((localError == ARNETWORK_OK) &&
+        (ARSAL_Mutex_Init (&(hubPtr->mutex)) != 0))
+    {
+        localError = ARNETWORK_ERROR_MUTEX;
+    }
+
+    if ((localError == ARNETWORK_OK) &&
+        (ARSAL_Cond_Init (&(hubPtr->scheduleCond)) != 0))
+    {
+        localError = ARNETWORK_ERROR_MUTEX;
+    }
+
+    if ((localError == ARNETWORK_OK) &&
+        (ARSAL_Cond_Init (&(hubPtr->idleCond)) != 0))
+    {
+        localError = ARNETWORK_ERROR_MUTEX;
+    }
+
+#ifdef __linux__
+    /* Create the epoll instance of the receiving threads, watching the stop notifier */
+    if (localError == ARNETWORK_OK)
+    {
+        hubPtr->stopNotifier = ARNETWORK_Notifier_New (&localError);
+    }
+
+    if (localError == ARNETWORK_OK)
+    {
+        hubPtr->epollFd = epoll_create1 (EPOLL_CLOEXEC);
+        event.events = EPOLLIN;
+        event.data.u64 = ARNETWORK_HUB_STOP_EVENT_DATA;
+        if ((hubPtr->epollFd < 0) ||
+            (epoll_ctl (hubPtr->epollFd, EPOLL_CTL_ADD, hubPtr->stopNotifier->readFd, &event) != 0))
+        {
+            localError = ARNETWORK_ERROR;
+        }
+    }
+#endif
+
+    /** delete the hub if an error occurred */
+    if (localError != ARNETWORK_OK)
+    {
+        ARSAL_PRINT (ARSAL_PRINT_ERROR, ARNETWORK_HUB_TAG, "error: %s (errno %d)", ARNETWORK_Error_ToString (localError), errno);
+        ARNETWORK_Hub_Delete (&hubPtr);
+    }
+
+    if (error != NULL)
+    {
+        *error = localError;
+    }
+
+    return hubPtr;
+}
+
+void ARNETWORK_Hub_Delete (ARNETWORK_Hub_t **hubPtrAddr)
+{
+    /** -- Delete the hub -- */
+
+    /** local declarations */
+    ARNETWORK_Hub_t *hubPtr = NULL;
+    int slotIndex = 0;
+
+    if (hubPtrAddr != NULL)
+    {
+        hubPtr = *hubPtrAddr;
+
+        if (hubPtr != NULL)
+        {
+            /** the senders of the Managers still added are given back to their own thread, once their wake-ups in progress are done */
+            if (hubPtr->slotArray != NULL)
+            {
+                for (slotIndex = 0; slotIndex < hubPtr->maxNumberOfManagers; slotIndex++)
+                {
+                    if (hubPtr->slotArray[slotIndex].managerPtr != NULL)
+                    {
+                        ARNETWORK_Sender_SetWakeUpCallback (hubPtr->slotArray[slotIndex].managerPtr->sender, NULL, NULL);
+                    }
+                }
+            }
+
+            if (hubPtr->epollFd >= 0)
+            {
+                close (hubPtr->epollFd);
+            }
+            ARNETWORK_Notifier_Delete (&(hubPtr->stopNotifier));
+            ARSAL_Cond_Destroy (&(hubPtr->idleCond));
+            ARSAL_Cond_Destroy (&(hubPtr->scheduleCond));
+            ARSAL_Mutex_Destroy (&(hubPtr->mutex));
+            free (hubPtr->scheduleHeap);
+            free (hubPtr->slotArray);
+
+            free (hubPtr);
+            hubPtr = NULL;
+        }
+        *hubPtrAddr = NULL;
+    }
+}
+
+eARNETWORK_ERROR ARNETWORK_Hub_AddManager (ARNETWORK_Hub_t *hubPtr, ARNETWORK_Manager_t *managerPtr, int receiveFd)
+{
+    /** -- Add a Manager to the hub -- */
+
+    /** local declarations */
+    eARNETWORK_ERROR error = ARNETWORK_OK;
+    ARNETWORK_Hub_Slot_t *slotPtr = NULL;
+    int slotIndex = 0;
+    struct timespec now;
+#ifdef __linux__
+    struct epoll_event event;
+#endif
+
+    /** check parameters */
+    if ((hubPtr == NULL) || (managerPtr == NULL))
+    {
+        error = ARNETWORK_ERROR_BAD_PARAMETER;
+    }
+
+#ifndef __linux__
+    /** the reception can only be driven through epoll */
+    if (receiveFd >= 0)
+    {
+        error = ARNETWORK_ERROR_BAD_PARAMETER;
+    }
+#endif
+
+    if (error == ARNETWORK_OK)
+    {
+        ARSAL_Mutex_Lock (&(hubPtr->mutex));
+
+        if (ARNETWORK_Hub_FindSlot (hubPtr, managerPtr) != NULL)
+        {
+            error = ARNETWORK_ERROR_BAD_PARAMETER;
+        }
+
+        /** find a free slot, not processed anymore by a thread of the hub */
+        for (slotIndex = 0; (error == ARNETWORK_OK) && (slotPtr == NULL) && (slotIndex < hubPtr->maxNumberOfManagers); slotIndex++)
+        {
+            if ((hubPtr->slotArray[slotIndex].managerPtr == NULL) &&
+                (!hubPtr->slotArray[slotIndex].isSending) &&
+                (!hubPtr->slotArray[slotIndex].isReceiving))
+            {
+                slotPtr = &(hubPtr->slotArray[slotIndex]);
+            }
+        }
+
+        if ((error == ARNETWORK_OK) && (slotPtr == NULL))
+        {
+            error = ARNETWORK_ERROR_BUFFER_SIZE;
+        }
+
+        if (error == ARNETWORK_OK)
+        {
+            slotPtr->managerPtr = managerPtr;
+            slotPtr->generation++;
+            slotPtr->isWakeUpPending = 0;
+            slotPtr->isRemoving = 0;
+            slotPtr->receiveFd = receiveFd;
+
+#ifdef __linux__
+            /** the receiver is armed for one event at once: a single thread processes it */
+            if (receiveFd >= 0)
+            {
+                event.events = EPOLLIN | EPOLLONESHOT;
+                event.data.u64 = (((uint64_t) slotPtr->generation) << 32) | (uint64_t) (slotPtr - hubPtr->slotArray);
+                if (epoll_ctl (hubPtr->epollFd, EPOLL_CTL_ADD, receiveFd, &event) != 0)
+                {
+                    ARSAL_PRINT (ARSAL_PRINT_ERROR, ARNETWORK_HUB_TAG, "file descriptor %d not watched, errno %d", receiveFd, errno);
+                    error = ARNETWORK_ERROR_BAD_PARAMETER;
+                }
+            }
+#endif
+        }
+
+        if (error == ARNETWORK_OK)
+        {
+            /** the sender is processed at once, then when new data are available or at its next due time */
+            ARSAL_Time_GetTime (&now);
+            slotPtr->managerPtr->sender->lastProcessTime = now;
+            ARNETWORK_Hub_Schedule (hubPtr, slotPtr, &now);
+        }
+        else if (slotPtr != NULL)
+        {
+            slotPtr->managerPtr = NULL;
+            slotPtr->receiveFd = -1;
+        }
+
+        ARSAL_Mutex_Unlock (&(hubPtr->mutex));
+    }
+
+    /** the wake-up callback takes the mutex of the hub under the lock of the callback: it is set out of the mutex of the hub */
+    if (error == ARNETWORK_OK)
+    {
+        ARNETWORK_Sender_SetWakeUpCallback (managerPtr->sender, ARNETWORK_Hub_WakeUp, slotPtr);
+    }
+
+    return error;
+}
+
+eARNETWORK_ERROR ARNETWORK_Hub_RemoveManager (ARNETWORK_Hub_t *hubPtr, ARNETWORK_Manager_t *managerPtr)
+{
+    /** -- Remove a Manager from the hub -- */
+
+    /** local declarations */
+    eARNETWORK_ERROR error = ARNETWORK_OK;
+    ARNETWORK_Hub_Slot_t *slotPtr = NULL;
+
+    /** check parameters */
+    if ((hubPtr == NULL) || (managerPtr == NULL))
+    {
+        error = ARNETWORK_ERROR_BAD_PARAMETER;
+    }
+
+    if (error == ARNETWORK_OK)
+    {
+        ARSAL_Mutex_Lock (&(hubPtr->mutex));
+
+        slotPtr = ARNETWORK_Hub_FindSlot (hubPtr, managerPtr);
+        if ((slotPtr == NULL) || (slotPtr->isRemoving))
+        {
+            error = ARNETWORK_ERROR_BAD_PARAMETER;
+        }
+
+        if (error == ARNETWORK_OK)
+        {
+            /** the slot being removed is not scheduled anymore, even by the wake-ups in progress */
+            slotPtr->isRemoving = 1;
+            ARNETWORK_Hub_Unschedule (hubPtr, slotPtr);
+
+#ifdef __linux__
+            if (slotPtr->receiveFd >= 0)
+            {
+                epoll_ctl (hubPtr->epollFd, EPOLL_CTL_DEL, slotPtr->receiveFd, NULL);
+            }
+#endif
+        }
+
+        ARSAL_Mutex_Unlock (&(hubPtr->mutex));
+    }
+
+    if (error == ARNETWORK_OK)
+    {
+        /** the sender signals its own thread again, once its wake-ups in progress, which take the mutex of the hub, are done */
+        ARNETWORK_Sender_SetWakeUpCallback (managerPtr->sender, NULL, NULL);
+
+        ARSAL_Mutex_Lock (&(hubPtr->mutex));
+
+        /** wait the end of the processing of the Manager */
+        while ((slotPtr->isSending) || (slotPtr->isReceiving))
+        {
+            ARSAL_Cond_Wait (&(hubPtr->idleCond), &(hubPtr->mutex));
+        }
+
+        slotPtr->managerPtr = NULL;
+        slotPtr->receiveFd = -1;
+        slotPtr->isRemoving = 0;
+
+        ARSAL_Mutex_Unlock (&(hubPtr->mutex));
+    }
+
+    return error;
+}
+
+void* ARNETWORK_Hub_SendingThreadRun (void *data)
+{
+    /** -- Manage the sending of the data of the Managers of the hub -- */
+
+    /** local declarations */
+    ARNETWORK_Hub_t *hubPtr = data;
+    ARNETWORK_Hub_Slot_t *slotPtr = NULL;
+    struct timespec now;
+    int waitTimeUs = 0;
+
+    if (hubPtr == NULL)
+    {
+        ARSAL_PRINT (ARSAL_PRINT_ERROR, ARNETWORK_HUB_TAG, "error: %s", ARNETWORK_Error_ToString (ARNETWORK_ERROR_BAD_PARAMETER));
+    }
+    else
+    {
+        ARSAL_Mutex_Lock (&(hubPtr->mutex));
+
+        while (hubPtr->isAlive)
+        {
+            slotPtr = NULL;
+            waitTimeUs = 0;
+
+            /** take the first sender of the schedule if it is due */
+            if (hubPtr->numberOfScheduled > 0)
+            {
+                ARSAL_Time_GetTime (&now);
+                if (ARNETWORK_Hub_IsBefore (&now, &(hubPtr->scheduleHeap[0]->dueTime)))
+                {
+                    waitTimeUs = (hubPtr->scheduleHeap[0]->dueTime.tv_sec - now.tv_sec) * ARNETWORK_HUB_MICROSECONDS_PER_SECOND + (hubPtr->scheduleHeap[0]->dueTime.tv_nsec - now.tv_nsec) / ARNETWORK_HUB_NANOSECONDS_PER_MICROSECOND;
+                }
+                else
+                {
+                    slotPtr = hubPtr->scheduleHeap[0];
+                    ARNETWORK_Hub_Unschedule (hubPtr, slotPtr);
+                    slotPtr->isSending = 1;
+                    slotPtr->isWakeUpPending = 0;
+
+                    /** another thread can take the next sender */
+                    if (hubPtr->numberOfScheduled > 0)
+                    {
+                        ARSAL_Cond_Signal (&(hubPtr->scheduleCond));
+                    }
+                }
+            }
+
+            if (slotPtr != NULL)
+            {
+                /** process the sender out of the lock of the hub */
+                ARSAL_Mutex_Unlock (&(hubPtr->mutex));
+                ARNETWORK_Sender_Process (slotPtr->managerPtr->sender);
+                waitTimeUs = ARNETWORK_Sender_GetWaitTimeUs (slotPtr->managerPtr->sender);
+                ARSAL_Mutex_Lock (&(hubPtr->mutex));
+
+                slotPtr->isSending = 0;
+                if (slotPtr->isRemoving)
+                {
+                    ARSAL_Cond_Broadcast (&(hubPtr->idleCond));
+                }
+                else
+                {
+                    ARSAL_Time_GetTime (&now);
+                    if (!slotPtr->isWakeUpPending)
+                    {
+                        ARNETWORK_Hub_AddTimeUs (&now, waitTimeUs);
+                    }
+                    ARNETWORK_Hub_Schedule (hubPtr, slotPtr, &now);
+                }
+            }
+            else if (hubPtr->numberOfScheduled > 0)
+            {
+                /** the condition has a millisecond resolution: the shorter waits are rounded up */
+                ARSAL_Cond_Timedwait (&(hubPtr->scheduleCond), &(hubPtr->mutex), (waitTimeUs + ARNETWORK_HUB_MICROSECONDS_PER_MILLISECOND - 1) / ARNETWORK_HUB_MICROSECONDS_PER_MILLISECOND);
+            }
+            else
+            {
+                ARSAL_Cond_Wait (&(hubPtr->scheduleCond), &(hubPtr->mutex));
+            }
+        }
+
+        ARSAL_Mutex_Unlock (&(hubPtr->mutex));
+    }
+
+    return NULL;
+}
+
+void* ARNETWORK_Hub_ReceivingThreadRun (void *data)
+{
+    /** -- Manage the reception of the data of the Managers of the hub -- */
+
+    /** local declarations */
+    ARNETWORK_Hub_t *hubPtr = data;
+#ifdef __linux__
+    ARNETWORK_Hub_Slot_t *slotPtr = NULL;
+    struct epoll_event event;
+    int slotIndex = 0;
+    uint32_t generation = 0;
+#endif
+
+    if (hubPtr == NULL)
+    {
+        ARSAL_PRINT (ARSAL_PRINT_ERROR, ARNETWORK_HUB_TAG, "error: %s", ARNETWORK_Error_ToString (ARNETWORK_ERROR_BAD_PARAMETER));
+    }
+#ifdef __linux__
+    else
+    {
+        while (hubPtr->isAlive)
+        {
+            /** the stop notifier stays readable: it wakes up all the threads */
+            if ((epoll_wait (hubPtr->epollFd, &event, 1, -1) == 1) &&
+                (event.data.u64 != ARNETWORK_HUB_STOP_EVENT_DATA))
+            {
+                slotPtr = NULL;
+                slotIndex = (int) (event.data.u64 & UINT32_MAX);
+                generation = (uint32_t) (event.data.u64 >> 32);
+
+                /** the event can be the one of a Manager removed meanwhile */
+                ARSAL_Mutex_Lock (&(hubPtr->mutex));
+                if ((hubPtr->slotArray[slotIndex].managerPtr != NULL) &&
+                    (hubPtr->slotArray[slotIndex].generation == generation) &&
+                    (!hubPtr->slotArray[slotIndex].isRemoving))
+                {
+                    slotPtr = &(hubPtr->slotArray[slotIndex]);
+                    slotPtr->isReceiving = 1;
+                }
+                ARSAL_Mutex_Unlock (&(hubPtr->mutex));
+
+                if (slotPtr != NULL)
+                {
+                    ARNETWORK_Receiver_Process (slotPtr->managerPtr->receiver);
+
+                    ARSAL_Mutex_Lock (&(hubPtr->mutex));
+                    slotPtr->isReceiving = 0;
+                    if (slotPtr->isRemoving)
+                    {
+                        ARSAL_Cond_Broadcast (&(hubPtr->idleCond));
+                    }
+                    else
+                    {
+                        /** arm the receiver for its next event */
+                        event.events = EPOLLIN | EPOLLONESHOT;
+                        epoll_ctl (hubPtr->epollFd, EPOLL_CTL_MOD, slotPtr->receiveFd, &event);
+                    }
+                    ARSAL_Mutex_Unlock (&(hubPtr->mutex));
+                }
+            }
+        }
+    }
+#endif
+
+    return NULL;
+}
+
+void ARNETWORK_Hub_Stop (ARNETWORK_Hub_t *hubPtr)
+{
+    /** -- stop the threads of sending and reception of the hub -- */
+
+    /** check parameters */
+    if (hubPtr != NULL)
+    {
+        ARSAL_Mutex_Lock (&(hubPtr->mutex));
+        hubPtr->isAlive = 0;
+        ARSAL_Cond_Broadcast (&(hubPtr->scheduleCond));
+        ARSAL_Mutex_Unlock (&(hubPtr->mutex));
+
+        if (hubPtr->stopNotifier != NULL)
+        {
+            ARNETWORK_Notifier_Signal (hubPtr->stopNotifier);
+        }
+    }
+}
+
+/*****************************************
+ *
+ *             private implementation:
+ *
+ *****************************************/
+
+void ARNETWORK_Hub_AddTimeUs (struct timespec *time, int timeUs)
+{
+    time->tv_sec += timeUs / ARNETWORK_HUB_MICROSECONDS_PER_SECOND;
+    time->tv_nsec += (timeUs % ARNETWORK_HUB_MICROSECONDS_PER_SECOND) * ARNETWORK_HUB_NANOSECONDS_PER_MICROSECOND;
+    if (time->tv_nsec >= ARNETWORK_HUB_NANOSECONDS_PER_SECOND)
+    {
+        time->tv_sec++;
+        time->tv_nsec -= ARNETWORK_HUB_NANOSECONDS_PER_SECOND;
+    }
+}
+
+void ARNETWORK_Hub_SwapScheduled (ARNETWORK_Hub_t *hubPtr, int index1, int index2)
+{
+    /** local declarations */
+    ARNETWORK_Hub_Slot_t *slotPtr = hubPtr->scheduleHeap[index1];
+
+    hubPtr->scheduleHeap[index1] = hubPtr->scheduleHeap[index2];
+    hubPtr->scheduleHeap[index2] = slotPtr;
+    hubPtr->scheduleHeap[index1]->scheduleIndex = index1;
+    hubPtr->scheduleHeap[index2]->scheduleIndex = index2;
+}
+
+void ARNETWORK_Hub_Reorder (ARNETWORK_Hub_t *hubPtr, int index)
+{
+    /** local declarations */
+    int parentIndex = 0;
+    int childIndex = 0;
+    int isOrdered = 0;
+
+    /** move the slot up while it is due before its parent */
+    while ((index > 0) && (!isOrdered))
+    {
+        parentIndex = (index - 1) / 2;
+        if (ARNETWORK_Hub_IsBefore (&(hubPtr->scheduleHeap[index]->dueTime), &(hubPtr->scheduleHeap[parentIndex]->dueTime)))
+        {
+            ARNETWORK_Hub_SwapScheduled (hubPtr, index, parentIndex);
+            index = parentIndex;
+        }
+        else
+        {
+            isOrdered = 1;
+        }
+    }
+
+    /** move the slot down while one of its children is due before it */
+    isOrdered = 0;
+    while (!isOrdered)
+    {
+        childIndex = (2 * index) + 1;
+        if ((childIndex + 1 < hubPtr->numberOfScheduled) &&
+            (ARNETWORK_Hub_IsBefore (&(hubPtr->scheduleHeap[childIndex + 1]->dueTime), &(hubPtr->scheduleHeap[childIndex]->dueTime))))
+        {
+            childIndex++;
+        }
+
+        if ((childIndex < hubPtr->numberOfScheduled) &&
+            (ARNETWORK_Hub_IsBefore (&(hubPtr->scheduleHeap[childIndex]->dueTime), &(hubPtr->scheduleHeap[index]->dueTime))))
+        {
+            ARNETWORK_Hub_SwapScheduled (hubPtr, index, childIndex);
+            index = childIndex;
+        }
+        else
+        {
+            isOrdered = 1;
+        }
+    }
+}
+
+void ARNETWORK_Hub_Schedule (ARNETWORK_Hub_t *hubPtr, ARNETWORK_Hub_Slot_t *slotPtr, const struct timespec *dueTime)
+{
+    if (slotPtr->scheduleIndex < 0)
+    {
+        slotPtr->scheduleIndex = hubPtr->numberOfScheduled;
+        hubPtr->scheduleHeap[hubPtr->numberOfScheduled] = slotPtr;
+        hubPtr->numberOfScheduled++;
+    }
+    slotPtr->dueTime = *dueTime;
+    ARNETWORK_Hub_Reorder (hubPtr, slotPtr->scheduleIndex);
+
+    /** the waiting sending threads must wait less */
+    if (slotPtr->scheduleIndex == 0)
+    {
+        ARSAL_Cond_Signal (&(hubPtr->scheduleCond));
+    }
+}
+
+void ARNETWORK_Hub_Unschedule (ARNETWORK_Hub_t *hubPtr, ARNETWORK_Hub_Slot_t *slotPtr)
+{
+    /** local declarations */
+    int index = slotPtr->scheduleIndex;
+
+    if (index >= 0)
+    {
+        /** the last slot of the heap takes the place of the removed one */
+        hubPtr->numberOfScheduled--;
+        if (index != hubPtr->numberOfScheduled)
+        {
+            ARNETWORK_Hub_SwapScheduled (hubPtr, index, hubPtr->numberOfScheduled);
+            ARNETWORK_Hub_Reorder (hubPtr, index);
+        }
+        hubPtr->scheduleHeap[hubPtr->numberOfScheduled] = NULL;
+        slotPtr->scheduleIndex = -1;
+    }
+}
+
+ARNETWORK_Hub_Slot_t* ARNETWORK_Hub_FindSlot (ARNETWORK_Hub_t *hubPtr, ARNETWORK_Manager_t *managerPtr)
+{
+    /** local declarations */
+    ARNETWORK_Hub_Slot_t *slotPtr = NULL;
+    int slotIndex = 0;
+
+    for (slotIndex = 0; (slotPtr == NULL) && (slotIndex < hubPtr->maxNumberOfManagers); slotIndex++)
+    {
+        if (hubPtr->slotArray[slotIndex].managerPtr == managerPtr)
+        {
+            slotPtr = &(hubPtr->slotArray[slotIndex]);
+        }
+    }
+
+    return slotPtr;
+}
+
+void ARNETWORK_Hub_WakeUp (void *customData)
+{
+    /** local declarations */
+    ARNETWORK_Hub_Slot_t *slotPtr = customData;
+    ARNETWORK_Hub_t *hubPtr = slotPtr->hubPtr;
+    struct timespec now;
+
+    ARSAL_Mutex_Lock (&(hubPtr->mutex));
+    if (slotPtr->isSending)
+    {
+        /** the sender is rescheduled at once at the end of its processing */
+        slotPtr->isWakeUpPending = 1;
+    }
+    else if (slotPtr->scheduleIndex >= 0)
+    {
+        ARSAL_Time_GetTime (&now);
+        if (ARNETWORK_Hub_IsBefore (&now, &(slotPtr->dueTime)))
+        {
+            ARNETWORK_Hub_Schedule (hubPtr, slotPtr, &now);
+        }
+    }
+    ARSAL_Mutex_Unlock (&(hubPtr->mutex));
+}
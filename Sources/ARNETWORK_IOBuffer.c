@@ -70,9 +70,10 @@
  * @brief free the data pointed by the data descriptor
  * @param IOBuffer The IOBuffer
  * @param dataDescriptor The data descriptor of the data to free
+ * @param[in] isNewest 1 if the data popped is the newest data of the IOBuffer, 0 if it is the oldest
  * @return error equal to ARNETWORK_OK if the data are correctly deleted otherwise see eARNETWORK_ERROR
  **/
-static inline eARNETWORK_ERROR ARNETWORK_IOBuffer_FreeData(ARNETWORK_IOBuffer_t *IOBuffer, ARNETWORK_DataDescriptor_t *dataDescriptor)
+static inline eARNETWORK_ERROR ARNETWORK_IOBuffer_FreeData(ARNETWORK_IOBuffer_t *IOBuffer, ARNETWORK_DataDescriptor_t *dataDescriptor, int isNewest)
 {
     /** -- free the last data of the IOBuffer -- */
 
@@ -82,29 +83,48 @@ static inline eARNETWORK_ERROR ARNETWORK_IOBuffer_FreeData(ARNETWORK_IOBuffer_t
     if(dataDescriptor->isUsingDataCopy)
     {
         /** if the data has been copied in the dataCopyRBuffer */
-        /** pop data copy*/
-        error = ARNETWORK_RingBuffer_PopFrontWithSize(IOBuffer->dataCopyRBuffer, NULL, dataDescriptor->dataSize);
+        /** pop data copy, at the same end of the ring buffers as its data descriptor */
+        if(isNewest)
+        {
+            error = ARNETWORK_RingBuffer_PopBack(IOBuffer->dataCopyRBuffer, NULL);
+        }
+        else
+        {
+            error = ARNETWORK_RingBuffer_PopFrontWithSize(IOBuffer->dataCopyRBuffer, NULL, dataDescriptor->dataSize);
+        }
     }
     else
     {
         /** if the data is store out of the ARNetwork */
         /** callback with free status */
-        if(dataDescriptor->callback != NULL)
-        {
-            dataDescriptor->callback(IOBuffer->ID, dataDescriptor->data, dataDescriptor->customData, ARNETWORK_MANAGER_CALLBACK_STATUS_FREE);
-        }
+        ARNETWORK_IOBuffer_CallBack(IOBuffer, dataDescriptor, dataDescriptor->data, ARNETWORK_MANAGER_CALLBACK_STATUS_FREE);
     }
     
     /** callback with done status */
     /** the date will not more used */
-    if(dataDescriptor->callback != NULL)
+    ARNETWORK_IOBuffer_CallBack(IOBuffer, dataDescriptor, NULL, ARNETWORK_MANAGER_CALLBACK_STATUS_DONE);
+
+    /** wake up one producer waiting the cell freed */
+    if(IOBuffer->numberOfFreeCellWaiters > 0)
     {
-        dataDescriptor->callback(IOBuffer->ID, NULL, dataDescriptor->customData, ARNETWORK_MANAGER_CALLBACK_STATUS_DONE);
+        ARSAL_Cond_Signal(&(IOBuffer->freeCellCond));
     }
     
     return error;
 }
 
+/**
+ * @brief get the maximum number of fragments of a message reassembled by an output buffer
+ * @param[in] dataCopyMaxSize maximum size of a message
+ * @return one message at most, of dataCopyMaxSize bytes, in fragments of ARNETWORK_IOBUFFER_FRAGMENT_SIZE_MIN bytes at least
+ **/
+static inline int ARNETWORK_IOBuffer_GetReassemblyMaxNumberOfFragments(int dataCopyMaxSize)
+{
+    int numberOfFragments = (dataCopyMaxSize + ARNETWORK_IOBUFFER_FRAGMENT_SIZE_MIN - 1) / ARNETWORK_IOBUFFER_FRAGMENT_SIZE_MIN;
+
+    return (numberOfFragments > ARNETWORK_IOBUFFER_FRAGMENT_NUMBER_MAX) ? ARNETWORK_IOBUFFER_FRAGMENT_NUMBER_MAX : numberOfFragments;
+}
+
 /*****************************************
  *
  *             implementation :
@@ -114,29 +134,54 @@ static inline eARNETWORK_ERROR ARNETWORK_IOBuffer_FreeData(ARNETWORK_IOBuffer_t
 ARNETWORK_IOBuffer_t* ARNETWORK_IOBuffer_New(const ARNETWORK_IOBufferParam_t *param, int isInternal)
 {
     /** -- Create a new input or output buffer -- */
+    return ARNETWORK_IOBuffer_NewInArena(param, isInternal, NULL);
+}
+
+ARNETWORK_IOBuffer_t* ARNETWORK_IOBuffer_NewInArena(const ARNETWORK_IOBufferParam_t *param, int isInternal, ARNETWORK_Arena_t *arenaPtr)
+{
+    /** -- Create a new input or output buffer in an arena -- */
 
     /** local declarations */
     ARNETWORK_IOBuffer_t *IOBuffer = NULL;
     eARNETWORK_ERROR error = ARNETWORK_OK;
 
     /** Create the input or output buffer in accordance with parameters set in the ARNETWORK_IOBufferParam_t */
-    IOBuffer = malloc( sizeof(ARNETWORK_IOBuffer_t) );
+    IOBuffer = ARNETWORK_Arena_Malloc( arenaPtr, sizeof(ARNETWORK_IOBuffer_t) );
 
     if(IOBuffer != NULL)
     {
         /** Initialize to default values */
+        IOBuffer->arenaPtr = arenaPtr;
         IOBuffer->dataDescriptorRBuffer = NULL;
         IOBuffer->dataCopyRBuffer = NULL;
+        IOBuffer->fragmentSeqArr = NULL;
+        IOBuffer->reassemblyData = NULL;
+        IOBuffer->reassemblyBitmap = NULL;
         ARSAL_Mutex_Init(&(IOBuffer->mutex));
         ARSAL_Sem_Init(&(IOBuffer->outputSem), 0, 0);
+        ARSAL_Cond_Init(&(IOBuffer->freeCellCond));
+        IOBuffer->numberOfFreeCellWaiters = 0;
+        IOBuffer->isRemoved = 0;
+        IOBuffer->numberOfUsers = 1;
 
         if((isInternal == 1) ||
            (ARNETWORK_IOBufferParam_Check(param)))
         {
             IOBuffer->ID = param->ID;
             IOBuffer->dataType = param->dataType;
-            IOBuffer->sendingWaitTimeMs = param->sendingWaitTimeMs;
-            IOBuffer->ackTimeoutMs = param->ackTimeoutMs;
+            /** the times in microsecond not set (0 or -1) are given in millisecond */
+            IOBuffer->sendingWaitTimeUs = (param->sendingWaitTimeUs > 0) ? param->sendingWaitTimeUs : param->sendingWaitTimeMs * ARNETWORK_IOBUFFER_MICROSECONDS_PER_MILLISECOND;
+            if (param->ackTimeoutUs > 0)
+            {
+                IOBuffer->ackTimeoutUs = param->ackTimeoutUs;
+            }
+            else
+            {
+                IOBuffer->ackTimeoutUs = (param->ackTimeoutMs >= 0) ? param->ackTimeoutMs * ARNETWORK_IOBUFFER_MICROSECONDS_PER_MILLISECOND : -1;
+            }
+            /** a burst size not set (0) sends one data per pass */
+            IOBuffer->sendingBurstSize = (param->sendingBurstSize > 1) ? param->sendingBurstSize : 1;
+            IOBuffer->isAggregating = (param->isAggregating == 1) ? 1 : 0;
 
             if(param->numberOfRetry >= 0)
             {
@@ -153,22 +198,74 @@ ARNETWORK_IOBuffer_t* ARNETWORK_IOBuffer_New(const ARNETWORK_IOBufferParam_t *pa
             IOBuffer->alreadyHadData = 0;
             IOBuffer->nbPackets = 0;
             IOBuffer->nbNetwork = 0;
-            IOBuffer->waitTimeCount = param->sendingWaitTimeMs;
-            IOBuffer->ackWaitTimeCount = param->ackTimeoutMs;
+            ARNETWORK_LinkQuality_Init (&(IOBuffer->linkQuality));
+            IOBuffer->waitTimeCount = IOBuffer->sendingWaitTimeUs;
+            IOBuffer->ackWaitTimeCount = IOBuffer->ackTimeoutUs;
             IOBuffer->retryCount = 0;
+            IOBuffer->isRetried = 0;
+            IOBuffer->numberOfDataInFrame = 1;
+            IOBuffer->outputCallback = NULL;
+            IOBuffer->outputCallbackCustomData = NULL;
+            IOBuffer->isBorrowed = 0;
+            IOBuffer->isImmediateAck = 0;
+            IOBuffer->numberOfDroppedNewest = 0;
+            IOBuffer->numberOfDroppedOldest = 0;
+            IOBuffer->numberOfConflated = 0;
+            IOBuffer->numberOfAcksWithheld = 0;
+            IOBuffer->consumerLagCallback = NULL;
+            IOBuffer->consumerLagCustomData = NULL;
+            IOBuffer->consumerLagThreshold = 0;
+            IOBuffer->isConsumerLagReported = 0;
+            IOBuffer->completionQueuePtr = NULL;
+            IOBuffer->timeoutPolicy = ARNETWORK_MANAGER_CALLBACK_RETURN_DATA_POP;
+
+            /** the default overflow policy keeps the behavior of the overwriting */
+            IOBuffer->overflowPolicy = param->overflowPolicy;
+            if (IOBuffer->overflowPolicy == ARNETWORK_IOBUFFERPARAM_OVERFLOW_POLICY_DEFAULT)
+            {
+                IOBuffer->overflowPolicy = (param->isOverwriting == 1) ? ARNETWORK_IOBUFFERPARAM_OVERFLOW_POLICY_DROP_OLDEST : ARNETWORK_IOBUFFERPARAM_OVERFLOW_POLICY_DROP_NEWEST;
+            }
+            IOBuffer->isCreditFlowControlled = (param->isCreditFlowControlled == 1) ? 1 : 0;
+            IOBuffer->credits = -1;
+            IOBuffer->creditProbeTimeCount = ARNETWORK_IOBUFFER_CREDIT_PROBE_TIME_US;
+            IOBuffer->advertisedCredits = -1;
+            IOBuffer->isFragmenting = (param->isFragmenting == 1) ? 1 : 0;
+            IOBuffer->messageNumber = 0;
+            IOBuffer->numberOfFragments = 0;
+            IOBuffer->nextFragmentIndex = 0;
+            IOBuffer->firstUnackedFragmentIndex = 0;
+            IOBuffer->reassemblyMaxNumberOfFragments = 0;
+            IOBuffer->reassemblyMessageNumber = -1;
+            IOBuffer->reassemblyNumberOfFragments = 0;
+            IOBuffer->reassemblyNumberOfReceived = 0;
+            IOBuffer->reassemblySize = 0;
+            IOBuffer->lastReassembledMessageNumber = -1;
+
+            /** the fragments of a message are sent in a window of sendingBurstSize fragments */
+            if (IOBuffer->isFragmenting)
+            {
+                IOBuffer->fragmentSeqArr = ARNETWORK_Arena_Malloc (IOBuffer->arenaPtr, IOBuffer->sendingBurstSize * sizeof (int));
+                if (IOBuffer->fragmentSeqArr == NULL)
+                {
+                    error = ARNETWORK_ERROR_ALLOC;
+                }
+            }
 
             /** Create the RingBuffer for the information of the data*/
-            IOBuffer->dataDescriptorRBuffer = ARNETWORK_RingBuffer_NewWithOverwriting(param->numberOfCell, sizeof(ARNETWORK_DataDescriptor_t), param->isOverwriting);
-            if(IOBuffer->dataDescriptorRBuffer == NULL)
+            if (error == ARNETWORK_OK)
             {
-                error = ARNETWORK_ERROR_NEW_RINGBUFFER;
+                IOBuffer->dataDescriptorRBuffer = ARNETWORK_RingBuffer_NewInArena(IOBuffer->arenaPtr, param->numberOfCell, sizeof(ARNETWORK_DataDescriptor_t), param->isOverwriting);
+                if(IOBuffer->dataDescriptorRBuffer == NULL)
+                {
+                    error = ARNETWORK_ERROR_NEW_RINGBUFFER;
+                }
             }
 
             /** if the parameters have a size of data copy */
             if( (error == ARNETWORK_OK) && (param->dataCopyMaxSize > 0) )
             {
                 /** Create the RingBuffer for the copy of the data*/
-                IOBuffer->dataCopyRBuffer = ARNETWORK_RingBuffer_NewWithOverwriting(param->numberOfCell, param->dataCopyMaxSize, param->isOverwriting);
+                IOBuffer->dataCopyRBuffer = ARNETWORK_RingBuffer_NewInArena(IOBuffer->arenaPtr, param->numberOfCell, param->dataCopyMaxSize, param->isOverwriting);
                 if(IOBuffer->dataCopyRBuffer == NULL)
                 {
                     error = ARNETWORK_ERROR_NEW_BUFFER;
@@ -191,6 +288,65 @@ ARNETWORK_IOBuffer_t* ARNETWORK_IOBuffer_New(const ARNETWORK_IOBufferParam_t *pa
     return IOBuffer;
 }
 
+size_t ARNETWORK_IOBuffer_GetArenaSize(const ARNETWORK_IOBufferParam_t *param, int isReassembling)
+{
+    /** -- Get the size taken in an arena by an input or output buffer -- */
+
+    /** local declarations */
+    size_t size = ARNETWORK_Arena_GetAllocationSize(sizeof(ARNETWORK_IOBuffer_t));
+    int sendingBurstSize = (param->sendingBurstSize > 1) ? param->sendingBurstSize : 1;
+
+    /** same allocations as ARNETWORK_IOBuffer_NewInArena() and ARNETWORK_IOBuffer_NewReassembly() */
+    if (param->isFragmenting == 1)
+    {
+        size += ARNETWORK_Arena_GetAllocationSize(sendingBurstSize * sizeof(int));
+    }
+
+    size += ARNETWORK_RingBuffer_GetArenaSize(param->numberOfCell, sizeof(ARNETWORK_DataDescriptor_t));
+
+    if (param->dataCopyMaxSize > 0)
+    {
+        size += ARNETWORK_RingBuffer_GetArenaSize(param->numberOfCell, param->dataCopyMaxSize);
+
+        if (isReassembling)
+        {
+            size += ARNETWORK_Arena_GetAllocationSize(param->dataCopyMaxSize);
+            size += ARNETWORK_Arena_GetAllocationSize((ARNETWORK_IOBuffer_GetReassemblyMaxNumberOfFragments(param->dataCopyMaxSize) + 7) / 8);
+        }
+    }
+
+    return size;
+}
+
+size_t ARNETWORK_IOBuffer_GetParamMemoryFootprint(const ARNETWORK_IOBufferParam_t *param, int isReassembling)
+{
+    /** -- Get the memory that the creation of an input or output buffer will allocate -- */
+
+    /** local declarations */
+    size_t size = sizeof(ARNETWORK_IOBuffer_t);
+    int sendingBurstSize = (param->sendingBurstSize > 1) ? param->sendingBurstSize : 1;
+
+    /** same sum as ARNETWORK_IOBuffer_GetMemoryFootprint() */
+    if (param->isFragmenting == 1)
+    {
+        size += sendingBurstSize * sizeof(int);
+    }
+
+    size += sizeof(ARNETWORK_RingBuffer_t) + ((size_t) param->numberOfCell * sizeof(ARNETWORK_DataDescriptor_t));
+
+    if (param->dataCopyMaxSize > 0)
+    {
+        size += sizeof(ARNETWORK_RingBuffer_t) + ((size_t) param->numberOfCell * param->dataCopyMaxSize);
+
+        if (isReassembling)
+        {
+            size += param->dataCopyMaxSize + ((ARNETWORK_IOBuffer_GetReassemblyMaxNumberOfFragments(param->dataCopyMaxSize) + 7) / 8);
+        }
+    }
+
+    return size;
+}
+
 void ARNETWORK_IOBuffer_Delete(ARNETWORK_IOBuffer_t **IOBuffer)
 {
     /** -- Delete the input or output buffer -- */
@@ -205,11 +361,16 @@ void ARNETWORK_IOBuffer_Delete(ARNETWORK_IOBuffer_t **IOBuffer)
             ARSAL_Sem_Destroy(&((*IOBuffer)->outputSem));
 
             ARNETWORK_IOBuffer_CancelAllData((*IOBuffer));
+            ARSAL_Cond_Destroy(&((*IOBuffer)->freeCellCond));
 
             ARNETWORK_RingBuffer_Delete(&((*IOBuffer)->dataDescriptorRBuffer));
             ARNETWORK_RingBuffer_Delete(&((*IOBuffer)->dataCopyRBuffer));
 
-            free((*IOBuffer));
+            ARNETWORK_Arena_Free((*IOBuffer)->arenaPtr, (*IOBuffer)->fragmentSeqArr);
+            ARNETWORK_Arena_Free((*IOBuffer)->arenaPtr, (*IOBuffer)->reassemblyData);
+            ARNETWORK_Arena_Free((*IOBuffer)->arenaPtr, (*IOBuffer)->reassemblyBitmap);
+
+            ARNETWORK_Arena_Free((*IOBuffer)->arenaPtr, (*IOBuffer));
             (*IOBuffer) = NULL;
         }
     }
@@ -222,11 +383,55 @@ eARNETWORK_ERROR ARNETWORK_IOBuffer_AckReceived(ARNETWORK_IOBuffer_t *IOBuffer,
     /** local declarations */
     eARNETWORK_ERROR error = ARNETWORK_OK;
 
+    int dataIndex = 0;
+    int fragmentIndex = 0;
+
+    if (IOBuffer->isFragmenting)
+    {
+        /** acknowledge the fragment of the sequence number received */
+        error = ARNETWORK_ERROR_IOBUFFER_BAD_ACK;
+        for (fragmentIndex = IOBuffer->firstUnackedFragmentIndex; fragmentIndex < IOBuffer->nextFragmentIndex; fragmentIndex++)
+        {
+            if (IOBuffer->fragmentSeqArr[fragmentIndex % IOBuffer->sendingBurstSize] == seqNumber)
+            {
+                IOBuffer->fragmentSeqArr[fragmentIndex % IOBuffer->sendingBurstSize] = -1;
+                error = ARNETWORK_OK;
+            }
+        }
+
+        if (error == ARNETWORK_OK)
+        {
+            /** slide the window over the fragments acknowledged ; a progress restarts the timeout and the retries */
+            if (IOBuffer->fragmentSeqArr[IOBuffer->firstUnackedFragmentIndex % IOBuffer->sendingBurstSize] < 0)
+            {
+                IOBuffer->ackWaitTimeCount = IOBuffer->ackTimeoutUs;
+                IOBuffer->retryCount = IOBuffer->numberOfRetry;
+            }
+            while ((IOBuffer->firstUnackedFragmentIndex < IOBuffer->nextFragmentIndex) &&
+                   (IOBuffer->fragmentSeqArr[IOBuffer->firstUnackedFragmentIndex % IOBuffer->sendingBurstSize] < 0))
+            {
+                IOBuffer->firstUnackedFragmentIndex++;
+            }
+            IOBuffer->isWaitAck = (IOBuffer->firstUnackedFragmentIndex < IOBuffer->nextFragmentIndex) ? 1 : 0;
+
+            /** the message is acknowledged as a whole once all its fragments are acknowledged */
+            if (IOBuffer->firstUnackedFragmentIndex == IOBuffer->numberOfFragments)
+            {
+                IOBuffer->numberOfFragments = 0;
+                error = ARNETWORK_IOBuffer_PopDataWithCallBack(IOBuffer, ARNETWORK_MANAGER_CALLBACK_STATUS_ACK_RECEIVED);
+            }
+        }
+    }
     /** delete the data if the sequence number received is same as the sequence number expected */
-    if(IOBuffer->isWaitAck && IOBuffer->seq == seqNumber)
+    else if(IOBuffer->isWaitAck && IOBuffer->seq == seqNumber)
     {
         IOBuffer->isWaitAck = 0;
-        error = ARNETWORK_IOBuffer_PopDataWithCallBack(IOBuffer, ARNETWORK_MANAGER_CALLBACK_STATUS_ACK_RECEIVED);
+
+        /** an aggregate is acknowledged as a whole */
+        for (dataIndex = 0; (dataIndex < IOBuffer->numberOfDataInFrame) && (error == ARNETWORK_OK); dataIndex++)
+        {
+            error = ARNETWORK_IOBuffer_PopDataWithCallBack(IOBuffer, ARNETWORK_MANAGER_CALLBACK_STATUS_ACK_RECEIVED);
+        }
     }
     else
     {
@@ -306,6 +511,17 @@ eARNETWORK_ERROR ARNETWORK_IOBuffer_Unlock( ARNETWORK_IOBuffer_t *IOBuffer)
     return error;
 }
 
+eARNETWORK_ERROR ARNETWORK_IOBuffer_WaitFreeCell(ARNETWORK_IOBuffer_t *IOBuffer, int timeoutMs)
+{
+    /** -- Wait the freeing of a data of the IOBuffer -- */
+
+    IOBuffer->numberOfFreeCellWaiters++;
+    ARSAL_Cond_Timedwait(&(IOBuffer->freeCellCond), &(IOBuffer->mutex), timeoutMs);
+    IOBuffer->numberOfFreeCellWaiters--;
+
+    return ARNETWORK_OK;
+}
+
 eARNETWORK_ERROR ARNETWORK_IOBuffer_CancelAllData(ARNETWORK_IOBuffer_t *IOBuffer)
 {
     /** -- cancel all remaining data -- */
@@ -341,7 +557,7 @@ eARNETWORK_ERROR ARNETWORK_IOBuffer_PopData(ARNETWORK_IOBuffer_t *IOBuffer)
     if(error == ARNETWORK_OK)
     {
         /** free data */
-        error = ARNETWORK_IOBuffer_FreeData(IOBuffer, &dataDescriptor);
+        error = ARNETWORK_IOBuffer_FreeData(IOBuffer, &dataDescriptor, 0);
     }
 
     return error;
@@ -360,18 +576,70 @@ eARNETWORK_ERROR ARNETWORK_IOBuffer_PopDataWithCallBack(ARNETWORK_IOBuffer_t *IO
     if(error == ARNETWORK_OK)
     {
         /** callback with the reason of the data popping */
-        if(dataDescriptor.callback != NULL)
-        {
-            dataDescriptor.callback(IOBuffer->ID, dataDescriptor.data, dataDescriptor.customData, callbackStatus);
-        }
+        ARNETWORK_IOBuffer_CallBack(IOBuffer, &dataDescriptor, dataDescriptor.data, callbackStatus);
 
         /** free data */
-        error = ARNETWORK_IOBuffer_FreeData(IOBuffer, &dataDescriptor);
+        error = ARNETWORK_IOBuffer_FreeData(IOBuffer, &dataDescriptor, 0);
     }
 
     return error;
 }
 
+eARNETWORK_ERROR ARNETWORK_IOBuffer_PopNewestDataWithCallBack(ARNETWORK_IOBuffer_t *IOBuffer, eARNETWORK_MANAGER_CALLBACK_STATUS callbackStatus)
+{
+    /** -- Pop the newest data of the IOBuffer with callback calling and free it -- */
+
+    /** local declarations */
+    eARNETWORK_ERROR error = ARNETWORK_OK;
+    ARNETWORK_DataDescriptor_t dataDescriptor;
+
+    /** pop and get the data descriptor */
+    error = ARNETWORK_RingBuffer_PopBack(IOBuffer->dataDescriptorRBuffer, (uint8_t*) &dataDescriptor);
+    if(error == ARNETWORK_OK)
+    {
+        /** callback with the reason of the data popping */
+        ARNETWORK_IOBuffer_CallBack(IOBuffer, &dataDescriptor, dataDescriptor.data, callbackStatus);
+
+        /** free data */
+        error = ARNETWORK_IOBuffer_FreeData(IOBuffer, &dataDescriptor, 1);
+    }
+
+    return error;
+}
+
+eARNETWORK_MANAGER_CALLBACK_RETURN ARNETWORK_IOBuffer_CallBack(const ARNETWORK_IOBuffer_t *IOBuffer, const ARNETWORK_DataDescriptor_t *dataDescriptor, uint8_t *data, eARNETWORK_MANAGER_CALLBACK_STATUS status)
+{
+    /** -- Call back the completion of a data of an input buffer -- */
+
+    /** local declarations */
+    eARNETWORK_MANAGER_CALLBACK_RETURN callbackReturn = ARNETWORK_MANAGER_CALLBACK_RETURN_DEFAULT;
+    ARNETWORK_Manager_Completion_t completion;
+    int isQueued = 0;
+
+    if(dataDescriptor->callback != NULL)
+    {
+        if(IOBuffer->completionQueuePtr != NULL)
+        {
+            completion.ID = IOBuffer->ID;
+            /** a copied data is freed once the completion pushed, it is not given to the application */
+            completion.dataPtr = (dataDescriptor->isUsingDataCopy) ? NULL : data;
+            completion.customData = dataDescriptor->customData;
+            completion.callback = dataDescriptor->callback;
+            completion.status = status;
+
+            isQueued = ARNETWORK_CompletionQueue_Push(IOBuffer->completionQueuePtr, &completion);
+        }
+
+        /** call the callback if the completions are not queued or the queue is full */
+        if(!isQueued)
+        {
+            callbackReturn = dataDescriptor->callback(IOBuffer->ID, data, dataDescriptor->customData, status);
+        }
+    }
+
+    return callbackReturn;
+}
+
 eARNETWORK_ERROR ARNETWORK_IOBuffer_Flush(ARNETWORK_IOBuffer_t *IOBuffer)
 {
     /** -- Flush the IoBuffer -- */
@@ -379,10 +647,23 @@ eARNETWORK_ERROR ARNETWORK_IOBuffer_Flush(ARNETWORK_IOBuffer_t *IOBuffer)
     /** local declarations */
     eARNETWORK_ERROR error = ARNETWORK_OK;
 
-    /**  delete all data */
-    while(error == ARNETWORK_OK)
+    /**  delete all data, except the front data borrowed which is popped when it is released ; the other data are then popped from the back */
+    while((error == ARNETWORK_OK) && (ARNETWORK_RingBuffer_GetNumberOfData(IOBuffer->dataDescriptorRBuffer) > IOBuffer->isBorrowed))
     {
-        error = ARNETWORK_IOBuffer_PopDataWithCallBack(IOBuffer, ARNETWORK_MANAGER_CALLBACK_STATUS_CANCEL);
+        if(IOBuffer->isBorrowed)
+        {
+            error = ARNETWORK_IOBuffer_PopNewestDataWithCallBack(IOBuffer, ARNETWORK_MANAGER_CALLBACK_STATUS_CANCEL);
+        }
+        else
+        {
+            error = ARNETWORK_IOBuffer_PopDataWithCallBack(IOBuffer, ARNETWORK_MANAGER_CALLBACK_STATUS_CANCEL);
+        }
+
+        /** take back the semaphore of the data popped, if no reader has taken it ; the readers waiting on it keep waiting */
+        if(error == ARNETWORK_OK)
+        {
+            ARSAL_Sem_Trywait(&(IOBuffer->outputSem));
+        }
     }
 
     /** if the error occurred is "buffer empty" there is no error */
@@ -394,13 +675,51 @@ eARNETWORK_ERROR ARNETWORK_IOBuffer_Flush(ARNETWORK_IOBuffer_t *IOBuffer)
     /** state reset */
     IOBuffer->isWaitAck = 0;
     IOBuffer->alreadyHadData = 0;
-    IOBuffer->waitTimeCount = IOBuffer->sendingWaitTimeMs;
-    IOBuffer->ackWaitTimeCount = IOBuffer->ackTimeoutMs;
+    IOBuffer->waitTimeCount = IOBuffer->sendingWaitTimeUs;
+    IOBuffer->ackWaitTimeCount = IOBuffer->ackTimeoutUs;
     IOBuffer->retryCount = 0;
+    IOBuffer->isRetried = 0;
+    IOBuffer->numberOfDataInFrame = 1;
+    IOBuffer->numberOfFragments = 0;
+    IOBuffer->reassemblyMessageNumber = -1;
 
-    /** reset semaphore */
-    ARSAL_Sem_Destroy(&(IOBuffer->outputSem));
-    ARSAL_Sem_Init(&(IOBuffer->outputSem), 0, 0);
+    return error;
+}
+
+eARNETWORK_ERROR ARNETWORK_IOBuffer_Reset(ARNETWORK_IOBuffer_t *IOBuffer)
+{
+    /** -- Reset the IoBuffer to its state of creation -- */
+
+    /** local declarations */
+    eARNETWORK_ERROR error = ARNETWORK_OK;
+
+    /** cancel the data and reset the sending state */
+    error = ARNETWORK_IOBuffer_Flush (IOBuffer);
+
+    /** reset the sequence numbers and the statistics of the link */
+    IOBuffer->seq = 0;
+    IOBuffer->nbPackets = 0;
+    IOBuffer->nbNetwork = 0;
+    ARNETWORK_LinkQuality_Init (&(IOBuffer->linkQuality));
+    IOBuffer->numberOfDroppedNewest = 0;
+    IOBuffer->numberOfDroppedOldest = 0;
+    IOBuffer->numberOfConflated = 0;
+    IOBuffer->numberOfAcksWithheld = 0;
+    IOBuffer->isConsumerLagReported = 0;
+
+    /** the credits are advertised again by the new peer */
+    IOBuffer->credits = -1;
+    IOBuffer->creditProbeTimeCount = ARNETWORK_IOBUFFER_CREDIT_PROBE_TIME_US;
+    IOBuffer->advertisedCredits = -1;
+
+    /** reset the fragmentation and the reassembly */
+    IOBuffer->messageNumber = 0;
+    IOBuffer->nextFragmentIndex = 0;
+    IOBuffer->firstUnackedFragmentIndex = 0;
+    IOBuffer->reassemblyNumberOfFragments = 0;
+    IOBuffer->reassemblyNumberOfReceived = 0;
+    IOBuffer->reassemblySize = 0;
+    IOBuffer->lastReassembledMessageNumber = -1;
 
     return error;
 }
@@ -409,13 +728,26 @@ eARNETWORK_ERROR ARNETWORK_IOBuffer_AddData(ARNETWORK_IOBuffer_t *IOBuffer, uint
 {
     /** -- Add data in a IOBuffer -- */
 
+    /** local declarations */
+    struct iovec iov;
+
+    iov.iov_base = data;
+    iov.iov_len = dataSize;
+
+    return ARNETWORK_IOBuffer_AddDataV(IOBuffer, &iov, 1, dataSize, customData, callback, doDataCopy);
+}
+
+eARNETWORK_ERROR ARNETWORK_IOBuffer_AddDataV(ARNETWORK_IOBuffer_t *IOBuffer, const struct iovec *iov, int iovcnt, int dataSize, void *customData, ARNETWORK_Manager_Callback_t callback, int doDataCopy)
+{
+    /** -- Add data gathered from several pieces in a IOBuffer -- */
+
     /** local declarations */
     eARNETWORK_ERROR error = ARNETWORK_OK;
     ARNETWORK_DataDescriptor_t dataDescriptor;
     int numberOfFreeCell = 0;
 
-    /** initialize dataDescriptor */
-    dataDescriptor.data = data;
+    /** initialize dataDescriptor ; without copy, the data must be in one piece */
+    dataDescriptor.data = iov[0].iov_base;
     dataDescriptor.dataSize = dataSize;
     dataDescriptor.customData = customData;
     dataDescriptor.callback = callback;
@@ -424,8 +756,18 @@ eARNETWORK_ERROR ARNETWORK_IOBuffer_AddData(ARNETWORK_IOBuffer_t *IOBuffer, uint
     /** get the number of free cell */
     numberOfFreeCell = ARNETWORK_RingBuffer_GetFreeCellNumber(IOBuffer->dataDescriptorRBuffer);
 
-    /** if the buffer is not full or it is overwriting */
-    if( (IOBuffer->dataDescriptorRBuffer->isOverwriting == 1) || (numberOfFreeCell > 0) )
+    /** the size prefix of an aggregated data is limited */
+    if ((IOBuffer->isAggregating) && (dataSize > ARNETWORK_IOBUFFER_AGGREGATION_SIZE_MAX))
+    {
+        error = ARNETWORK_ERROR_BAD_PARAMETER;
+    }
+    /** a data in several pieces can only be sent by copy */
+    else if ((!doDataCopy) && (iovcnt != 1))
+    {
+        error = ARNETWORK_ERROR_BAD_PARAMETER;
+    }
+    /** if the buffer is not full or it is overwriting ; the front data can't be overwritten while it is borrowed */
+    else if( ((IOBuffer->dataDescriptorRBuffer->isOverwriting == 1) && (!IOBuffer->isBorrowed)) || (numberOfFreeCell > 0) )
     {
         /** if there is overwriting */
         if(numberOfFreeCell == 0)
@@ -441,8 +783,8 @@ eARNETWORK_ERROR ARNETWORK_IOBuffer_AddData(ARNETWORK_IOBuffer_t *IOBuffer, uint
             /** check if the IOBuffer can copy and if the size of the copy buffer is large enough */
             if( (ARNETWORK_IOBuffer_CanCopyData(IOBuffer)) && (dataSize <= IOBuffer->dataCopyRBuffer->cellSize) )
             {
-                /** copy data in the dataCopyRBuffer and get the address of the data copy in descData */
-                error =  ARNETWORK_RingBuffer_PushBackWithSize(IOBuffer->dataCopyRBuffer, data, dataSize, &(dataDescriptor.data));
+                /** gather the pieces of the data in the dataCopyRBuffer and get the address of the data copy in descData */
+                error =  ARNETWORK_RingBuffer_PushBackV(IOBuffer->dataCopyRBuffer, iov, iovcnt, &(dataDescriptor.data));
 
                 /** set the flag to indicate the copy of the data */
                 dataDescriptor.isUsingDataCopy = 1;
@@ -468,6 +810,387 @@ eARNETWORK_ERROR ARNETWORK_IOBuffer_AddData(ARNETWORK_IOBuffer_t *IOBuffer, uint
     return error;
 }
 
+eARNETWORK_ERROR ARNETWORK_IOBuffer_PushReceivedData (ARNETWORK_IOBuffer_t *IOBuffer, uint8_t *data, int dataSize)
+{
+    /** -- Add a data received in an output buffer, applying its overflow policy -- */
+
+    /** local declarations */
+    eARNETWORK_ERROR error = ARNETWORK_OK;
+    ARNETWORK_DataDescriptor_t dataDescriptor;
+    int numberOfData = ARNETWORK_RingBuffer_GetNumberOfData (IOBuffer->dataDescriptorRBuffer);
+
+    /** the peer has used one of the credits advertised */
+    if (IOBuffer->advertisedCredits > 0)
+    {
+        IOBuffer->advertisedCredits--;
+    }
+
+    if (ARNETWORK_RingBuffer_GetFreeCellNumber (IOBuffer->dataDescriptorRBuffer) == 0)
+    {
+        switch (IOBuffer->overflowPolicy)
+        {
+        case ARNETWORK_IOBUFFERPARAM_OVERFLOW_POLICY_DROP_OLDEST:
+            /** the front data can't be dropped while it is borrowed */
+            if (!IOBuffer->isBorrowed)
+            {
+                error = ARNETWORK_IOBuffer_PopDataWithCallBack (IOBuffer, ARNETWORK_MANAGER_CALLBACK_STATUS_CANCEL);
+                IOBuffer->numberOfDroppedOldest++;
+            }
+            else
+            {
+                error = ARNETWORK_ERROR_BUFFER_SIZE;
+                IOBuffer->numberOfDroppedNewest++;
+            }
+            break;
+
+        case ARNETWORK_IOBUFFERPARAM_OVERFLOW_POLICY_CONFLATE:
+            /** the most recent data is replaced, unless it is the front data borrowed */
+            if ((!IOBuffer->isBorrowed) || (numberOfData > 1))
+            {
+                error = ARNETWORK_RingBuffer_PopBack (IOBuffer->dataDescriptorRBuffer, (uint8_t*) &dataDescriptor);
+                if ((error == ARNETWORK_OK) && (dataDescriptor.isUsingDataCopy))
+                {
+                    error = ARNETWORK_RingBuffer_PopBack (IOBuffer->dataCopyRBuffer, NULL);
+                }
+                IOBuffer->numberOfConflated++;
+            }
+            else
+            {
+                error = ARNETWORK_ERROR_BUFFER_SIZE;
+                IOBuffer->numberOfDroppedNewest++;
+            }
+            break;
+
+        case ARNETWORK_IOBUFFERPARAM_OVERFLOW_POLICY_BACKPRESSURE:
+            /** the receiver doesn't acknowledge the data ; the data not acknowledged is lost */
+            error = ARNETWORK_ERROR_BUFFER_SIZE;
+            if (IOBuffer->dataType != ARNETWORKAL_FRAME_TYPE_DATA_WITH_ACK)
+            {
+                IOBuffer->numberOfDroppedNewest++;
+            }
+            break;
+
+        default:
+            error = ARNETWORK_ERROR_BUFFER_SIZE;
+            IOBuffer->numberOfDroppedNewest++;
+            break;
+        }
+    }
+
+    if (error == ARNETWORK_OK)
+    {
+        error = ARNETWORK_IOBuffer_AddData (IOBuffer, data, dataSize, NULL, NULL, 1);
+        numberOfData = ARNETWORK_RingBuffer_GetNumberOfData (IOBuffer->dataDescriptorRBuffer);
+    }
+
+    /** report the lag once when the threshold is reached, and again after the consumer catched up */
+    if ((IOBuffer->consumerLagCallback != NULL) && (numberOfData >= IOBuffer->consumerLagThreshold))
+    {
+        if (!IOBuffer->isConsumerLagReported)
+        {
+            IOBuffer->isConsumerLagReported = 1;
+            IOBuffer->consumerLagCallback (IOBuffer->ID, numberOfData, IOBuffer->dataDescriptorRBuffer->numberOfCell, IOBuffer->consumerLagCustomData);
+        }
+    }
+    else
+    {
+        IOBuffer->isConsumerLagReported = 0;
+    }
+
+    return error;
+}
+
+int ARNETWORK_IOBuffer_WriteAggregatedData (uint8_t *aggregate, int aggregateFreeSize, const uint8_t *data, int dataSize)
+{
+    /** -- Write a data in an aggregate, preceded by its size prefix -- */
+
+    /** local declarations */
+    int prefixSize = (dataSize > ARNETWORK_IOBUFFER_AGGREGATION_SHORT_SIZE_MAX) ? 2 : 1;
+
+    if ((dataSize > ARNETWORK_IOBUFFER_AGGREGATION_SIZE_MAX) || (prefixSize + dataSize > aggregateFreeSize))
+    {
+        return -1;
+    }
+
+    if (prefixSize == 1)
+    {
+        aggregate[0] = (uint8_t) dataSize;
+    }
+    else
+    {
+        /** long prefix: first bit set, size on 15 bits big endian */
+        aggregate[0] = (uint8_t) (0x80 | (dataSize >> 8));
+        aggregate[1] = (uint8_t) (dataSize & 0xFF);
+    }
+    memcpy (aggregate + prefixSize, data, dataSize);
+
+    return prefixSize + dataSize;
+}
+
+int ARNETWORK_IOBuffer_ReadAggregatedData (uint8_t *aggregate, int aggregateSize, uint8_t **data, int *dataSize)
+{
+    /** -- Read a data from an aggregate -- */
+
+    /** local declarations */
+    int prefixSize = 1;
+    int size = 0;
+
+    if (aggregateSize < 1)
+    {
+        return -1;
+    }
+
+    if (aggregate[0] & 0x80)
+    {
+        if (aggregateSize < 2)
+        {
+            return -1;
+        }
+        prefixSize = 2;
+        size = ((aggregate[0] & 0x7F) << 8) | aggregate[1];
+    }
+    else
+    {
+        size = aggregate[0];
+    }
+
+    if (prefixSize + size > aggregateSize)
+    {
+        return -1;
+    }
+
+    *data = aggregate + prefixSize;
+    *dataSize = size;
+
+    return prefixSize + size;
+}
+
+int ARNETWORK_IOBuffer_CountAggregatedData (uint8_t *aggregate, int aggregateSize)
+{
+    /** -- Count the data of an aggregate -- */
+
+    /** local declarations */
+    int numberOfData = 0;
+    int offset = 0;
+    int readSize = 0;
+    uint8_t *data = NULL;
+    int dataSize = 0;
+
+    while ((numberOfData >= 0) && (offset < aggregateSize))
+    {
+        readSize = ARNETWORK_IOBuffer_ReadAggregatedData (aggregate + offset, aggregateSize - offset, &data, &dataSize);
+        if (readSize < 0)
+        {
+            numberOfData = -1;
+        }
+        else
+        {
+            offset += readSize;
+            numberOfData++;
+        }
+    }
+
+    return numberOfData;
+}
+
+int ARNETWORK_IOBuffer_AdvertiseCredits (ARNETWORK_IOBuffer_t *IOBuffer)
+{
+    /** -- Get the credits to advertise for an output buffer -- */
+
+    /** local declarations */
+    int credits = ARNETWORK_IOBUFFER_CREDITS_MAX;
+
+    /** the data given to the output callback are never dropped */
+    if ((IOBuffer->outputCallback == NULL) &&
+        (ARNETWORK_RingBuffer_GetFreeCellNumber (IOBuffer->dataDescriptorRBuffer) < ARNETWORK_IOBUFFER_CREDITS_MAX))
+    {
+        credits = ARNETWORK_RingBuffer_GetFreeCellNumber (IOBuffer->dataDescriptorRBuffer);
+    }
+    IOBuffer->advertisedCredits = credits;
+
+    return credits;
+}
+
+void ARNETWORK_IOBuffer_CreditsReceived (ARNETWORK_IOBuffer_t *IOBuffer, int credits)
+{
+    /** -- Update the credits of an input buffer -- */
+
+    if (IOBuffer->isCreditFlowControlled)
+    {
+        IOBuffer->credits = credits;
+        IOBuffer->creditProbeTimeCount = ARNETWORK_IOBUFFER_CREDIT_PROBE_TIME_US;
+    }
+}
+
+void ARNETWORK_IOBuffer_ConsumeCredits (ARNETWORK_IOBuffer_t *IOBuffer, int numberOfData)
+{
+    /** -- Consume the credits of the data sent -- */
+
+    if ((IOBuffer->isCreditFlowControlled) && (IOBuffer->credits > 0))
+    {
+        IOBuffer->credits = (numberOfData < IOBuffer->credits) ? IOBuffer->credits - numberOfData : 0;
+        if (IOBuffer->credits == 0)
+        {
+            IOBuffer->creditProbeTimeCount = ARNETWORK_IOBUFFER_CREDIT_PROBE_TIME_US;
+        }
+    }
+}
+
+int ARNETWORK_IOBuffer_WriteFragmentHeader (uint8_t *header, uint8_t messageNumber, int fragmentIndex, int numberOfFragments, int fragmentSize)
+{
+    /** -- Write the header of a fragment -- */
+
+    header[0] = messageNumber;
+    header[1] = (uint8_t) (fragmentIndex >> 8);
+    header[2] = (uint8_t) (fragmentIndex & 0xFF);
+    header[3] = (uint8_t) (numberOfFragments >> 8);
+    header[4] = (uint8_t) (numberOfFragments & 0xFF);
+    header[5] = (uint8_t) (fragmentSize >> 8);
+    header[6] = (uint8_t) (fragmentSize & 0xFF);
+
+    return ARNETWORK_IOBUFFER_FRAGMENT_HEADER_SIZE;
+}
+
+int ARNETWORK_IOBuffer_ReadFragmentHeader (const uint8_t *frameData, int frameDataSize, uint8_t *messageNumber, int *fragmentIndex, int *numberOfFragments, int *fragmentSize)
+{
+    /** -- Read the header of a fragment -- */
+
+    if (frameDataSize < ARNETWORK_IOBUFFER_FRAGMENT_HEADER_SIZE)
+    {
+        return -1;
+    }
+
+    *messageNumber = frameData[0];
+    *fragmentIndex = (frameData[1] << 8) | frameData[2];
+    *numberOfFragments = (frameData[3] << 8) | frameData[4];
+    *fragmentSize = (frameData[5] << 8) | frameData[6];
+
+    if ((*fragmentIndex >= *numberOfFragments) ||
+        (frameDataSize - ARNETWORK_IOBUFFER_FRAGMENT_HEADER_SIZE > *fragmentSize))
+    {
+        return -1;
+    }
+
+    return ARNETWORK_IOBUFFER_FRAGMENT_HEADER_SIZE;
+}
+
+int ARNETWORK_IOBuffer_CanSendFragment (ARNETWORK_IOBuffer_t *IOBuffer)
+{
+    /** -- Check if a fragmenting input buffer can send a new fragment -- */
+
+    /** local declarations */
+    int canSend = 0;
+
+    if (!IOBuffer->isFragmenting)
+    {
+        canSend = 0;
+    }
+    else if (IOBuffer->numberOfFragments == 0)
+    {
+        /** a new message can be started */
+        canSend = !ARNETWORK_RingBuffer_IsEmpty (IOBuffer->dataDescriptorRBuffer);
+    }
+    else
+    {
+        canSend = ((IOBuffer->nextFragmentIndex < IOBuffer->numberOfFragments) &&
+                   (IOBuffer->nextFragmentIndex - IOBuffer->firstUnackedFragmentIndex < IOBuffer->sendingBurstSize));
+    }
+
+    return canSend;
+}
+
+eARNETWORK_ERROR ARNETWORK_IOBuffer_NewReassembly (ARNETWORK_IOBuffer_t *IOBuffer)
+{
+    /** -- Allocate the memory to reassemble the messages of a fragmenting output buffer -- */
+
+    /** local declarations */
+    eARNETWORK_ERROR error = ARNETWORK_OK;
+
+    if ((IOBuffer == NULL) || (!IOBuffer->isFragmenting) || (!ARNETWORK_IOBuffer_CanCopyData (IOBuffer)))
+    {
+        error = ARNETWORK_ERROR_BAD_PARAMETER;
+    }
+
+    if (error == ARNETWORK_OK)
+    {
+        IOBuffer->reassemblyMaxNumberOfFragments = ARNETWORK_IOBuffer_GetReassemblyMaxNumberOfFragments (IOBuffer->dataCopyRBuffer->cellSize);
+
+        IOBuffer->reassemblyData = ARNETWORK_Arena_Malloc (IOBuffer->arenaPtr, IOBuffer->dataCopyRBuffer->cellSize);
+        IOBuffer->reassemblyBitmap = ARNETWORK_Arena_Malloc (IOBuffer->arenaPtr, (IOBuffer->reassemblyMaxNumberOfFragments + 7) / 8);
+        if ((IOBuffer->reassemblyData == NULL) || (IOBuffer->reassemblyBitmap == NULL))
+        {
+            error = ARNETWORK_ERROR_ALLOC;
+        }
+    }
+
+    return error;
+}
+
+eARNETWORK_ERROR ARNETWORK_IOBuffer_AddFragment (ARNETWORK_IOBuffer_t *IOBuffer, uint8_t messageNumber, int fragmentIndex, int numberOfFragments, int fragmentSize, const uint8_t *data, int dataSize, int *isComplete)
+{
+    /** -- Add a fragment received to the message being reassembled -- */
+
+    /** local declarations */
+    eARNETWORK_ERROR error = ARNETWORK_OK;
+    int offset = fragmentIndex * fragmentSize;
+    uint8_t fragmentBit = (uint8_t) (1 << (fragmentIndex % 8));
+
+    *isComplete = 0;
+
+    /** the fragments sent again after the reassembly of their message are ignored */
+    if (messageNumber == IOBuffer->lastReassembledMessageNumber)
+    {
+        error = ARNETWORK_ERROR_BUFFER_EMPTY;
+    }
+    /** all the fragments, except the last one, have the size of the fragments ; the message must fit in the reassembly memory */
+    else if ((numberOfFragments > IOBuffer->reassemblyMaxNumberOfFragments) ||
+             ((fragmentIndex < numberOfFragments - 1) && (dataSize != fragmentSize)) ||
+             (offset + dataSize > (int) IOBuffer->dataCopyRBuffer->cellSize))
+    {
+        error = ARNETWORK_ERROR_BUFFER_SIZE;
+    }
+
+    if (error == ARNETWORK_OK)
+    {
+        /** a fragment of another message abandons the message being reassembled */
+        if ((messageNumber != IOBuffer->reassemblyMessageNumber) ||
+            (numberOfFragments != IOBuffer->reassemblyNumberOfFragments))
+        {
+            IOBuffer->reassemblyMessageNumber = messageNumber;
+            IOBuffer->reassemblyNumberOfFragments = numberOfFragments;
+            IOBuffer->reassemblyNumberOfReceived = 0;
+            IOBuffer->reassemblySize = 0;
+            memset (IOBuffer->reassemblyBitmap, 0, (numberOfFragments + 7) / 8);
+        }
+
+        if (!(IOBuffer->reassemblyBitmap[fragmentIndex / 8] & fragmentBit))
+        {
+            memcpy (IOBuffer->reassemblyData + offset, data, dataSize);
+            IOBuffer->reassemblyBitmap[fragmentIndex / 8] |= fragmentBit;
+            IOBuffer->reassemblyNumberOfReceived++;
+            if (fragmentIndex == numberOfFragments - 1)
+            {
+                IOBuffer->reassemblySize = offset + dataSize;
+            }
+        }
+
+        if (IOBuffer->reassemblyNumberOfReceived == IOBuffer->reassemblyNumberOfFragments)
+        {
+            *isComplete = 1;
+        }
+    }
+
+    return error;
+}
+
+void ARNETWORK_IOBuffer_EndReassembly (ARNETWORK_IOBuffer_t *IOBuffer)
+{
+    /** -- End the reassembly of the message complete -- */
+
+    IOBuffer->lastReassembledMessageNumber = IOBuffer->reassemblyMessageNumber;
+    IOBuffer->reassemblyMessageNumber = -1;
+}
+
 int ARNETWORK_IOBuffer_ShouldAcceptData (ARNETWORK_IOBuffer_t *IOBuffer, uint8_t seqnum)
 {
     int retVal = -1;
@@ -500,8 +1223,16 @@ eARNETWORK_ERROR ARNETWORK_IOBuffer_ReadData(ARNETWORK_IOBuffer_t *IOBuffer, uin
     ARNETWORK_DataDescriptor_t dataDescriptor;
     int localReadSize = 0;
 
-    /** get data descriptor*/
-    error = ARNETWORK_RingBuffer_Front(IOBuffer->dataDescriptorRBuffer, (uint8_t*) &dataDescriptor);
+    /** the front data can't be read while it is borrowed */
+    if(IOBuffer->isBorrowed)
+    {
+        error = ARNETWORK_ERROR_IOBUFFER_DATA_BORROWED;
+    }
+    else
+    {
+        /** get data descriptor*/
+        error = ARNETWORK_RingBuffer_Front(IOBuffer->dataDescriptorRBuffer, (uint8_t*) &dataDescriptor);
+    }
 
     if( error == ARNETWORK_OK )
     {
@@ -519,6 +1250,8 @@ eARNETWORK_ERROR ARNETWORK_IOBuffer_ReadData(ARNETWORK_IOBuffer_t *IOBuffer, uin
         }
         else
         {
+            /** the data is kept ; return the size needed to read it */
+            localReadSize = dataDescriptor.dataSize;
             error = ARNETWORK_ERROR_BUFFER_SIZE;
         }
     }
@@ -532,6 +1265,56 @@ eARNETWORK_ERROR ARNETWORK_IOBuffer_ReadData(ARNETWORK_IOBuffer_t *IOBuffer, uin
     return error;
 }
 
+eARNETWORK_ERROR ARNETWORK_IOBuffer_BorrowData(ARNETWORK_IOBuffer_t *IOBuffer, uint8_t **data, int *dataSize)
+{
+    /** -- lend the front data received in a IOBuffer -- */
+
+    /** local declarations */
+    eARNETWORK_ERROR error = ARNETWORK_OK;
+    ARNETWORK_DataDescriptor_t dataDescriptor;
+
+    /** only one data can be borrowed at a time */
+    if(IOBuffer->isBorrowed)
+    {
+        error = ARNETWORK_ERROR_IOBUFFER_DATA_BORROWED;
+    }
+    else
+    {
+        /** get data descriptor*/
+        error = ARNETWORK_RingBuffer_Front(IOBuffer->dataDescriptorRBuffer, (uint8_t*) &dataDescriptor);
+    }
+
+    if( error == ARNETWORK_OK )
+    {
+        /** the data stays in the data copy ring buffer until it is released */
+        *data = dataDescriptor.data;
+        *dataSize = dataDescriptor.dataSize;
+        IOBuffer->isBorrowed = 1;
+    }
+
+    return error;
+}
+
+eARNETWORK_ERROR ARNETWORK_IOBuffer_ReleaseData(ARNETWORK_IOBuffer_t *IOBuffer)
+{
+    /** -- release the data borrowed and pop it -- */
+
+    /** local declarations */
+    eARNETWORK_ERROR error = ARNETWORK_OK;
+
+    if(IOBuffer->isBorrowed)
+    {
+        IOBuffer->isBorrowed = 0;
+        error = ARNETWORK_IOBuffer_PopData(IOBuffer);
+    }
+    else
+    {
+        error = ARNETWORK_ERROR_BAD_PARAMETER;
+    }
+
+    return error;
+}
+
 int ARNETWORK_IOBuffer_GetEstimatedMissPercentage (ARNETWORK_IOBuffer_t *IOBuffer)
 {
     if (IOBuffer == NULL)
@@ -544,3 +1327,38 @@ int ARNETWORK_IOBuffer_GetEstimatedMissPercentage (ARNETWORK_IOBuffer_t *IOBuffe
     if (IOBuffer->nbNetwork == 0) { return 0; } // Avoid divide by zero
     return (100 * nbMissed) / IOBuffer->nbNetwork;
 }
+
+int ARNETWORK_IOBuffer_GetMemoryFootprint (ARNETWORK_IOBuffer_t *IOBuffer)
+{
+    /** -- Get the memory allocated by the buffer -- */
+
+    /** local declarations */
+    int size = 0;
+
+    if (IOBuffer != NULL)
+    {
+        size = sizeof (ARNETWORK_IOBuffer_t);
+
+        if (IOBuffer->dataDescriptorRBuffer != NULL)
+        {
+            size += sizeof (ARNETWORK_RingBuffer_t) + (IOBuffer->dataDescriptorRBuffer->numberOfCell * IOBuffer->dataDescriptorRBuffer->cellSize);
+        }
+
+        if (IOBuffer->dataCopyRBuffer != NULL)
+        {
+            size += sizeof (ARNETWORK_RingBuffer_t) + (IOBuffer->dataCopyRBuffer->numberOfCell * IOBuffer->dataCopyRBuffer->cellSize);
+        }
+
+        if (IOBuffer->fragmentSeqArr != NULL)
+        {
+            size += IOBuffer->sendingBurstSize * sizeof (int);
+        }
+
+        if (IOBuffer->reassemblyData != NULL)
+        {
+            size += IOBuffer->dataCopyRBuffer->cellSize + ((IOBuffer->reassemblyMaxNumberOfFragments + 7) / 8);
+        }
+    }
+
+    return size;
+}
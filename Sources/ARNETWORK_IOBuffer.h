@@ -41,8 +41,58 @@
 #include <libARNetworkAL/ARNETWORKAL_Frame.h>
 #include "ARNETWORK_RingBuffer.h"
 #include <libARNetwork/ARNETWORK_IOBufferParam.h>
+#include <libARNetwork/ARNETWORK_Manager.h>
 #include <libARSAL/ARSAL_Mutex.h>
 #include <libARSAL/ARSAL_Sem.h>
+#include <libARSAL/ARSAL_Time.h>
+#include "ARNETWORK_LinkQuality.h"
+#include "ARNETWORK_DataDescriptor.h"
+#include "ARNETWORK_CompletionQueue.h"
+
+/**
+ * @brief Maximum size of a data stored in an aggregate with a one byte size prefix
+ */
+#define ARNETWORK_IOBUFFER_AGGREGATION_SHORT_SIZE_MAX (0x7F)
+
+/**
+ * @brief Maximum size of a data stored in an aggregate (two bytes size prefix, the first bit indicates the long prefix)
+ */
+#define ARNETWORK_IOBUFFER_AGGREGATION_SIZE_MAX (0x7FFF)
+
+/**
+ * @brief Number of microseconds in a millisecond ; the sending and acknowledgement times are counted in microsecond
+ */
+#define ARNETWORK_IOBUFFER_MICROSECONDS_PER_MILLISECOND (1000)
+
+/**
+ * @brief Maximum number of credits advertised for an output buffer ; one byte on the network
+ */
+#define ARNETWORK_IOBUFFER_CREDITS_MAX (0xFF)
+
+/**
+ * @brief Time, in microsecond, before an input buffer without credit sends a data to probe the peer ; the advertisement of its new credits could have been lost
+ */
+#define ARNETWORK_IOBUFFER_CREDIT_PROBE_TIME_US (200000)
+
+/**
+ * @brief Size of the header of a fragment : message number (1 byte), fragment index, number of fragments and fragment size (2 bytes each, big endian)
+ */
+#define ARNETWORK_IOBUFFER_FRAGMENT_HEADER_SIZE (7)
+
+/**
+ * @brief Maximum number of fragments of a message ; limit of the 2 bytes of the number of fragments in the fragment header
+ */
+#define ARNETWORK_IOBUFFER_FRAGMENT_NUMBER_MAX (0xFFFF)
+
+/**
+ * @brief Maximum size, in byte, of a fragment ; limit of the 2 bytes of the fragment size in the fragment header
+ */
+#define ARNETWORK_IOBUFFER_FRAGMENT_SIZE_MAX (0xFFFF)
+
+/**
+ * @brief Minimum size of the fragments (except the last fragment of a message) ; bounds the reassembly memory of an output buffer
+ */
+#define ARNETWORK_IOBUFFER_FRAGMENT_SIZE_MIN (64)
 
 /*****************************************
  *
@@ -61,18 +111,24 @@ typedef struct
     ARNETWORK_RingBuffer_t *dataCopyRBuffer; /**< RingBuffer used to store the data copy */
     ARNETWORK_RingBuffer_t *dataDescriptorRBuffer; /**< RingBuffer used to store the data description */
     eARNETWORKAL_FRAME_TYPE dataType; /**< Type of the data stored in the buffer*/
-    int sendingWaitTimeMs;  /**< Time in millisecond between 2 send when the InOutBuffer if used with a libARNetwork/sender*/
-    int ackTimeoutMs; /**< Timeout in millisecond after retry to send the data when the InOutBuffer is used with a libARNetwork/sender*/
+    int sendingWaitTimeUs;  /**< Time in microsecond between 2 send when the InOutBuffer if used with a libARNetwork/sender*/
+    int ackTimeoutUs; /**< Timeout in microsecond after retry to send the data when the InOutBuffer is used with a libARNetwork/sender (-1 if not used)*/
     int numberOfRetry; /**< Maximum number of retry of sending before to consider a failure when the InOutBuffer is used with a libARNetwork/sender*/
+    int sendingBurstSize; /**< Maximum number of data sent in one pass when the InOutBuffer is used with a libARNetwork/sender*/
+    int isAggregating; /**< Indicator of aggregation of the data in one frame (1 = true | 0 = false)*/
 
     int isWaitAck; /**< Indicator of waiting an acknowledgement  (1 = true | 0 = false). Must be accessed through ARNETWORK_IOBuffer_IsWaitAck()*/
     int alreadyHadData; /**< Init flag (to avoid sequence number conflicts) */
     uint8_t seq; /**< Sequence number for data sent from this buffer or last sequence number received */
     uint32_t nbPackets; /**< Number of packets sent/received since the creation of the buffer */
     uint32_t nbNetwork; /**< Total number of packets sent/received, including misses (based on sequence numbers) */
-    int waitTimeCount; /**< Counter of time to wait before the next sending*/
-    int ackWaitTimeCount; /**< Counter of time to wait before to consider a timeout without receiving an acknowledgement*/
+    ARNETWORK_LinkQuality_t linkQuality; /**< quality of the link over sliding windows, for the output buffers */
+    int waitTimeCount; /**< Counter of time, in microsecond, to wait before the next sending*/
+    int ackWaitTimeCount; /**< Counter of time, in microsecond, to wait before to consider a timeout without receiving an acknowledgement*/
     int retryCount; /**< Counter of sending retry remaining before to consider a failure*/
+    struct timespec ackSendTime; /**< Time of the first sending of the data waiting an acknowledgement (used to measure the round trip time) */
+    int isRetried; /**< Indicator of retry of the data waiting an acknowledgement (1 = true | 0 = false); the round trip time of a retried data is ambiguous */
+    int numberOfDataInFrame; /**< Number of data sent in the last frame (more than one for an aggregating buffer) ; all are popped by the acknowledgement */
 
     ARSAL_Mutex_t mutex;  /**< Mutex to take before to use the IOBuffer.
                            *   @warning This mutex is not managed by the IOBuffer itself but by the user
@@ -80,6 +136,49 @@ typedef struct
                            *   @see ARNETWORK_IOBuffer_Unlock()
                            */
     ARSAL_Sem_t outputSem; /**< Semaphore used, by the outputs, to know when a data is ready to be read */
+    ARSAL_Cond_t freeCellCond; /**< Condition, used with the mutex, signaled once for each data freed from an input buffer */
+    int numberOfFreeCellWaiters; /**< Number of producers waiting a free cell on freeCellCond */
+    int isRemoved; /**< Indicator of the removal of the buffer from the Manager (1 = true | 0 = false) ; its producers and readers waiting return an error. Changed with the mutex taken */
+    int numberOfUsers; /**< Number of holders of the buffer: the Manager until the removal of the buffer, and the calls of the application using it ; the last one deletes it. Changed with the buffersMutex of the Manager taken */
+    ARNETWORK_Manager_OutputCallback_t outputCallback; /**< Callback receiving the data of an output buffer without copy ; if NULL the data are stored in the buffer */
+    void *outputCallbackCustomData; /**< Custom data given to the outputCallback */
+    int isBorrowed; /**< Indicator of the lending of the front data of an output buffer to the user (1 = true | 0 = false) ; this data is kept until it is released */
+    int isImmediateAck; /**< Indicator of immediate acknowledgment of the data received in an output buffer, even if the acknowledgments are delayed (1 = true | 0 = false) */
+
+    eARNETWORK_IOBUFFERPARAM_OVERFLOW_POLICY overflowPolicy; /**< Policy of the output buffer full when a new data is received ; never ARNETWORK_IOBUFFERPARAM_OVERFLOW_POLICY_DEFAULT */
+    uint32_t numberOfDroppedNewest; /**< Number of data received dropped because the output buffer was full */
+    uint32_t numberOfDroppedOldest; /**< Number of data not read dropped to store a new data */
+    uint32_t numberOfConflated; /**< Number of data not read replaced by a new data */
+    uint32_t numberOfAcksWithheld; /**< Number of data not acknowledged because the output buffer was full */
+    ARNETWORK_Manager_ConsumerLagCallback_t consumerLagCallback; /**< Callback reporting the lag of the application reading the output buffer ; can be NULL */
+    void *consumerLagCustomData; /**< Custom data given to the consumerLagCallback */
+    int consumerLagThreshold; /**< Number of data waiting to be read from which the lag is reported */
+    int isConsumerLagReported; /**< Indicator of a lag reported, until the number of data waiting goes below the threshold (1 = true | 0 = false) */
+
+    ARNETWORK_CompletionQueue_t *completionQueuePtr; /**< Queue receiving the completions of the data of an input buffer instead of their callback ; NULL to call the callback */
+    eARNETWORK_MANAGER_CALLBACK_RETURN timeoutPolicy; /**< Decision on a timeout of an input buffer whose completions are queued */
+
+    int isCreditFlowControlled; /**< Indicator of credit-based flow control (1 = true | 0 = false)*/
+    int credits; /**< Number of data an input buffer can still send, advertised by the peer ; -1 if not advertised yet (not limited) */
+    int creditProbeTimeCount; /**< Time, in microsecond, before an input buffer without credit sends a data to probe the peer */
+    int advertisedCredits; /**< Last number of credits advertised for an output buffer ; -1 if not advertised yet */
+
+    int isFragmenting; /**< Indicator of large messages split in fragments (1 = true | 0 = false)*/
+    uint8_t messageNumber; /**< Number of the message being sent by an input buffer */
+    int numberOfFragments; /**< Number of fragments of the message being sent ; 0 if no message is being sent */
+    int nextFragmentIndex; /**< Index of the next fragment to send for the first time */
+    int firstUnackedFragmentIndex; /**< Index of the oldest fragment waiting its acknowledgement */
+    int *fragmentSeqArr; /**< Sequence number of the fragments sent, by index modulo sendingBurstSize ; -1 once acknowledged */
+    uint8_t *reassemblyData; /**< Message being reassembled by an output buffer, of dataCopyMaxSize bytes */
+    uint8_t *reassemblyBitmap; /**< One bit by fragment of the message being reassembled, set once the fragment received */
+    int reassemblyMaxNumberOfFragments; /**< Maximum number of fragments of a message reassembled */
+    int reassemblyMessageNumber; /**< Number of the message being reassembled ; -1 if none */
+    int reassemblyNumberOfFragments; /**< Number of fragments of the message being reassembled */
+    int reassemblyNumberOfReceived; /**< Number of fragments of the message being reassembled already received */
+    int reassemblySize; /**< Size of the message being reassembled, known at the reception of its last fragment */
+    int lastReassembledMessageNumber; /**< Number of the last message reassembled, to ignore its fragments sent again ; -1 if none */
+
+    ARNETWORK_Arena_t *arenaPtr; /**< Arena in which the buffer is allocated ; NULL if allocated by malloc() */
 
 }ARNETWORK_IOBuffer_t;
 
@@ -94,6 +193,39 @@ typedef struct
  */
 ARNETWORK_IOBuffer_t* ARNETWORK_IOBuffer_New(const ARNETWORK_IOBufferParam_t *param, int isInternal);
 
+/**
+ * @brief Create a new input or output buffer in an arena
+ * @warning This function allocate memory
+ * @post ARNETWORK_IOBuffer_Delete() must be called to delete the input or output buffer ; the memory of the arena is freed by the deletion of the arena
+ * @param[in] param The parameters for the new input or output buffer
+ * @param[in] isInternal Flag to disable value checks on internal buffers
+ * @param arenaPtr arena in which the buffer, its ring buffers and its fragmentation state are allocated ; NULL to allocate them by malloc()
+ * @return Pointer on the new input or output buffer
+ * @see ARNETWORK_IOBuffer_GetArenaSize()
+ * @see ARNETWORK_IOBuffer_Delete()
+ */
+ARNETWORK_IOBuffer_t* ARNETWORK_IOBuffer_NewInArena(const ARNETWORK_IOBufferParam_t *param, int isInternal, ARNETWORK_Arena_t *arenaPtr);
+
+/**
+ * @brief Get the size taken in an arena by an input or output buffer
+ * @param[in] param The parameters of the buffer, with its final dataCopyMaxSize
+ * @param[in] isReassembling 1 if the memory to reassemble the messages is allocated (fragmenting output buffer) ; otherwise 0
+ * @return size in byte
+ * @see ARNETWORK_IOBuffer_NewInArena()
+ * @see ARNETWORK_IOBuffer_NewReassembly()
+ */
+size_t ARNETWORK_IOBuffer_GetArenaSize(const ARNETWORK_IOBufferParam_t *param, int isReassembling);
+
+/**
+ * @brief Get the memory that the creation of an input or output buffer will allocate
+ * @details Same sum as ARNETWORK_IOBuffer_GetMemoryFootprint(), computed from the parameters before the buffer is allocated.
+ * @param[in] param The parameters of the buffer, with its final dataCopyMaxSize
+ * @param[in] isReassembling 1 if the memory to reassemble the messages is allocated (fragmenting output buffer) ; otherwise 0
+ * @return size in byte
+ * @see ARNETWORK_IOBuffer_GetMemoryFootprint()
+ */
+size_t ARNETWORK_IOBuffer_GetParamMemoryFootprint(const ARNETWORK_IOBufferParam_t *param, int isReassembling);
+
 /**
  * @brief Delete the input or output buffer
  * @warning This function free memory
@@ -115,7 +247,8 @@ static inline int ARNETWORK_IOBuffer_CanCopyData(ARNETWORK_IOBuffer_t *IOBuffer)
 /**
  * @brief Receive an acknowledgement to a IOBuffer.
  * @warning The IOBuffer mutex must lock before the calling of this function and unlock after.
- * @details If the IOBuffer is waiting about an acknowledgement and seqNum is equal to the sequence number waited, the inOutBuffer pops the last data and delete its is waiting acknowledgement.
+ * @details If the IOBuffer is waiting about an acknowledgement and seqNum is equal to the sequence number waited, the inOutBuffer pops the data of the last frame and delete its is waiting acknowledgement.
+ * For a fragmenting IOBuffer, the fragment of seqNum is acknowledged, and the data is popped once all its fragments are acknowledged.
  * @param[in] IOBuffer The input or output buffer
  * @param[in] seqNumber sequence number of the acknowledgement
  * @return error equal to ARNETWORK_OK if the data has been correctly acknowledged otherwise equal to 1
@@ -143,6 +276,17 @@ eARNETWORK_ERROR ARNETWORK_IOBuffer_Lock (ARNETWORK_IOBuffer_t *IOBuffer);
  */
 eARNETWORK_ERROR ARNETWORK_IOBuffer_Unlock (ARNETWORK_IOBuffer_t *IOBuffer);
 
+/**
+ * @brief Wait the freeing of a data of the IOBuffer
+ * @details Each data freed wakes one producer waiting. The wait can also end without data freed (timeout or spurious wake up):
+ * the caller must check again the free space of the IOBuffer.
+ * @warning The IOBuffer mutex must be locked before the calling of this function ; it is released during the wait.
+ * @param IOBuffer The input buffer
+ * @param[in] timeoutMs maximum time, in millisecond, to wait
+ * @return error equal to ARNETWORK_OK
+ */
+eARNETWORK_ERROR ARNETWORK_IOBuffer_WaitFreeCell (ARNETWORK_IOBuffer_t *IOBuffer, int timeoutMs);
+
 /**
  * @brief cancel all remaining data.
  * @warning the IOBuffer must store ARNETWORK_DataDescriptor_t
@@ -166,14 +310,46 @@ eARNETWORK_ERROR ARNETWORK_IOBuffer_PopData(ARNETWORK_IOBuffer_t *IOBuffer);
  */
 eARNETWORK_ERROR ARNETWORK_IOBuffer_PopDataWithCallBack(ARNETWORK_IOBuffer_t *IOBuffer, eARNETWORK_MANAGER_CALLBACK_STATUS callbackStatus);
 
+/**
+ * @brief Pop the newest data of the IOBuffer with callback calling and free it
+ * @details Unlike ARNETWORK_IOBuffer_PopDataWithCallBack(), the front data is kept ; used when the front data is borrowed
+ * @param IOBuffer The input or output buffer
+ * @param[in] callbackStatus status sent by the callback
+ * @return error equal to ARNETWORK_OK if the data are correctly deleted otherwise see eARNETWORK_ERROR
+ */
+eARNETWORK_ERROR ARNETWORK_IOBuffer_PopNewestDataWithCallBack(ARNETWORK_IOBuffer_t *IOBuffer, eARNETWORK_MANAGER_CALLBACK_STATUS callbackStatus);
+
+/**
+ * @brief Call back the completion of a data of an input buffer
+ * @details The completion is pushed in the completion queue of the IOBuffer if any, otherwise the callback of the data is called.
+ * If the completion queue is full the callback is called, so that no completion is lost.
+ * @param IOBuffer The input buffer
+ * @param[in] dataDescriptor The data descriptor of the data
+ * @param[in] data pointer on the data given to the callback
+ * @param[in] status status of the completion
+ * @return return of the callback, ARNETWORK_MANAGER_CALLBACK_RETURN_DEFAULT if the completion is queued or the data has no callback
+ */
+eARNETWORK_MANAGER_CALLBACK_RETURN ARNETWORK_IOBuffer_CallBack(const ARNETWORK_IOBuffer_t *IOBuffer, const ARNETWORK_DataDescriptor_t *dataDescriptor, uint8_t *data, eARNETWORK_MANAGER_CALLBACK_STATUS status);
+
 /**
  * @brief flush the IOBuffer
+ * @details The data borrowed is kept until it is released.
  * @warning The IOBuffer mutex must lock before the calling of this function and unlock after.
  * @param IOBuffer The input or output buffer
  * @return eARNETWORK_ERROR
  */
 eARNETWORK_ERROR ARNETWORK_IOBuffer_Flush (ARNETWORK_IOBuffer_t *IOBuffer);
 
+/**
+ * @brief reset the IOBuffer to its state of creation, keeping its memory and its settings
+ * @details The IOBuffer is flushed ; its sequence number, its statistics, its credits and its fragmentation state are reset.
+ * @warning The IOBuffer mutex must lock before the calling of this function and unlock after.
+ * @param IOBuffer The input or output buffer
+ * @return eARNETWORK_ERROR
+ * @see ARNETWORK_IOBuffer_Flush()
+ */
+eARNETWORK_ERROR ARNETWORK_IOBuffer_Reset (ARNETWORK_IOBuffer_t *IOBuffer);
+
 /**
  * @brief Add data in a IOBuffer
  * @param IOBuffer The input or output buffer
@@ -186,6 +362,160 @@ eARNETWORK_ERROR ARNETWORK_IOBuffer_Flush (ARNETWORK_IOBuffer_t *IOBuffer);
  */
 eARNETWORK_ERROR ARNETWORK_IOBuffer_AddData(ARNETWORK_IOBuffer_t *IOBuffer, uint8_t *data, int dataSize, void *customData, ARNETWORK_Manager_Callback_t callback, int doDataCopy);
 
+/**
+ * @brief Add data gathered from several pieces in a IOBuffer
+ * @details With copy, the pieces are gathered directly in the data copy storage of the IOBuffer.
+ * @param IOBuffer The input or output buffer
+ * @param[in] iov array of the pieces of the data to add, in order ; it is not kept
+ * @param[in] iovcnt number of pieces, at least 1 ; 1 if the data is not copied
+ * @param[in] dataSize total size of the pieces
+ * @param[in] customData custom data sent to the callback
+ * @param[in] callback pointer on the callback to call when the data is sent or an error occurred
+ * @param[in] doDataCopy indocator to copy the data in the IOBuffer
+ * @return error eARNETWORK_ERROR ; ARNETWORK_ERROR_BAD_PARAMETER if a data in several pieces is not copied
+ * @see ARNETWORK_IOBuffer_AddData()
+ */
+eARNETWORK_ERROR ARNETWORK_IOBuffer_AddDataV(ARNETWORK_IOBuffer_t *IOBuffer, const struct iovec *iov, int iovcnt, int dataSize, void *customData, ARNETWORK_Manager_Callback_t callback, int doDataCopy);
+
+/**
+ * @brief Write a data in an aggregate, preceded by its size prefix
+ * @param[out] aggregate pointer on the end of the aggregate
+ * @param[in] aggregateFreeSize free size at the end of the aggregate
+ * @param[in] data The data to write
+ * @param[in] dataSize size of the data to write
+ * @return number of bytes written, or -1 if the data doesn't fit in the aggregate
+ */
+int ARNETWORK_IOBuffer_WriteAggregatedData (uint8_t *aggregate, int aggregateFreeSize, const uint8_t *data, int dataSize);
+
+/**
+ * @brief Read a data from an aggregate
+ * @param[in] aggregate pointer on the current position in the aggregate
+ * @param[in] aggregateSize remaining size of the aggregate
+ * @param[out] data pointer on the data in the aggregate
+ * @param[out] dataSize size of the data
+ * @return number of bytes read, or -1 if the aggregate is malformed
+ */
+int ARNETWORK_IOBuffer_ReadAggregatedData (uint8_t *aggregate, int aggregateSize, uint8_t **data, int *dataSize);
+
+/**
+ * @brief Count the data of an aggregate
+ * @param[in] aggregate pointer on the aggregate
+ * @param[in] aggregateSize size of the aggregate
+ * @return number of data of the aggregate, or -1 if the aggregate is malformed
+ */
+int ARNETWORK_IOBuffer_CountAggregatedData (uint8_t *aggregate, int aggregateSize);
+
+/**
+ * @brief Add a data received in an output buffer, applying its overflow policy when it is full
+ * @details The data is copied. The consumer lag callback is called when the number of data waiting to be read reaches the lag threshold.
+ * @warning The IOBuffer mutex must lock before the calling of this function and unlock after.
+ * @param IOBuffer The output buffer
+ * @param[in] data pointer on the data received
+ * @param[in] dataSize size of the data
+ * @return error eARNETWORK_ERROR ; ARNETWORK_ERROR_BUFFER_SIZE if the data is dropped, or withheld by the ARNETWORK_IOBUFFERPARAM_OVERFLOW_POLICY_BACKPRESSURE policy
+ * @see eARNETWORK_IOBUFFERPARAM_OVERFLOW_POLICY
+ */
+eARNETWORK_ERROR ARNETWORK_IOBuffer_PushReceivedData (ARNETWORK_IOBuffer_t *IOBuffer, uint8_t *data, int dataSize);
+
+/**
+ * @brief Get the credits to advertise for an output buffer controlled by credits
+ * @details The credits are the number of free cells, at most ARNETWORK_IOBUFFER_CREDITS_MAX ; they are not limited if the data are given to an output callback. They are kept as the last credits advertised.
+ * @warning The IOBuffer mutex must lock before the calling of this function and unlock after.
+ * @param IOBuffer The output buffer
+ * @return number of credits to advertise
+ */
+int ARNETWORK_IOBuffer_AdvertiseCredits (ARNETWORK_IOBuffer_t *IOBuffer);
+
+/**
+ * @brief Update the credits of an input buffer controlled by credits with the credits advertised by the peer
+ * @warning The IOBuffer mutex must lock before the calling of this function and unlock after.
+ * @param IOBuffer The input buffer
+ * @param[in] credits number of data the peer can store
+ */
+void ARNETWORK_IOBuffer_CreditsReceived (ARNETWORK_IOBuffer_t *IOBuffer, int credits);
+
+/**
+ * @brief Check if an input buffer has the credits to send a data
+ * @warning The IOBuffer mutex must lock before the calling of this function and unlock after.
+ * @param IOBuffer The input buffer
+ * @return 1 if a data can be sent, otherwise 0 (always 1 for a buffer not controlled by credits)
+ */
+static inline int ARNETWORK_IOBuffer_HasCredit (ARNETWORK_IOBuffer_t *IOBuffer)
+{
+    return ((!IOBuffer->isCreditFlowControlled) || (IOBuffer->credits != 0));
+}
+
+/**
+ * @brief Consume the credits of the data sent by an input buffer
+ * @warning The IOBuffer mutex must lock before the calling of this function and unlock after.
+ * @param IOBuffer The input buffer
+ * @param[in] numberOfData number of data sent
+ */
+void ARNETWORK_IOBuffer_ConsumeCredits (ARNETWORK_IOBuffer_t *IOBuffer, int numberOfData);
+
+/**
+ * @brief Write the header of a fragment
+ * @param[out] header pointer on the beginning of the frame data, of ARNETWORK_IOBUFFER_FRAGMENT_HEADER_SIZE bytes at least
+ * @param[in] messageNumber number of the message
+ * @param[in] fragmentIndex index of the fragment in the message
+ * @param[in] numberOfFragments number of fragments of the message
+ * @param[in] fragmentSize size of all the fragments of the message, except the last one
+ * @return number of bytes written
+ */
+int ARNETWORK_IOBuffer_WriteFragmentHeader (uint8_t *header, uint8_t messageNumber, int fragmentIndex, int numberOfFragments, int fragmentSize);
+
+/**
+ * @brief Read the header of a fragment
+ * @param[in] frameData data of the frame received
+ * @param[in] frameDataSize size of the data of the frame
+ * @param[out] messageNumber number of the message
+ * @param[out] fragmentIndex index of the fragment in the message
+ * @param[out] numberOfFragments number of fragments of the message
+ * @param[out] fragmentSize size of all the fragments of the message, except the last one
+ * @return number of bytes read, or -1 if the header is malformed
+ */
+int ARNETWORK_IOBuffer_ReadFragmentHeader (const uint8_t *frameData, int frameDataSize, uint8_t *messageNumber, int *fragmentIndex, int *numberOfFragments, int *fragmentSize);
+
+/**
+ * @brief Check if a fragmenting input buffer can send a new fragment
+ * @warning The IOBuffer mutex must lock before the calling of this function and unlock after.
+ * @param IOBuffer The input buffer
+ * @return 1 if a message must be started or if its next fragment is in the window of the fragments waiting their acknowledgement, otherwise 0 (always 0 for a buffer not fragmenting)
+ */
+int ARNETWORK_IOBuffer_CanSendFragment (ARNETWORK_IOBuffer_t *IOBuffer);
+
+/**
+ * @brief Allocate the memory to reassemble the messages of a fragmenting output buffer
+ * @details The memory is allocated in the arena of the buffer, if any.
+ * @param IOBuffer The output buffer
+ * @return error eARNETWORK_ERROR
+ */
+eARNETWORK_ERROR ARNETWORK_IOBuffer_NewReassembly (ARNETWORK_IOBuffer_t *IOBuffer);
+
+/**
+ * @brief Add a fragment received to the message being reassembled by an output buffer
+ * @details A fragment of another message abandons the message being reassembled ; the fragments of the last message reassembled are ignored.
+ * @warning The IOBuffer mutex must lock before the calling of this function and unlock after.
+ * @param IOBuffer The output buffer
+ * @param[in] messageNumber number of the message
+ * @param[in] fragmentIndex index of the fragment in the message
+ * @param[in] numberOfFragments number of fragments of the message
+ * @param[in] fragmentSize size of all the fragments of the message, except the last one
+ * @param[in] data data of the fragment
+ * @param[in] dataSize size of the data of the fragment
+ * @param[out] isComplete set to 1 if the message is complete, in reassemblyData, otherwise 0 ; see ARNETWORK_IOBuffer_EndReassembly()
+ * @return error eARNETWORK_ERROR ; ARNETWORK_ERROR_BUFFER_SIZE if the message is larger than dataCopyMaxSize
+ */
+eARNETWORK_ERROR ARNETWORK_IOBuffer_AddFragment (ARNETWORK_IOBuffer_t *IOBuffer, uint8_t messageNumber, int fragmentIndex, int numberOfFragments, int fragmentSize, const uint8_t *data, int dataSize, int *isComplete);
+
+/**
+ * @brief End the reassembly of the message complete ; its fragments received again are then ignored
+ * @details Until the end of its reassembly, a message complete is complete again at each of its fragments received, so its storage withheld by a full output buffer can be retried.
+ * @warning The IOBuffer mutex must lock before the calling of this function and unlock after.
+ * @param IOBuffer The output buffer
+ */
+void ARNETWORK_IOBuffer_EndReassembly (ARNETWORK_IOBuffer_t *IOBuffer);
+
 /**
  * @brief Asks an IOBuffer if it should accept a data with the given sequence number
  * @param IOBuffer The output buffer
@@ -202,11 +532,28 @@ int ARNETWORK_IOBuffer_ShouldAcceptData (ARNETWORK_IOBuffer_t *IOBuffer, uint8_t
  * @param IOBuffer The input or output buffer
  * @param[out] data The data read
  * @param[in] dataLimitSize limit size of the copy
- * @param[out] readSize pointer to store the size of the data read ; can be equal to NULL
- * @return error eARNETWORK_ERROR type
+ * @param[out] readSize pointer to store the size of the data read ; can be equal to NULL ; size needed if the data is larger than dataLimitSize
+ * @return error eARNETWORK_ERROR type ; ARNETWORK_ERROR_BUFFER_SIZE if the data is larger than dataLimitSize, the data is then not pop
  */
 eARNETWORK_ERROR ARNETWORK_IOBuffer_ReadData(ARNETWORK_IOBuffer_t *IOBuffer, uint8_t *data, int dataLimitSize, int *readSize);
 
+/**
+ * @brief lend the front data received in a IOBuffer, without copy
+ * @warning the data is not pop ; it must be released by ARNETWORK_IOBuffer_ReleaseData()
+ * @param IOBuffer The output buffer
+ * @param[out] data pointer to store the address of the data, in the storage of the IOBuffer
+ * @param[out] dataSize pointer to store the size of the data
+ * @return error eARNETWORK_ERROR type ; ARNETWORK_ERROR_IOBUFFER_DATA_BORROWED if a data is already borrowed
+ */
+eARNETWORK_ERROR ARNETWORK_IOBuffer_BorrowData(ARNETWORK_IOBuffer_t *IOBuffer, uint8_t **data, int *dataSize);
+
+/**
+ * @brief release the data borrowed by ARNETWORK_IOBuffer_BorrowData() and pop it
+ * @param IOBuffer The output buffer
+ * @return error eARNETWORK_ERROR type ; ARNETWORK_ERROR_BAD_PARAMETER if no data is borrowed
+ */
+eARNETWORK_ERROR ARNETWORK_IOBuffer_ReleaseData(ARNETWORK_IOBuffer_t *IOBuffer);
+
 /**
  * @brief Gets the estimated miss percentage of the buffer
  * This functions behavior is undefined on input buffer
@@ -215,4 +562,12 @@ eARNETWORK_ERROR ARNETWORK_IOBuffer_ReadData(ARNETWORK_IOBuffer_t *IOBuffer, uin
  */
 int ARNETWORK_IOBuffer_GetEstimatedMissPercentage (ARNETWORK_IOBuffer_t *IOBuffer);
 
+/**
+ * @brief Gets the memory allocated by the buffer
+ * @details The sum of the structure, of its ring buffers, of the sequence numbers of its fragments and of its reassembly memory.
+ * @param IOBuffer The ARNETWORK_IOBuffer_t
+ * @return Size in byte of the memory allocated by the buffer ; 0 if IOBuffer is NULL
+ */
+int ARNETWORK_IOBuffer_GetMemoryFootprint (ARNETWORK_IOBuffer_t *IOBuffer);
+
 #endif /** _ARNETWORK_IOBUFFER_PRIVATE_H_ */
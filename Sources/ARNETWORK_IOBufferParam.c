@@ -62,10 +62,17 @@
 #define ARNETWORK_IOBUFFER_DATA_TYPE_DEFAULT ARNETWORKAL_FRAME_TYPE_UNINITIALIZED
 #define ARNETWORK_IOBUFFER_SENDING_WAIT_TIME_DEFAULT 1
 #define ARNETWORK_IOBUFFER_ACK_TIMEOUT_MS_DEFAULT ARNETWORK_IOBUFFERPARAM_INFINITE_NUMBER
+#define ARNETWORK_IOBUFFER_SENDING_WAIT_TIME_US_DEFAULT 0
+#define ARNETWORK_IOBUFFER_ACK_TIMEOUT_US_DEFAULT 0
 #define ARNETWORK_IOBUFFER_NUMBER_OF_RETRY_DEFAULT ARNETWORK_IOBUFFERPARAM_INFINITE_NUMBER
 #define ARNETWORK_IOBUFFER_NUMBER_OF_CELL_DEFAULT 0
 #define ARNETWORK_IOBUFFER_MAX_SIZE_OF_DATA_COPY_DEFAULT 0
 #define ARNETWORK_IOBUFFER_OVERWRITING_DEFAULT 0
+#define ARNETWORK_IOBUFFER_SENDING_BURST_SIZE_DEFAULT 1
+#define ARNETWORK_IOBUFFER_AGGREGATING_DEFAULT 0
+#define ARNETWORK_IOBUFFER_FRAGMENTING_DEFAULT 0
+#define ARNETWORK_IOBUFFER_OVERFLOW_POLICY_DEFAULT ARNETWORK_IOBUFFERPARAM_OVERFLOW_POLICY_DEFAULT
+#define ARNETWORK_IOBUFFER_CREDIT_FLOW_CONTROLLED_DEFAULT 0
 
 /*****************************************
  *
@@ -91,6 +98,13 @@ eARNETWORK_ERROR ARNETWORK_IOBufferParam_DefaultInit (ARNETWORK_IOBufferParam_t
         IOBufferParam->numberOfCell = ARNETWORK_IOBUFFER_NUMBER_OF_CELL_DEFAULT;
         IOBufferParam->dataCopyMaxSize = ARNETWORK_IOBUFFER_MAX_SIZE_OF_DATA_COPY_DEFAULT;
         IOBufferParam->isOverwriting = ARNETWORK_IOBUFFER_OVERWRITING_DEFAULT;
+        IOBufferParam->isAggregating = ARNETWORK_IOBUFFER_AGGREGATING_DEFAULT;
+        IOBufferParam->isFragmenting = ARNETWORK_IOBUFFER_FRAGMENTING_DEFAULT;
+        IOBufferParam->overflowPolicy = ARNETWORK_IOBUFFER_OVERFLOW_POLICY_DEFAULT;
+        IOBufferParam->isCreditFlowControlled = ARNETWORK_IOBUFFER_CREDIT_FLOW_CONTROLLED_DEFAULT;
+        IOBufferParam->sendingWaitTimeUs = ARNETWORK_IOBUFFER_SENDING_WAIT_TIME_US_DEFAULT;
+        IOBufferParam->ackTimeoutUs = ARNETWORK_IOBUFFER_ACK_TIMEOUT_US_DEFAULT;
+        IOBufferParam->sendingBurstSize = ARNETWORK_IOBUFFER_SENDING_BURST_SIZE_DEFAULT;
     }
     else
     {
@@ -114,7 +128,20 @@ int ARNETWORK_IOBufferParam_Check (const ARNETWORK_IOBufferParam_t *IOBufferPara
         (IOBufferParam->dataType != ARNETWORKAL_FRAME_TYPE_UNINITIALIZED) &&
         (IOBufferParam->sendingWaitTimeMs >= 0) &&
         (IOBufferParam->ackTimeoutMs >= -1) &&
-        (IOBufferParam->numberOfRetry >= -1))
+        (IOBufferParam->numberOfRetry >= -1) &&
+        ((IOBufferParam->isAggregating == 0) || (IOBufferParam->isAggregating == 1)) &&
+        ((IOBufferParam->isFragmenting == 0) ||
+         ((IOBufferParam->isFragmenting == 1) &&
+          (IOBufferParam->dataType == ARNETWORKAL_FRAME_TYPE_DATA_WITH_ACK) &&
+          (IOBufferParam->isAggregating == 0) &&
+          (IOBufferParam->sendingBurstSize <= ARNETWORK_IOBUFFERPARAM_FRAGMENTING_WINDOW_MAX))) &&
+        (IOBufferParam->overflowPolicy >= ARNETWORK_IOBUFFERPARAM_OVERFLOW_POLICY_DEFAULT) &&
+        (IOBufferParam->overflowPolicy < ARNETWORK_IOBUFFERPARAM_OVERFLOW_POLICY_MAX) &&
+        ((IOBufferParam->isCreditFlowControlled == 0) ||
+         ((IOBufferParam->isCreditFlowControlled == 1) && (IOBufferParam->isFragmenting == 0))) &&
+        (IOBufferParam->sendingWaitTimeUs >= -1) &&
+        (IOBufferParam->ackTimeoutUs >= -1) &&
+        (IOBufferParam->sendingBurstSize >= 0))
     {
         ok = 1;
     }
@@ -131,7 +158,14 @@ values expected: \n\
     - numberOfRetry > 0 or -1 if not used  (value set: %d)\n\
     - numberOfCell > 0 (value set: %d)\n\
     - dataCopyMaxSize >= 0 (value set: %d)\n\
-    - isOverwriting = 0 or 1 (value set: %d)",
+    - isOverwriting = 0 or 1 (value set: %d)\n\
+    - isAggregating = 0 or 1 (value set: %d)\n\
+    - isFragmenting = 0 or 1 ; 1 only with dataType = %d, isAggregating = 0 and sendingBurstSize <= %d (value set: %d)\n\
+    - 0 <= overflowPolicy < %d (value set: %d)\n\
+    - isCreditFlowControlled = 0 or 1 ; 1 only with isFragmenting = 0 (value set: %d)\n\
+    - sendingWaitTimeUs > 0, or 0 or -1 if not used (value set: %d)\n\
+    - ackTimeoutUs > 0, or 0 or -1 if not used (value set: %d)\n\
+    - sendingBurstSize >= 1, or 0 for 1 (value set: %d)",
                      ARNETWORK_IOBUFFER_ID_MIN, ARNETWORK_IOBUFFER_ID_MAX, IOBufferParam->ID,
                      ARNETWORKAL_FRAME_TYPE_UNINITIALIZED, IOBufferParam->dataType,
                      IOBufferParam->sendingWaitTimeMs,
@@ -139,7 +173,14 @@ values expected: \n\
                      IOBufferParam->numberOfRetry,
                      IOBufferParam->numberOfCell,
                      IOBufferParam->dataCopyMaxSize,
-                     IOBufferParam->isOverwriting);
+                     IOBufferParam->isOverwriting,
+                     IOBufferParam->isAggregating,
+                     ARNETWORKAL_FRAME_TYPE_DATA_WITH_ACK, ARNETWORK_IOBUFFERPARAM_FRAGMENTING_WINDOW_MAX, IOBufferParam->isFragmenting,
+                     ARNETWORK_IOBUFFERPARAM_OVERFLOW_POLICY_MAX, IOBufferParam->overflowPolicy,
+                     IOBufferParam->isCreditFlowControlled,
+                     IOBufferParam->sendingWaitTimeUs,
+                     IOBufferParam->ackTimeoutUs,
+                     IOBufferParam->sendingBurstSize);
         }
         else
         {
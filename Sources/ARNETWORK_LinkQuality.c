@@ -0,0 +1,289 @@
+/*
+    Copyright (C) 2014 Parrot SA
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions
+    are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in
+      the documentation and/or other materials provided with the 
+      distribution.
+    * Neither the name of Parrot nor the names
+      of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written
+      permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+    "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+    LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+    FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+    COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+    INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+    BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+    OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED 
+    AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+    OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+    OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+    SUCH DAMAGE.
+*/
+/**
+ * @file ARNETWORK_LinkQuality.c
+ * @brief link quality of an output buffer over sliding windows: loss, burst loss and jitter
+ * @date 19/10/2026
+ **/
+
+/*****************************************
+ *
+ *             include file :
+ *
+ *****************************************/
+
+#include <stdlib.h>
+#include <string.h>
+
+#include <libARNetwork/ARNETWORK_Manager.h>
+
+#include "ARNETWORK_LinkQuality.h"
+
+/*****************************************
+ *
+ *             define :
+ *
+ *****************************************/
+
+/**
+ * Longest interval between two frames accounted by the jitter ; a longer interval is a pause of the traffic
+ */
+#define ARNETWORK_LINKQUALITY_MAX_INTERARRIVAL_US (1000000)
+
+/**
+ * Number of long buckets of the medium window
+ */
+#define ARNETWORK_LINKQUALITY_MEDIUM_WINDOW_S (10)
+
+/*****************************************
+ *
+ *             private header:
+ *
+ *****************************************/
+
+/**
+ * @brief clear the buckets of the periods elapsed between two ticks
+ * @param buckets the ring of buckets
+ * @param[in] numberOfBuckets number of buckets of the ring
+ * @param[in] fromTick tick of the current bucket
+ * @param[in] toTick tick of the new current bucket
+ */
+static void ARNETWORK_LinkQuality_ClearBuckets (ARNETWORK_LinkQuality_Bucket_t *buckets, int numberOfBuckets, int64_t fromTick, int64_t toTick);
+
+/**
+ * @brief move the current buckets to the current time
+ * @param linkQualityPtr the pointer on the link quality
+ * @param[in] now current time
+ */
+static void ARNETWORK_LinkQuality_Advance (ARNETWORK_LinkQuality_t *linkQualityPtr, const struct timespec *now);
+
+/**
+ * @brief add the frames of buckets to a sum
+ * @param[in] buckets the buckets to add
+ * @param[in] numberOfBuckets number of buckets to add
+ * @param sum the sum
+ */
+static void ARNETWORK_LinkQuality_SumBuckets (const ARNETWORK_LinkQuality_Bucket_t *buckets, int numberOfBuckets, ARNETWORK_LinkQuality_Bucket_t *sum);
+
+/**
+ * @brief compute the loss percentage of a sum of buckets
+ * @param[in] sum the sum of buckets
+ * @return the loss percentage [0-100], or -1 if no frame was expected
+ */
+static float ARNETWORK_LinkQuality_LossPercentage (const ARNETWORK_LinkQuality_Bucket_t *sum);
+
+/*****************************************
+ *
+ *             implementation :
+ *
+ *****************************************/
+
+void ARNETWORK_LinkQuality_Init (ARNETWORK_LinkQuality_t *linkQualityPtr)
+{
+    /** -- initialize the link quality -- */
+
+    memset (linkQualityPtr, 0, sizeof (ARNETWORK_LinkQuality_t));
+    linkQualityPtr->lastInterArrivalUs = -1;
+}
+
+void ARNETWORK_LinkQuality_OnFrame (ARNETWORK_LinkQuality_t *linkQualityPtr, uint8_t seq, const struct timespec *arrivalTime)
+{
+    /** -- account a frame received -- */
+
+    /** local declarations */
+    ARNETWORK_LinkQuality_Bucket_t *shortBucket = NULL;
+    ARNETWORK_LinkQuality_Bucket_t *longBucket = NULL;
+    int delta = 1;
+    int64_t interArrivalUs = 0;
+    int transitDiffUs = 0;
+
+    ARNETWORK_LinkQuality_Advance (linkQualityPtr, arrivalTime);
+    shortBucket = &(linkQualityPtr->shortBuckets[linkQualityPtr->shortTick % ARNETWORK_LINKQUALITY_NUMBER_OF_SHORT_BUCKETS]);
+    longBucket = &(linkQualityPtr->longBuckets[linkQualityPtr->longTick % ARNETWORK_LINKQUALITY_NUMBER_OF_LONG_BUCKETS]);
+
+    /** the difference of sequence numbers is signed, modulo 256 */
+    if (linkQualityPtr->isStarted)
+    {
+        delta = (int8_t) (seq - linkQualityPtr->highestSeq);
+    }
+
+    if (delta > 0)
+    {
+        shortBucket->numberOfReceived++;
+        longBucket->numberOfReceived++;
+        if (delta > 1)
+        {
+            /** the sequence numbers skipped are lost, in one burst */
+            shortBucket->numberOfLost += delta - 1;
+            shortBucket->numberOfLossBursts++;
+            longBucket->numberOfLost += delta - 1;
+            longBucket->numberOfLossBursts++;
+        }
+
+        /** J += (|D| - J) / 16 , computed on the jitter scaled by 16 */
+        if (linkQualityPtr->isStarted)
+        {
+            interArrivalUs = (int64_t) (arrivalTime->tv_sec - linkQualityPtr->lastArrivalTime.tv_sec) * 1000000 + (arrivalTime->tv_nsec - linkQualityPtr->lastArrivalTime.tv_nsec) / 1000;
+            if ((interArrivalUs < 0) || (interArrivalUs > ARNETWORK_LINKQUALITY_MAX_INTERARRIVAL_US))
+            {
+                linkQualityPtr->lastInterArrivalUs = -1;
+            }
+            else
+            {
+                if (linkQualityPtr->lastInterArrivalUs >= 0)
+                {
+                    transitDiffUs = abs ((int) interArrivalUs - linkQualityPtr->lastInterArrivalUs);
+                    linkQualityPtr->scaledJitterUs += transitDiffUs - ((linkQualityPtr->scaledJitterUs + 8) >> 4);
+                }
+                linkQualityPtr->lastInterArrivalUs = (int) interArrivalUs;
+            }
+        }
+
+        linkQualityPtr->isStarted = 1;
+        linkQualityPtr->highestSeq = seq;
+        linkQualityPtr->lastArrivalTime = *arrivalTime;
+    }
+    else if (delta == 0)
+    {
+        linkQualityPtr->numberOfDuplicates++;
+    }
+    else
+    {
+        linkQualityPtr->numberOfLate++;
+    }
+}
+
+void ARNETWORK_LinkQuality_Get (ARNETWORK_LinkQuality_t *linkQualityPtr, const struct timespec *now, ARNETWORK_Manager_LinkQuality_t *linkQuality)
+{
+    /** -- get the link quality over the sliding windows -- */
+
+    /** local declarations */
+    ARNETWORK_LinkQuality_Bucket_t sum;
+    int tickIndex = 0;
+
+    ARNETWORK_LinkQuality_Advance (linkQualityPtr, now);
+
+    /** last second */
+    memset (&sum, 0, sizeof (sum));
+    ARNETWORK_LinkQuality_SumBuckets (linkQualityPtr->shortBuckets, ARNETWORK_LINKQUALITY_NUMBER_OF_SHORT_BUCKETS, &sum);
+    linkQuality->lossPercentage1s = ARNETWORK_LinkQuality_LossPercentage (&sum);
+
+    /** last ten seconds */
+    memset (&sum, 0, sizeof (sum));
+    for (tickIndex = 0; tickIndex < ARNETWORK_LINKQUALITY_MEDIUM_WINDOW_S; tickIndex++)
+    {
+        ARNETWORK_LinkQuality_SumBuckets (&(linkQualityPtr->longBuckets[(linkQualityPtr->longTick - tickIndex) % ARNETWORK_LINKQUALITY_NUMBER_OF_LONG_BUCKETS]), 1, &sum);
+    }
+    linkQuality->lossPercentage10s = ARNETWORK_LinkQuality_LossPercentage (&sum);
+
+    /** last minute */
+    memset (&sum, 0, sizeof (sum));
+    ARNETWORK_LinkQuality_SumBuckets (linkQualityPtr->longBuckets, ARNETWORK_LINKQUALITY_NUMBER_OF_LONG_BUCKETS, &sum);
+    linkQuality->lossPercentage60s = ARNETWORK_LinkQuality_LossPercentage (&sum);
+    linkQuality->meanLossBurstLength = (sum.numberOfLossBursts > 0) ? (float) sum.numberOfLost / sum.numberOfLossBursts : 0.0f;
+
+    linkQuality->jitterUs = linkQualityPtr->scaledJitterUs >> 4;
+    linkQuality->numberOfDuplicates = linkQualityPtr->numberOfDuplicates;
+    linkQuality->numberOfLate = linkQualityPtr->numberOfLate;
+}
+
+/*****************************************
+ *
+ *             private implementation:
+ *
+ *****************************************/
+
+static void ARNETWORK_LinkQuality_ClearBuckets (ARNETWORK_LinkQuality_Bucket_t *buckets, int numberOfBuckets, int64_t fromTick, int64_t toTick)
+{
+    /** -- clear the buckets of the periods elapsed -- */
+
+    /** local declarations */
+    int64_t tick = 0;
+
+    if (toTick - fromTick >= numberOfBuckets)
+    {
+        /** all the ring has elapsed */
+        memset (buckets, 0, numberOfBuckets * sizeof (ARNETWORK_LinkQuality_Bucket_t));
+    }
+    else
+    {
+        for (tick = fromTick + 1; tick <= toTick; tick++)
+        {
+            memset (&(buckets[tick % numberOfBuckets]), 0, sizeof (ARNETWORK_LinkQuality_Bucket_t));
+        }
+    }
+}
+
+static void ARNETWORK_LinkQuality_Advance (ARNETWORK_LinkQuality_t *linkQualityPtr, const struct timespec *now)
+{
+    /** -- move the current buckets to the current time -- */
+
+    /** local declarations */
+    int64_t shortTick = (int64_t) now->tv_sec * (1000 / ARNETWORK_LINKQUALITY_SHORT_BUCKET_MS) + now->tv_nsec / (ARNETWORK_LINKQUALITY_SHORT_BUCKET_MS * 1000000);
+    int64_t longTick = now->tv_sec;
+
+    /** the time of the monotonic clock never goes back */
+    if (shortTick > linkQualityPtr->shortTick)
+    {
+        ARNETWORK_LinkQuality_ClearBuckets (linkQualityPtr->shortBuckets, ARNETWORK_LINKQUALITY_NUMBER_OF_SHORT_BUCKETS, linkQualityPtr->shortTick, shortTick);
+        linkQualityPtr->shortTick = shortTick;
+    }
+    if (longTick > linkQualityPtr->longTick)
+    {
+        ARNETWORK_LinkQuality_ClearBuckets (linkQualityPtr->longBuckets, ARNETWORK_LINKQUALITY_NUMBER_OF_LONG_BUCKETS, linkQualityPtr->longTick, longTick);
+        linkQualityPtr->longTick = longTick;
+    }
+}
+
+static void ARNETWORK_LinkQuality_SumBuckets (const ARNETWORK_LinkQuality_Bucket_t *buckets, int numberOfBuckets, ARNETWORK_LinkQuality_Bucket_t *sum)
+{
+    /** -- add the frames of buckets to a sum -- */
+
+    /** local declarations */
+    int bucketIndex = 0;
+
+    for (bucketIndex = 0; bucketIndex < numberOfBuckets; bucketIndex++)
+    {
+        sum->numberOfReceived += buckets[bucketIndex].numberOfReceived;
+        sum->numberOfLost += buckets[bucketIndex].numberOfLost;
+        sum->numberOfLossBursts += buckets[bucketIndex].numberOfLossBursts;
+    }
+}
+
+static float ARNETWORK_LinkQuality_LossPercentage (const ARNETWORK_LinkQuality_Bucket_t *sum)
+{
+    /** -- compute the loss percentage of a sum of buckets -- */
+
+    /** local declarations */
+    uint32_t numberOfExpected = sum->numberOfReceived + sum->numberOfLost;
+
+    return (numberOfExpected > 0) ? (100.0f * sum->numberOfLost) / numberOfExpected : -1.0f;
+}
@@ -0,0 +1,115 @@
+/*
+    Copyright (C) 2014 Parrot SA
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions
+    are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in
+      the documentation and/or other materials provided with the 
+      distribution.
+    * Neither the name of Parrot nor the names
+      of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written
+      permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+    "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+    LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+    FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+    COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+    INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+    BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+    OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED 
+    AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+    OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+    OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+    SUCH DAMAGE.
+*/
+/**
+ * @file ARNETWORK_LinkQuality.h
+ * @brief link quality of an output buffer over sliding windows: loss, burst loss and jitter
+ * @date 19/10/2026
+ */
+
+#ifndef _ARNETWORK_LINKQUALITY_PRIVATE_H_
+#define _ARNETWORK_LINKQUALITY_PRIVATE_H_
+
+#include <stdint.h>
+#include <time.h>
+#include <libARNetwork/ARNETWORK_Manager.h>
+
+/**
+ * Number of buckets of ARNETWORK_LINKQUALITY_SHORT_BUCKET_MS milliseconds, covering the last second
+ */
+#define ARNETWORK_LINKQUALITY_NUMBER_OF_SHORT_BUCKETS (10)
+
+/**
+ * Duration of a short bucket, in millisecond
+ */
+#define ARNETWORK_LINKQUALITY_SHORT_BUCKET_MS (100)
+
+/**
+ * Number of buckets of one second, covering the last minute
+ */
+#define ARNETWORK_LINKQUALITY_NUMBER_OF_LONG_BUCKETS (60)
+
+/**
+ * @brief frames received and lost during the period of a bucket
+ */
+typedef struct
+{
+    uint32_t numberOfReceived; /**< number of frames received */
+    uint32_t numberOfLost; /**< number of frames lost, from the gaps of the sequence numbers */
+    uint32_t numberOfLossBursts; /**< number of gaps of the sequence numbers */
+
+}ARNETWORK_LinkQuality_Bucket_t;
+
+/**
+ * @brief link quality of an output buffer
+ * @details The frames received and lost are counted in two rings of buckets: ten buckets of 100 ms for the last second, and sixty buckets of one second for the last minute.
+ * The buckets elapsed are cleared on the next frame or query, so the cost is constant whatever the traffic.
+ * The jitter follows the RFC 3550 estimator; the frames don't carry their sending time, so the transit time difference is estimated by the variation of the interval between two arrivals.
+ * @warning before to be used the link quality must be initialized through ARNETWORK_LinkQuality_Init()
+ */
+typedef struct
+{
+    ARNETWORK_LinkQuality_Bucket_t shortBuckets[ARNETWORK_LINKQUALITY_NUMBER_OF_SHORT_BUCKETS]; /**< buckets of the last second */
+    ARNETWORK_LinkQuality_Bucket_t longBuckets[ARNETWORK_LINKQUALITY_NUMBER_OF_LONG_BUCKETS]; /**< buckets of the last minute */
+    int64_t shortTick; /**< index of the short period of the current short bucket */
+    int64_t longTick; /**< index of the second of the current long bucket */
+    int isStarted; /**< Indicator of a first frame received (1 = true | 0 = false)*/
+    uint8_t highestSeq; /**< highest sequence number received */
+    struct timespec lastArrivalTime; /**< arrival time of the last new frame */
+    int lastInterArrivalUs; /**< interval between the two last new frames, in microsecond ; negative if unknown */
+    int scaledJitterUs; /**< jitter in microsecond, scaled by 16 as in RFC 3550 */
+    uint32_t numberOfDuplicates; /**< number of frames received with the highest sequence number again */
+    uint32_t numberOfLate; /**< number of frames received after a frame of higher sequence number */
+
+}ARNETWORK_LinkQuality_t;
+
+/**
+ * @brief initialize the link quality, without frame received
+ * @param linkQualityPtr the pointer on the link quality
+ */
+void ARNETWORK_LinkQuality_Init (ARNETWORK_LinkQuality_t *linkQualityPtr);
+
+/**
+ * @brief account a frame received
+ * @param linkQualityPtr the pointer on the link quality
+ * @param[in] seq sequence number of the frame
+ * @param[in] arrivalTime time of the reception of the frame
+ */
+void ARNETWORK_LinkQuality_OnFrame (ARNETWORK_LinkQuality_t *linkQualityPtr, uint8_t seq, const struct timespec *arrivalTime);
+
+/**
+ * @brief get the link quality over the sliding windows
+ * @param linkQualityPtr the pointer on the link quality
+ * @param[in] now current time
+ * @param[out] linkQuality pointer on the link quality to fill
+ */
+void ARNETWORK_LinkQuality_Get (ARNETWORK_LinkQuality_t *linkQualityPtr, const struct timespec *now, ARNETWORK_Manager_LinkQuality_t *linkQuality);
+
+#endif /** _ARNETWORK_LINKQUALITY_PRIVATE_H_ */
@@ -42,6 +42,7 @@
  *****************************************/
 
 #include <stdlib.h>
+#include <limits.h>
 
 #include <inttypes.h>
 #include <stddef.h>
@@ -62,6 +63,9 @@
 #include "ARNETWORK_IOBuffer.h"
 #include "ARNETWORK_Sender.h"
 #include "ARNETWORK_Receiver.h"
+#include "ARNETWORK_Notifier.h"
+#include "ARNETWORK_Trace.h"
+#include "ARNETWORK_CompletionQueue.h"
 
 #include <libARNetwork/ARNETWORK_Manager.h>
 #include "ARNETWORK_Manager.h"
@@ -73,6 +77,7 @@
  *****************************************/
 
 #define ARNETWORK_MANAGER_TAG "ARNETWORK_Manager"
+#define ARNETWORK_MANAGER_COALESCED_ACK_NUMBER_OF_CELLS (4)
 
 /*****************************************
  *
@@ -80,6 +85,31 @@
  *
  *****************************************/
 
+/**
+ * @brief create a new Manager
+ * @param[in] memoryBudget Maximum memory, in byte, the Manager can allocate ; 0 to not limit it
+ * @param arena arena in which the Manager and its buffers are allocated, deleted with the Manager or at once if an error occurred ; NULL to allocate them by malloc()
+ * @return the new Manager ; NULL if an error occurred
+ * @see ARNETWORK_Manager_NewWithMemoryBudget()
+ * @see ARNETWORK_Manager_NewWithArena()
+ */
+ARNETWORK_Manager_t* ARNETWORK_Manager_Create (ARNETWORKAL_Manager_t *networkALManager, unsigned int numberOfInput, ARNETWORK_IOBufferParam_t *inputParamArr, unsigned int numberOfOutput, ARNETWORK_IOBufferParam_t *outputParamArr, int pingDelayMs, ARNETWORK_Manager_OnDisconnect_t onDisconnectCallback, void* customData, int memoryBudget, ARNETWORK_Arena_t *arena, eARNETWORK_ERROR *error);
+
+/**
+ * @brief initialize the parameters of the internal buffers
+ * @param alManager The networkAL manager
+ * @param[out] pingParam parameters of the ping and pong buffers, without identifier
+ * @param[out] coalescedAckParam parameters of the coalesced acknowledgments buffer
+ */
+void ARNETWORK_Manager_InitInternalParams (ARNETWORKAL_Manager_t *alManager, ARNETWORK_IOBufferParam_t *pingParam, ARNETWORK_IOBufferParam_t *coalescedAckParam);
+
+/**
+ * @brief initialize the parameters of the buffer of acknowledgement of an output buffer
+ * @param[out] ackParam parameters of the buffer of acknowledgement, without identifier
+ * @param[in] isFragmenting fragmentation of the output buffer (1 = true | 0 = false)
+ */
+void ARNETWORK_Manager_InitAckParam (ARNETWORK_IOBufferParam_t *ackParam, int isFragmenting);
+
 /**
  * @brief create manager's IOBuffers.
  * @warning only call by ARNETWORK_Manager_New()
@@ -92,6 +122,129 @@
  */
 eARNETWORK_ERROR ARNETWORK_Manager_CreateIOBuffer (ARNETWORK_Manager_t *manager, ARNETWORK_IOBufferParam_t *inputParamArray, ARNETWORK_IOBufferParam_t *outputParamArray);
 
+/**
+ * @brief create an output buffer and its buffer of acknowledgement
+ * @param manager The Manager
+ * @param[in] outputParam parameters of creation of the output buffer
+ * @param arena arena in which the buffers are allocated ; NULL to allocate them by malloc()
+ * @param[out] outputBufferPtrAddr address to store the output buffer ; NULL if an error occurred
+ * @param[out] ackBufferPtrAddr address to store the buffer of acknowledgement ; NULL if an error occurred
+ * @return error equal to ARNETWORK_OK if the IOBuffers are correctly created otherwise see eARNETWORK_ERROR.
+ */
+eARNETWORK_ERROR ARNETWORK_Manager_NewOutputBuffer (ARNETWORK_Manager_t *manager, ARNETWORK_IOBufferParam_t *outputParam, ARNETWORK_Arena_t *arena, ARNETWORK_IOBuffer_t **outputBufferPtrAddr, ARNETWORK_IOBuffer_t **ackBufferPtrAddr);
+
+/**
+ * @brief create an input buffer
+ * @param manager The Manager
+ * @param[in] inputParam parameters of creation of the input buffer
+ * @param arena arena in which the buffer is allocated ; NULL to allocate it by malloc()
+ * @param[out] error error output
+ * @return the input buffer ; NULL if an error occurred
+ */
+ARNETWORK_IOBuffer_t* ARNETWORK_Manager_NewInputBuffer (ARNETWORK_Manager_t *manager, ARNETWORK_IOBufferParam_t *inputParam, ARNETWORK_Arena_t *arena, eARNETWORK_ERROR *error);
+
+/**
+ * @brief Add data gathered from several pieces to send in a IOBuffer, waiting while the IOBuffer is full
+ * @param manager The Manager
+ * @param[in] inputBufferID identifier of the input buffer in which the data must be stored
+ * @param[in] iov array of the pieces of the data to send
+ * @param[in] iovcnt number of pieces
+ * @param[in] customData custom data sent to the callback
+ * @param[in] callback pointer on the callback to call when the data is sent or an error occurred
+ * @param[in] doDataCopy indicator to copy the data in the ARNETWORK_Manager
+ * @param[in] timeoutMs maximum time, in millisecond, to wait a free cell of the IOBuffer ; 0 to not wait
+ * @return error eARNETWORK_ERROR ; ARNETWORK_ERROR_BUFFER_SIZE if the IOBuffer is still full at the timeout
+ */
+eARNETWORK_ERROR ARNETWORK_Manager_AddData (ARNETWORK_Manager_t *manager, int inputBufferID, const struct iovec *iov, int iovcnt, void *customData, ARNETWORK_Manager_Callback_t callback, int doDataCopy, int timeoutMs);
+
+/**
+ * @brief wait the end of the current processing of the sender and the receiver, and block their next one
+ * @post ARNETWORK_Manager_UnlockBuffers() must be called to resume the processing
+ * @param manager The Manager
+ */
+void ARNETWORK_Manager_LockBuffers (ARNETWORK_Manager_t *manager);
+
+/**
+ * @brief give the arrays of buffers, possibly reallocated, to the sender and the receiver, then resume their processing
+ * @param manager The Manager
+ * @see ARNETWORK_Manager_LockBuffers()
+ */
+void ARNETWORK_Manager_UnlockBuffers (ARNETWORK_Manager_t *manager);
+
+/**
+ * @brief get a buffer by its identifier, and hold it until ARNETWORK_Manager_ReleaseBuffer() ; a buffer held is not deleted by its removal
+ * @param manager The Manager
+ * @param bufferMap inputBufferMap or outputBufferMap of the Manager
+ * @param[in] bufferID identifier of the buffer
+ * @return the buffer, or NULL if the identifier is unknown
+ * @see ARNETWORK_Manager_ReleaseBuffer()
+ */
+ARNETWORK_IOBuffer_t* ARNETWORK_Manager_AcquireBuffer (ARNETWORK_Manager_t *manager, ARNETWORK_IOBuffer_t **bufferMap, int bufferID);
+
+/**
+ * @brief stop holding a buffer ; a buffer removed from the Manager is deleted once no more held
+ * @warning the buffer must not be locked
+ * @param manager The Manager
+ * @param buffer The buffer got by ARNETWORK_Manager_AcquireBuffer() ; can be NULL
+ * @see ARNETWORK_Manager_AcquireBuffer()
+ */
+void ARNETWORK_Manager_ReleaseBuffer (ARNETWORK_Manager_t *manager, ARNETWORK_IOBuffer_t *buffer);
+
+/**
+ * @brief mark a buffer removed from the Manager, and wake up its producers and readers waiting ; they return ARNETWORK_ERROR_ID_UNKNOWN
+ * @pre the buffers must be locked by ARNETWORK_Manager_LockBuffers()
+ * @param buffer The buffer
+ * @return error eARNETWORK_ERROR ; ARNETWORK_ERROR_IOBUFFER_DATA_BORROWED, the buffer being not marked, if a data of the buffer is borrowed
+ */
+eARNETWORK_ERROR ARNETWORK_Manager_MarkBufferRemoved (ARNETWORK_IOBuffer_t *buffer);
+
+/**
+ * @brief compute the memory allocated by the Manager
+ * @pre the threads of the Manager must not be started, or the buffers must be locked by ARNETWORK_Manager_LockBuffers()
+ * @param manager The Manager
+ * @param[out] footprintArray array to store the memory allocated by each buffer ; can be NULL if maxNumberOfFootprints is 0
+ * @param[in] maxNumberOfFootprints size of footprintArray
+ * @param[out] numberOfFootprints pointer to store the number of buffers of the Manager ; can be NULL
+ * @return size in byte of the memory allocated by the Manager
+ * @see ARNETWORK_Manager_GetMemoryFootprint()
+ */
+int ARNETWORK_Manager_ComputeMemoryFootprint (ARNETWORK_Manager_t *manager, ARNETWORK_Manager_BufferFootprint_t *footprintArray, int maxNumberOfFootprints, int *numberOfFootprints);
+
+/**
+ * @brief store the memory allocated by a buffer in the breakdown of the memory of the Manager
+ * @param buffer The buffer ; can be NULL
+ * @param[in] kind kind of the buffer
+ * @param[out] footprintArray array to store the memory allocated by each buffer
+ * @param[in] maxNumberOfFootprints size of footprintArray
+ * @param[in,out] numberOfFootprints number of buffers already counted, incremented if buffer is not NULL
+ * @return size in byte of the memory allocated by the buffer
+ */
+int ARNETWORK_Manager_AddBufferFootprint (ARNETWORK_IOBuffer_t *buffer, eARNETWORK_MANAGER_BUFFER_KIND kind, ARNETWORK_Manager_BufferFootprint_t *footprintArray, int maxNumberOfFootprints, int *numberOfFootprints);
+
+/**
+ * @brief compute the memory that ARNETWORK_Manager_Create() will allocate, from the parameters of the buffers
+ * @details Same sum as ARNETWORK_Manager_ComputeMemoryFootprint() once the Manager is created, to check the memory budget before any allocation.
+ * @param networkALManager manager of the network abstraction layer
+ * @param[in] numberOfInput number of input buffers
+ * @param[in] inputParamArr array of the parameters of creation of the inputs
+ * @param[in] numberOfOutput number of output buffers
+ * @param[in] outputParamArr array of the parameters of creation of the outputs
+ * @return size in byte of the memory allocated by the creation of the Manager
+ * @see ARNETWORK_Manager_GetArenaSize()
+ */
+size_t ARNETWORK_Manager_GetNewMemoryFootprint (ARNETWORKAL_Manager_t *networkALManager, unsigned int numberOfInput, ARNETWORK_IOBufferParam_t *inputParamArr, unsigned int numberOfOutput, ARNETWORK_IOBufferParam_t *outputParamArr);
+
+/**
+ * @brief compute the memory that the creation of an input buffer, or of an output buffer and its buffer of acknowledgement, will allocate
+ * @param networkALManager manager of the network abstraction layer
+ * @param[in] param parameters of creation of the buffer
+ * @param[in] isOutput 1 for an output buffer and its buffer of acknowledgement ; 0 for an input buffer
+ * @return size in byte
+ * @see ARNETWORK_Manager_NewOutputBuffer()
+ * @see ARNETWORK_Manager_NewInputBuffer()
+ */
+size_t ARNETWORK_Manager_GetBufferNewMemoryFootprint (ARNETWORKAL_Manager_t *networkALManager, const ARNETWORK_IOBufferParam_t *param, int isOutput);
+
 /**
  * @brief function called on disconnect
  * @param manager The networkAL manager
@@ -99,6 +252,168 @@ eARNETWORK_ERROR ARNETWORK_Manager_CreateIOBuffer (ARNETWORK_Manager_t *manager,
  */
 void ARNETWORK_Manager_OnDisconnect (ARNETWORKAL_Manager_t *alManager, void *customData);
 
+/**
+ * @brief read the data available in an output buffer under one lock
+ * @warning only call by the ARNETWORK_Manager_ReadDataBatch() functions
+ * @pre the semaphore of the first data must be taken ; the semaphore of each other data is taken before to read it
+ * @param outputBuffer The output buffer
+ * @param[out] arena arena in which the data are copied
+ * @param[in] arenaSize size of the arena
+ * @param[out] recordArray array of records to store the offset and the size of each data read
+ * @param[in] maxNumberOfRecords size of recordArray
+ * @param[out] numberOfRecords pointer to store the number of data read
+ * @return error equal to ARNETWORK_OK if at least one data is read otherwise see eARNETWORK_ERROR.
+ * @see ARNETWORK_Manager_ReadDataBatch()
+ */
+eARNETWORK_ERROR ARNETWORK_Manager_EnableCompletionQueue (ARNETWORK_Manager_t *manager, int numberOfCompletions)
+{
+    /** -- Enable the completion queue of the data sent -- */
+
+    /** local declarations */
+    eARNETWORK_ERROR error = ARNETWORK_OK;
+    ARNETWORK_CompletionQueue_t *completionQueue = NULL;
+    int bufferIndex = 0;
+
+    if ((manager == NULL) ||
+        (numberOfCompletions <= 0) ||
+        (numberOfCompletions > ARNETWORK_COMPLETIONQUEUE_NUMBER_OF_COMPLETIONS_MAX))
+    {
+        return ARNETWORK_ERROR_BAD_PARAMETER;
+    }
+
+    ARNETWORK_Manager_LockBuffers (manager);
+
+    if (manager->completionQueue != NULL)
+    {
+        error = ARNETWORK_ERROR_BAD_PARAMETER;
+    }
+
+    /** the queue must fit in the memory budget */
+    if ((error == ARNETWORK_OK) &&
+        (manager->memoryBudget > 0) &&
+        (ARNETWORK_Manager_ComputeMemoryFootprint (manager, NULL, 0, NULL) + ARNETWORK_CompletionQueue_GetMemoryFootprint (NULL, numberOfCompletions) > manager->memoryBudget))
+    {
+        error = ARNETWORK_ERROR_MANAGER_MEMORY_BUDGET;
+    }
+
+    if (error == ARNETWORK_OK)
+    {
+        completionQueue = ARNETWORK_CompletionQueue_New (numberOfCompletions, &error);
+    }
+
+    if (error == ARNETWORK_OK)
+    {
+        manager->completionQueue = completionQueue;
+
+        /** the completions of the data already added are queued too */
+        for (bufferIndex = 0; bufferIndex < manager->numberOfInputWithoutAck; bufferIndex++)
+        {
+            ARNETWORK_IOBuffer_Lock (manager->inputBufferArray[bufferIndex]);
+            manager->inputBufferArray[bufferIndex]->completionQueuePtr = completionQueue;
+            ARNETWORK_IOBuffer_Unlock (manager->inputBufferArray[bufferIndex]);
+        }
+    }
+
+    ARNETWORK_Manager_UnlockBuffers (manager);
+
+    return error;
+}
+
+int ARNETWORK_Manager_GetCompletionFd (ARNETWORK_Manager_t *manager)
+{
+    /** -- Get the file descriptor readable when completions are waiting to be drained -- */
+
+    if ((manager == NULL) || (manager->completionQueue == NULL))
+    {
+        return ARNETWORK_ERROR_BAD_PARAMETER;
+    }
+
+    return manager->completionQueue->notifierPtr->readFd;
+}
+
+eARNETWORK_ERROR ARNETWORK_Manager_DrainCompletions (ARNETWORK_Manager_t *manager, ARNETWORK_Manager_Completion_t *completionArray, int maxNumberOfCompletions, int *numberOfCompletions)
+{
+    /** -- Drain the completions of the data sent -- */
+
+    /** local declarations */
+    eARNETWORK_ERROR error = ARNETWORK_OK;
+    int localNumberOfCompletions = 0;
+
+    /** check paratemters */
+    if ((manager == NULL) ||
+        (manager->completionQueue == NULL) ||
+        (completionArray == NULL) ||
+        (maxNumberOfCompletions <= 0) ||
+        (numberOfCompletions == NULL))
+    {
+        error = ARNETWORK_ERROR_BAD_PARAMETER;
+    }
+
+    if (error == ARNETWORK_OK)
+    {
+        localNumberOfCompletions = ARNETWORK_CompletionQueue_Drain (manager->completionQueue, completionArray, maxNumberOfCompletions);
+        if (localNumberOfCompletions == 0)
+        {
+            error = ARNETWORK_ERROR_BUFFER_EMPTY;
+        }
+    }
+
+    if (numberOfCompletions != NULL)
+    {
+        *numberOfCompletions = localNumberOfCompletions;
+    }
+
+    return error;
+}
+
+eARNETWORK_ERROR ARNETWORK_Manager_SetTimeoutPolicy (ARNETWORK_Manager_t *manager, int inputBufferID, eARNETWORK_MANAGER_CALLBACK_RETURN policy)
+{
+    /** -- Sets the decision taken on a timeout of an input buffer whose completions are queued -- */
+
+    /** local declarations */
+    eARNETWORK_ERROR error = ARNETWORK_OK;
+    ARNETWORK_IOBuffer_t *inputBuffer = NULL;
+
+    /** check paratemters */
+    if ((manager != NULL) &&
+        (inputBufferID >= 0) &&
+        (inputBufferID < manager->networkALManager->maxIds) &&
+        ((policy == ARNETWORK_MANAGER_CALLBACK_RETURN_DATA_POP) ||
+         (policy == ARNETWORK_MANAGER_CALLBACK_RETURN_RETRY) ||
+         (policy == ARNETWORK_MANAGER_CALLBACK_RETURN_FLUSH)))
+    {
+        /** get the address of the inputBuffer */
+        inputBuffer = ARNETWORK_Manager_AcquireBuffer (manager, manager->inputBufferMap, inputBufferID);
+
+        /** check inputBuffer */
+        if (inputBuffer == NULL)
+        {
+            error = ARNETWORK_ERROR_ID_UNKNOWN;
+        }
+    }
+    else
+    {
+        error = ARNETWORK_ERROR_BAD_PARAMETER;
+    }
+
+    if (error == ARNETWORK_OK)
+    {
+        error = ARNETWORK_IOBuffer_Lock (inputBuffer);
+    }
+
+    if (error == ARNETWORK_OK)
+    {
+        inputBuffer->timeoutPolicy = policy;
+        ARNETWORK_IOBuffer_Unlock (inputBuffer);
+    }
+
+    ARNETWORK_Manager_ReleaseBuffer (manager, inputBuffer);
+
+    return error;
+}
+
+eARNETWORK_ERROR ARNETWORK_Manager_ReadDataBatchLocked (ARNETWORK_IOBuffer_t *outputBuffer, uint8_t *arena, int arenaSize, ARNETWORK_Manager_DataRecord_t *recordArray, int maxNumberOfRecords, int *numberOfRecords);
+
 /*****************************************
  *
  *             implementation :
@@ -106,6 +421,128 @@ void ARNETWORK_Manager_OnDisconnect (ARNETWORKAL_Manager_t *alManager, void *cus
  *****************************************/
 
 ARNETWORK_Manager_t* ARNETWORK_Manager_New (ARNETWORKAL_Manager_t *networkALManager, unsigned int numberOfInput, ARNETWORK_IOBufferParam_t *inputParamArr, unsigned int numberOfOutput, ARNETWORK_IOBufferParam_t *outputParamArr, int pingDelayMs, ARNETWORK_Manager_OnDisconnect_t onDisconnectCallback, void* customData, eARNETWORK_ERROR *error)
+{
+    /* -- Create a new Manager without memory budget -- */
+
+    return ARNETWORK_Manager_NewWithMemoryBudget (networkALManager, numberOfInput, inputParamArr, numberOfOutput, outputParamArr, pingDelayMs, onDisconnectCallback, customData, 0, error);
+}
+
+ARNETWORK_Manager_t* ARNETWORK_Manager_NewWithMemoryBudget (ARNETWORKAL_Manager_t *networkALManager, unsigned int numberOfInput, ARNETWORK_IOBufferParam_t *inputParamArr, unsigned int numberOfOutput, ARNETWORK_IOBufferParam_t *outputParamArr, int pingDelayMs, ARNETWORK_Manager_OnDisconnect_t onDisconnectCallback, void* customData, int memoryBudget, eARNETWORK_ERROR *error)
+{
+    /* -- Create a new Manager with a memory budget -- */
+
+    return ARNETWORK_Manager_Create (networkALManager, numberOfInput, inputParamArr, numberOfOutput, outputParamArr, pingDelayMs, onDisconnectCallback, customData, memoryBudget, NULL, error);
+}
+
+int ARNETWORK_Manager_GetArenaSize (ARNETWORKAL_Manager_t *networkALManager, unsigned int numberOfInput, ARNETWORK_IOBufferParam_t *inputParamArr, unsigned int numberOfOutput, ARNETWORK_IOBufferParam_t *outputParamArr)
+{
+    /* -- Get the size of the arena of a Manager -- */
+
+    /* local declarations */
+    size_t size = 0;
+    unsigned int bufferIndex = 0;
+    ARNETWORK_IOBufferParam_t param;
+    ARNETWORK_IOBufferParam_t coalescedAckParam;
+
+    /* check parameters */
+    if ((networkALManager == NULL) ||
+        (networkALManager->maxBufferSize == 0) ||
+        ((inputParamArr == NULL) && (numberOfInput > 0)) ||
+        ((outputParamArr == NULL) && (numberOfOutput > 0)))
+    {
+        return ARNETWORK_ERROR_BAD_PARAMETER;
+    }
+
+    /* same allocations as ARNETWORK_Manager_Create(), after the alignment of the memory of the arena */
+    size = ARNETWORK_ARENA_ALIGNMENT - 1;
+    size += ARNETWORK_Arena_GetAllocationSize (sizeof (ARNETWORK_Manager_t));
+    size += ARNETWORK_Arena_GetAllocationSize (2 * numberOfOutput * sizeof (ARNETWORK_IOBuffer_t*));
+    size += ARNETWORK_Arena_GetAllocationSize ((numberOfInput + numberOfOutput) * sizeof (ARNETWORK_IOBuffer_t*));
+    size += ARNETWORK_Arena_GetAllocationSize (ARNETWORK_MANAGER_INTERNAL_BUFFER_ID_MAX * sizeof (ARNETWORK_IOBuffer_t*));
+    size += 2 * ARNETWORK_Arena_GetAllocationSize (networkALManager->maxIds * sizeof (ARNETWORK_IOBuffer_t*));
+
+    /* internal buffers: ping, pong and coalesced acknowledgments */
+    ARNETWORK_Manager_InitInternalParams (networkALManager, &param, &coalescedAckParam);
+    size += 2 * ARNETWORK_IOBuffer_GetArenaSize (&param, 0);
+    size += ARNETWORK_IOBuffer_GetArenaSize (&coalescedAckParam, 0);
+
+    /* output buffers and their buffers of acknowledgement */
+    for (bufferIndex = 0; bufferIndex < numberOfOutput; bufferIndex++)
+    {
+        param = outputParamArr[bufferIndex];
+        if (param.dataCopyMaxSize == ARNETWORK_IOBUFFERPARAM_DATACOPYMAXSIZE_USE_MAX)
+        {
+            param.dataCopyMaxSize = networkALManager->maxBufferSize;
+        }
+        size += ARNETWORK_IOBuffer_GetArenaSize (&param, (param.isFragmenting == 1));
+
+        ARNETWORK_Manager_InitAckParam (&param, outputParamArr[bufferIndex].isFragmenting);
+        size += ARNETWORK_IOBuffer_GetArenaSize (&param, 0);
+    }
+
+    /* input buffers */
+    for (bufferIndex = 0; bufferIndex < numberOfInput; bufferIndex++)
+    {
+        param = inputParamArr[bufferIndex];
+        if (param.dataCopyMaxSize == ARNETWORK_IOBUFFERPARAM_DATACOPYMAXSIZE_USE_MAX)
+        {
+            param.dataCopyMaxSize = networkALManager->maxBufferSize;
+        }
+        size += ARNETWORK_IOBuffer_GetArenaSize (&param, 0);
+    }
+
+    return (size <= INT_MAX) ? (int) size : ARNETWORK_ERROR_BAD_PARAMETER;
+}
+
+ARNETWORK_Manager_t* ARNETWORK_Manager_NewWithArena (ARNETWORKAL_Manager_t *networkALManager, unsigned int numberOfInput, ARNETWORK_IOBufferParam_t *inputParamArr, unsigned int numberOfOutput, ARNETWORK_IOBufferParam_t *outputParamArr, int pingDelayMs, ARNETWORK_Manager_OnDisconnect_t onDisconnectCallback, void* customData, void *arenaPtr, int arenaSize, int isArenaLocked, eARNETWORK_ERROR *error)
+{
+    /* -- Create a new Manager in one arena -- */
+
+    /* local declarations */
+    ARNETWORK_Manager_t *manager = NULL;
+    ARNETWORK_Arena_t *arena = NULL;
+    eARNETWORK_ERROR localError = ARNETWORK_OK;
+    int requiredSize = 0;
+
+    /* compute the size of the arena, from the parameters of the buffers */
+    requiredSize = ARNETWORK_Manager_GetArenaSize (networkALManager, numberOfInput, inputParamArr, numberOfOutput, outputParamArr);
+    if (requiredSize < 0)
+    {
+        localError = (eARNETWORK_ERROR) requiredSize;
+    }
+    else if ((arenaPtr != NULL) && (arenaSize < requiredSize))
+    {
+        ARSAL_PRINT (ARSAL_PRINT_ERROR, ARNETWORK_MANAGER_TAG, "arena of %d bytes too small, %d bytes required", arenaSize, requiredSize);
+        localError = ARNETWORK_ERROR_BUFFER_SIZE;
+    }
+    /* No else: the arena is large enough, or allocated with the size required */
+
+    if (localError == ARNETWORK_OK)
+    {
+        arena = ARNETWORK_Arena_New (arenaPtr, (arenaPtr != NULL) ? (size_t) arenaSize : (size_t) requiredSize, isArenaLocked, &localError);
+    }
+    /* No else: skipped by an error */
+
+    if (localError == ARNETWORK_OK)
+    {
+        /* the arena is deleted with the Manager */
+        manager = ARNETWORK_Manager_Create (networkALManager, numberOfInput, inputParamArr, numberOfOutput, outputParamArr, pingDelayMs, onDisconnectCallback, customData, 0, arena, &localError);
+    }
+    else
+    {
+        ARSAL_PRINT (ARSAL_PRINT_ERROR, ARNETWORK_MANAGER_TAG, "error: %s", ARNETWORK_Error_ToString (localError));
+    }
+
+    if (error != NULL)
+    {
+        *error = localError;
+    }
+    /* No else: error is nor returned */
+
+    return manager;
+}
+
+ARNETWORK_Manager_t* ARNETWORK_Manager_Create (ARNETWORKAL_Manager_t *networkALManager, unsigned int numberOfInput, ARNETWORK_IOBufferParam_t *inputParamArr, unsigned int numberOfOutput, ARNETWORK_IOBufferParam_t *outputParamArr, int pingDelayMs, ARNETWORK_Manager_OnDisconnect_t onDisconnectCallback, void* customData, int memoryBudget, ARNETWORK_Arena_t *arena, eARNETWORK_ERROR *error)
 {
     /* -- Create a new Manager -- */
 
@@ -113,24 +550,41 @@ ARNETWORK_Manager_t* ARNETWORK_Manager_New (ARNETWORKAL_Manager_t *networkALMana
     ARNETWORK_Manager_t *manager = NULL;
     eARNETWORK_ERROR localError = ARNETWORK_OK;
     eARNETWORKAL_ERROR errorAL = ARNETWORKAL_OK;
+    size_t memoryFootprint = 0;
     
     /* check parameters */
-    if (networkALManager == NULL)
+    if ((networkALManager == NULL) || (memoryBudget < 0))
     {
         localError = ARNETWORK_ERROR_BAD_PARAMETER;
     }
     /* No Else: the checking parameters sets localError to ARNETWORK_ERROR_BAD_PARAMETER and stop the processing */
     
+    if ((localError == ARNETWORK_OK) && (memoryBudget > 0))
+    {
+        /* Check the memory to allocate against the budget, before any allocation */
+        memoryFootprint = ARNETWORK_Manager_GetNewMemoryFootprint (networkALManager, numberOfInput, inputParamArr, numberOfOutput, outputParamArr);
+        if (memoryFootprint > (size_t) memoryBudget)
+        {
+            ARSAL_PRINT (ARSAL_PRINT_ERROR, ARNETWORK_MANAGER_TAG, "memory footprint %lu bytes exceeds the budget of %d bytes", (unsigned long) memoryFootprint, memoryBudget);
+            localError = ARNETWORK_ERROR_MANAGER_MEMORY_BUDGET;
+        }
+    }
+    /* No else: skipped by an error or no budget */
+
     if (localError == ARNETWORK_OK)
     {
         /* Create the Manager */
-        manager = malloc (sizeof (ARNETWORK_Manager_t));
+        manager = ARNETWORK_Arena_Malloc (arena, sizeof (ARNETWORK_Manager_t));
         if (manager != NULL)
         {
             /* Initialize to default values */
+            manager->arena = arena;
             manager->networkALManager = NULL;
             manager->sender = NULL;
             manager->receiver = NULL;
+            manager->notifier = NULL;
+            manager->trace = NULL;
+            manager->completionQueue = NULL;
             manager->inputBufferArray = NULL;
             manager->outputBufferArray = NULL;
             manager->internalInputBufferArray = NULL;
@@ -143,6 +597,8 @@ ARNETWORK_Manager_t* ARNETWORK_Manager_New (ARNETWORKAL_Manager_t *networkALMana
             manager->outputBufferMap = NULL;
             manager->onDisconnect = onDisconnectCallback;
             manager->customData = customData;
+            manager->memoryBudget = memoryBudget;
+            ARSAL_Mutex_Init (&(manager->buffersMutex));
         }
         else
         {
@@ -151,6 +607,13 @@ ARNETWORK_Manager_t* ARNETWORK_Manager_New (ARNETWORKAL_Manager_t *networkALMana
     }
     /* No else: skipped by an error */ 
 
+    if (manager == NULL)
+    {
+        /* the arena is deleted at once, without Manager to own it */
+        ARNETWORK_Arena_Delete (&arena);
+    }
+    /* No else: the arena is deleted with the Manager */
+
     if (localError == ARNETWORK_OK)
     {
         manager->networkALManager = networkALManager;
@@ -195,7 +658,7 @@ ARNETWORK_Manager_t* ARNETWORK_Manager_New (ARNETWORKAL_Manager_t *networkALMana
          */
         manager->numberOfOutputWithoutAck = numberOfOutput;
         manager->numberOfOutput = 2 * numberOfOutput;
-        manager->outputBufferArray = calloc (manager->numberOfOutput, sizeof (ARNETWORK_IOBuffer_t*));
+        manager->outputBufferArray = ARNETWORK_Arena_Calloc (manager->arena, manager->numberOfOutput, sizeof (ARNETWORK_IOBuffer_t*));
         if (manager->outputBufferArray == NULL)
         {
             localError = ARNETWORK_ERROR_ALLOC;
@@ -214,7 +677,7 @@ ARNETWORK_Manager_t* ARNETWORK_Manager_New (ARNETWORKAL_Manager_t *networkALMana
          */
         manager->numberOfInputWithoutAck = numberOfInput;
         manager->numberOfInput = numberOfInput + numberOfOutput;
-        manager->inputBufferArray = calloc (manager->numberOfInput, sizeof (ARNETWORK_IOBuffer_t*));
+        manager->inputBufferArray = ARNETWORK_Arena_Calloc (manager->arena, manager->numberOfInput, sizeof (ARNETWORK_IOBuffer_t*));
         if (manager->inputBufferArray == NULL)
         {
             localError = ARNETWORK_ERROR_ALLOC;
@@ -231,7 +694,7 @@ ARNETWORK_Manager_t* ARNETWORK_Manager_New (ARNETWORKAL_Manager_t *networkALMana
          * Size is the number of internal buffers
          */
         manager->numberOfInternalInputs = ARNETWORK_MANAGER_INTERNAL_BUFFER_ID_MAX;
-        manager->internalInputBufferArray = calloc (manager->numberOfInternalInputs, sizeof (ARNETWORK_IOBuffer_t*));
+        manager->internalInputBufferArray = ARNETWORK_Arena_Calloc (manager->arena, manager->numberOfInternalInputs, sizeof (ARNETWORK_IOBuffer_t*));
         if (manager->internalInputBufferArray == NULL)
         {
             localError = ARNETWORK_ERROR_ALLOC;
@@ -243,7 +706,7 @@ ARNETWORK_Manager_t* ARNETWORK_Manager_New (ARNETWORKAL_Manager_t *networkALMana
     if (localError == ARNETWORK_OK)
     {
         /* Allocate the output buffer map  storing the IOBuffer by their identifier */
-        manager->outputBufferMap = calloc (manager->networkALManager->maxIds, sizeof (ARNETWORK_IOBuffer_t*));
+        manager->outputBufferMap = ARNETWORK_Arena_Calloc (manager->arena, manager->networkALManager->maxIds, sizeof (ARNETWORK_IOBuffer_t*));
         if (manager->outputBufferMap == NULL)
         {
             localError = ARNETWORK_ERROR_ALLOC;
@@ -254,7 +717,7 @@ ARNETWORK_Manager_t* ARNETWORK_Manager_New (ARNETWORKAL_Manager_t *networkALMana
     if (localError == ARNETWORK_OK)
     {
         /* Allocate the input buffer map  storing the IOBuffer by their identifier */
-        manager->inputBufferMap = calloc (manager->networkALManager->maxIds, sizeof (ARNETWORK_IOBuffer_t*));
+        manager->inputBufferMap = ARNETWORK_Arena_Calloc (manager->arena, manager->networkALManager->maxIds, sizeof (ARNETWORK_IOBuffer_t*));
         if (manager->inputBufferMap == NULL)
         {
             localError = ARNETWORK_ERROR_ALLOC;
@@ -293,6 +756,8 @@ ARNETWORK_Manager_t* ARNETWORK_Manager_New (ARNETWORKAL_Manager_t *networkALMana
         if (manager->receiver != NULL)
         {
             manager->receiver->senderPtr = manager->sender;
+            manager->sender->outputBufferPtrArr = manager->outputBufferArray;
+            manager->sender->numberOfOutputBuff = manager->numberOfOutput;
         }
         else
         {
@@ -301,6 +766,33 @@ ARNETWORK_Manager_t* ARNETWORK_Manager_New (ARNETWORKAL_Manager_t *networkALMana
     }
     /* No else: skipped by an error */ 
 
+    if (localError == ARNETWORK_OK)
+    {
+        /* Create the notifier of the output buffers ready to be read */
+        manager->notifier = ARNETWORK_Notifier_New (&localError);
+        if (manager->notifier != NULL)
+        {
+            manager->receiver->notifierPtr = manager->notifier;
+        }
+    }
+    /* No else: skipped by an error */ 
+
+    if (localError == ARNETWORK_OK)
+    {
+        /* Create the trace, disabled */
+        manager->trace = ARNETWORK_Trace_New ();
+        if (manager->trace != NULL)
+        {
+            manager->sender->tracePtr = manager->trace;
+            manager->receiver->tracePtr = manager->trace;
+        }
+        else
+        {
+            localError = ARNETWORK_ERROR_ALLOC;
+        }
+    }
+    /* No else: skipped by an error */ 
+
     /* delete the Manager if an error occurred */
     if (localError != ARNETWORK_OK)
     {
@@ -325,6 +817,7 @@ void ARNETWORK_Manager_Delete (ARNETWORK_Manager_t **manager)
 
     /** local declarations */
     int bufferIndex = 0;
+    ARNETWORK_Arena_t *arena = NULL;
 
     if (manager)
     {
@@ -332,6 +825,8 @@ void ARNETWORK_Manager_Delete (ARNETWORK_Manager_t **manager)
         {
             ARNETWORK_Sender_Delete (&((*manager)->sender));
             ARNETWORK_Receiver_Delete (&((*manager)->receiver));
+            ARNETWORK_Notifier_Delete (&((*manager)->notifier));
+            ARNETWORK_Trace_Delete (&((*manager)->trace));
 
             /* Delete all internal buffers */
             for (bufferIndex = 0; bufferIndex < (*manager)->numberOfInternalInputs; ++bufferIndex)
@@ -343,7 +838,7 @@ void ARNETWORK_Manager_Delete (ARNETWORK_Manager_t **manager)
                 }
                 (*manager)->internalInputBufferArray[bufferIndex] = NULL;
             }
-            free ((*manager)->internalInputBufferArray);
+            ARNETWORK_Arena_Free ((*manager)->arena, (*manager)->internalInputBufferArray);
             (*manager)->internalInputBufferArray = NULL;
 
             /** Delete all output buffers including the buffers of acknowledgement */
@@ -351,7 +846,7 @@ void ARNETWORK_Manager_Delete (ARNETWORK_Manager_t **manager)
             {
                 ARNETWORK_IOBuffer_Delete (&((*manager)->outputBufferArray[bufferIndex]));
             }
-            free ((*manager)->outputBufferArray);
+            ARNETWORK_Arena_Free ((*manager)->arena, (*manager)->outputBufferArray);
             (*manager)->outputBufferArray = NULL;
 
             /** Delete the input buffers but not the buffers of acknowledgement already deleted */
@@ -359,18 +854,25 @@ void ARNETWORK_Manager_Delete (ARNETWORK_Manager_t **manager)
             {
                 ARNETWORK_IOBuffer_Delete (&((*manager)->inputBufferArray[bufferIndex]));
             }
-            free ((*manager)->inputBufferArray);
+            ARNETWORK_Arena_Free ((*manager)->arena, (*manager)->inputBufferArray);
             (*manager)->inputBufferArray = NULL;
 
-            free ((*manager)->inputBufferMap);
+            ARNETWORK_Arena_Free ((*manager)->arena, (*manager)->inputBufferMap);
             (*manager)->inputBufferMap = NULL;
 
-            free ((*manager)->outputBufferMap);
+            ARNETWORK_Arena_Free ((*manager)->arena, (*manager)->outputBufferMap);
             (*manager)->outputBufferMap = NULL;
 
+            /** the completion queue is deleted after the buffers, which push the completions of their data cancelled */
+            ARNETWORK_CompletionQueue_Delete (&((*manager)->completionQueue));
+
             (*manager)->networkALManager = NULL;
+            ARSAL_Mutex_Destroy (&((*manager)->buffersMutex));
 
-            free ((*manager));
+            /* the arena, if any, is deleted after the Manager allocated in it */
+            arena = (*manager)->arena;
+            ARNETWORK_Arena_Free (arena, (*manager));
+            ARNETWORK_Arena_Delete (&arena);
             (*manager) = NULL;
         }
     }
@@ -459,456 +961,1809 @@ eARNETWORK_ERROR ARNETWORK_Manager_Flush (ARNETWORK_Manager_t *manager)
     return error;
 }
 
-eARNETWORK_ERROR ARNETWORK_Manager_SendData (ARNETWORK_Manager_t *manager, int inputBufferID, uint8_t *data, int dataSize, void *customData, ARNETWORK_Manager_Callback_t callback, int doDataCopy)
+eARNETWORK_ERROR ARNETWORK_Manager_Reset (ARNETWORK_Manager_t *manager)
 {
-    /** -- Add data to send in a IOBuffer using fixed size data -- */
+    /** -- Reset the Manager in place, for a new connection -- */
 
     /** local declarations */
     eARNETWORK_ERROR error = ARNETWORK_OK;
-    ARNETWORK_IOBuffer_t *inputBuffer = NULL;
-    int bufferWasEmpty = 0;
 
-    /** check paratemters:
-     *  -   the manager ponter is not NUL
-     *  -   the data pointer is not NULL
-     *  -   the callback is not NULL
-     */
-    if ((manager != NULL) && (data != NULL) && (callback != NULL))
+    /** check parameters */
+    if (manager == NULL)
     {
-        /** get the address of the inputBuffer */
-        inputBuffer = manager->inputBufferMap[inputBufferID];
-
-        if (inputBuffer == NULL)
-        {
-            error = ARNETWORK_ERROR_ID_UNKNOWN;
-        }
-    }
-    else
-    {
-        error = ARNETWORK_ERROR_BAD_PARAMETER;
-    }
+        error = ARNETWORK_ERROR_BAD_PARAMETER;
+    }
 
     if (error == ARNETWORK_OK)
     {
-        /** lock the IOBuffer */
-        error = ARNETWORK_IOBuffer_Lock(inputBuffer);
-    }
+        /** block the sender and the receiver during the reset: they see all buffers reset at once */
+        ARNETWORK_Manager_LockBuffers (manager);
 
-    if(error == ARNETWORK_OK)
-    {
-        bufferWasEmpty = ARNETWORK_RingBuffer_IsEmpty(inputBuffer->dataDescriptorRBuffer);
-    }
+        error = ARNETWORK_Sender_Reset (manager->sender);
 
-    if(error == ARNETWORK_OK)
-    {
-        /** add the data in the inputBuffer */
-        error = ARNETWORK_IOBuffer_AddData (inputBuffer, data, dataSize, customData, callback, doDataCopy);
-        ARNETWORK_IOBuffer_Unlock(inputBuffer);
-    }
+        if (error == ARNETWORK_OK)
+        {
+            error = ARNETWORK_Receiver_Reset (manager->receiver);
+        }
 
-    if (error == ARNETWORK_OK)
-    {
-        if ((inputBuffer->dataType == ARNETWORKAL_FRAME_TYPE_DATA_LOW_LATENCY) ||
-            (bufferWasEmpty > 0))
+        /** no output buffer is ready to be read anymore */
+        if (manager->notifier != NULL)
         {
-            ARNETWORK_Sender_SignalNewData (manager->sender);
+            ARNETWORK_Notifier_Clear (manager->notifier);
         }
+
+        ARNETWORK_Manager_UnlockBuffers (manager);
     }
 
     return error;
 }
 
-eARNETWORK_ERROR ARNETWORK_Manager_ReadData (ARNETWORK_Manager_t *manager, int outputBufferID, uint8_t *data, int dataLimitSize, int *readSize)
+eARNETWORK_ERROR ARNETWORK_Manager_AddInputBuffer (ARNETWORK_Manager_t *manager, ARNETWORK_IOBufferParam_t *inputParam)
 {
-    /** -- Read data received in a IOBuffer using variable size data (blocking function) -- */
+    /** -- Add an input buffer to the Manager -- */
 
     /** local declarations */
     eARNETWORK_ERROR error = ARNETWORK_OK;
-    ARNETWORK_IOBuffer_t *outputBuffer = NULL;
-    int semError = 0;
+    ARNETWORK_IOBuffer_t *inputBuffer = NULL;
+    ARNETWORK_IOBuffer_t **newInputBufferArray = NULL;
 
     /** check paratemters */
-    if (manager != NULL)
-    {
-        /** get the address of the outputBuffer */
-        outputBuffer = manager->outputBufferMap[outputBufferID];
-
-        /** check outputBuffer */
-        if (outputBuffer == NULL)
-        {
-            error = ARNETWORK_ERROR_ID_UNKNOWN;
-        }
-    }
-    else
+    if ((manager == NULL) || (inputParam == NULL))
     {
         error = ARNETWORK_ERROR_BAD_PARAMETER;
     }
 
     if (error == ARNETWORK_OK)
     {
-        /** try to take the semaphore */
-        semError = ARSAL_Sem_Wait (&(outputBuffer->outputSem));
+        /** the buffers are locked from the check of the budget to the addition, against another change of the buffers */
+        ARNETWORK_Manager_LockBuffers (manager);
 
-        if (semError)
+        /** the buffer must fit in the memory budget: checked from its parameters, before its allocation */
+        if ((manager->memoryBudget > 0) &&
+            ((size_t) ARNETWORK_Manager_ComputeMemoryFootprint (manager, NULL, 0, NULL) + ARNETWORK_Manager_GetBufferNewMemoryFootprint (manager->networkALManager, inputParam, 0) + sizeof (ARNETWORK_IOBuffer_t*) > (size_t) manager->memoryBudget))
         {
-            switch (errno)
-            {
-            case EAGAIN : /** no semaphore */
-                error = ARNETWORK_ERROR_BUFFER_EMPTY;
-                break;
+            error = ARNETWORK_ERROR_MANAGER_MEMORY_BUDGET;
+        }
 
-            default:
-                error = ARNETWORK_ERROR_SEMAPHORE;
-                break;
+        if (error == ARNETWORK_OK)
+        {
+            inputBuffer = ARNETWORK_Manager_NewInputBuffer (manager, inputParam, NULL, &error);
+        }
+
+        /** the lists and the maps of buffers are read by the calls of the application */
+        ARSAL_Mutex_Lock (&(manager->buffersMutex));
+
+        /** the identifier must be free */
+        if ((error == ARNETWORK_OK) && (manager->inputBufferMap[inputBuffer->ID] != NULL))
+        {
+            error = ARNETWORK_ERROR_BAD_PARAMETER;
+        }
+
+        if (error == ARNETWORK_OK)
+        {
+            newInputBufferArray = ARNETWORK_Arena_Realloc (manager->arena, manager->inputBufferArray, manager->numberOfInput * sizeof (ARNETWORK_IOBuffer_t*), (manager->numberOfInput + 1) * sizeof (ARNETWORK_IOBuffer_t*));
+            if (newInputBufferArray == NULL)
+            {
+                error = ARNETWORK_ERROR_ALLOC;
             }
         }
-    }
 
-    /** read data */
+        if (error == ARNETWORK_OK)
+        {
+            /** the input buffers precede the buffers of acknowledgement in the input buffer list */
+            memmove (&(newInputBufferArray[manager->numberOfInputWithoutAck + 1]), &(newInputBufferArray[manager->numberOfInputWithoutAck]), (manager->numberOfInput - manager->numberOfInputWithoutAck) * sizeof (ARNETWORK_IOBuffer_t*));
+            newInputBufferArray[manager->numberOfInputWithoutAck] = inputBuffer;
+            manager->inputBufferArray = newInputBufferArray;
+            manager->numberOfInputWithoutAck++;
+            manager->numberOfInput++;
+
+            manager->inputBufferMap[inputBuffer->ID] = inputBuffer;
+            inputBuffer->completionQueuePtr = manager->completionQueue;
+        }
 
-    if (error == ARNETWORK_OK)
-    {
-        /** lock the IOBuffer */
-        error = ARNETWORK_IOBuffer_Lock (outputBuffer);
+        ARSAL_Mutex_Unlock (&(manager->buffersMutex));
+
+        ARNETWORK_Manager_UnlockBuffers (manager);
     }
 
-    if (error == ARNETWORK_OK)
+    if (error != ARNETWORK_OK)
     {
-        error = ARNETWORK_IOBuffer_ReadData (outputBuffer, data, dataLimitSize, readSize);
-
-        /** unlock the IOBuffer */
-        ARNETWORK_IOBuffer_Unlock (outputBuffer);
+        ARNETWORK_IOBuffer_Delete (&inputBuffer);
     }
 
     return error;
 }
 
-eARNETWORK_ERROR ARNETWORK_Manager_TryReadData (ARNETWORK_Manager_t *manager, int outputBufferID, uint8_t *data, int dataLimitSize, int *readSize)
+eARNETWORK_ERROR ARNETWORK_Manager_AddOutputBuffer (ARNETWORK_Manager_t *manager, ARNETWORK_IOBufferParam_t *outputParam)
 {
-    /** -- try to read data received in a IOBuffer using variable size data (non-blocking function) -- */
+    /** -- Add an output buffer, and its buffer of acknowledgement, to the Manager -- */
 
     /** local declarations */
     eARNETWORK_ERROR error = ARNETWORK_OK;
     ARNETWORK_IOBuffer_t *outputBuffer = NULL;
-    int semError = 0;
+    ARNETWORK_IOBuffer_t *ackBuffer = NULL;
+    ARNETWORK_IOBuffer_t **newOutputBufferArray = NULL;
+    ARNETWORK_IOBuffer_t **newInputBufferArray = NULL;
 
     /** check paratemters */
-    if (manager != NULL)
-    {
-        /** get the address of the outputBuffer */
-        outputBuffer = manager->outputBufferMap[outputBufferID];
-
-        /** check outputBuffer */
-        if (outputBuffer == NULL)
-        {
-            error = ARNETWORK_ERROR_ID_UNKNOWN;
-        }
-    }
-    else
+    if ((manager == NULL) || (outputParam == NULL))
     {
         error = ARNETWORK_ERROR_BAD_PARAMETER;
     }
 
     if (error == ARNETWORK_OK)
     {
-        /** try to take the semaphore */
-        semError = ARSAL_Sem_Trywait (&(outputBuffer->outputSem));
+        /** the buffers are locked from the check of the budget to the addition, against another change of the buffers */
+        ARNETWORK_Manager_LockBuffers (manager);
 
-        if (semError)
+        /** the buffers must fit in the memory budget: checked from their parameters, before their allocation */
+        if ((manager->memoryBudget > 0) &&
+            ((size_t) ARNETWORK_Manager_ComputeMemoryFootprint (manager, NULL, 0, NULL) + ARNETWORK_Manager_GetBufferNewMemoryFootprint (manager->networkALManager, outputParam, 1) + 3 * sizeof (ARNETWORK_IOBuffer_t*) > (size_t) manager->memoryBudget))
         {
-            switch (errno)
+            error = ARNETWORK_ERROR_MANAGER_MEMORY_BUDGET;
+        }
+
+        if (error == ARNETWORK_OK)
+        {
+            error = ARNETWORK_Manager_NewOutputBuffer (manager, outputParam, NULL, &outputBuffer, &ackBuffer);
+        }
+
+        /** the lists and the maps of buffers are read by the calls of the application */
+        ARSAL_Mutex_Lock (&(manager->buffersMutex));
+
+        /** the identifier must be free */
+        if ((error == ARNETWORK_OK) && (manager->outputBufferMap[outputBuffer->ID] != NULL))
+        {
+            error = ARNETWORK_ERROR_BAD_PARAMETER;
+        }
+
+        /** the lists grown are kept even if an error occurs, the number of buffers is unchanged */
+        if (error == ARNETWORK_OK)
+        {
+            newOutputBufferArray = ARNETWORK_Arena_Realloc (manager->arena, manager->outputBufferArray, manager->numberOfOutput * sizeof (ARNETWORK_IOBuffer_t*), (manager->numberOfOutput + 2) * sizeof (ARNETWORK_IOBuffer_t*));
+            if (newOutputBufferArray != NULL)
             {
-            case EAGAIN : /** no semaphore */
-                error = ARNETWORK_ERROR_BUFFER_EMPTY;
-                break;
+                manager->outputBufferArray = newOutputBufferArray;
+            }
+            else
+            {
+                error = ARNETWORK_ERROR_ALLOC;
+            }
+        }
 
-            default:
-                error = ARNETWORK_ERROR_SEMAPHORE;
-                break;
+        if (error == ARNETWORK_OK)
+        {
+            newInputBufferArray = ARNETWORK_Arena_Realloc (manager->arena, manager->inputBufferArray, manager->numberOfInput * sizeof (ARNETWORK_IOBuffer_t*), (manager->numberOfInput + 1) * sizeof (ARNETWORK_IOBuffer_t*));
+            if (newInputBufferArray != NULL)
+            {
+                manager->inputBufferArray = newInputBufferArray;
+            }
+            else
+            {
+                error = ARNETWORK_ERROR_ALLOC;
             }
         }
-    }
 
-    /** read data */
+        if (error == ARNETWORK_OK)
+        {
+            /** the output buffers precede the buffers of acknowledgement, stored at the end of the output and input buffer lists */
+            memmove (&(newOutputBufferArray[manager->numberOfOutputWithoutAck + 1]), &(newOutputBufferArray[manager->numberOfOutputWithoutAck]), (manager->numberOfOutput - manager->numberOfOutputWithoutAck) * sizeof (ARNETWORK_IOBuffer_t*));
+            newOutputBufferArray[manager->numberOfOutputWithoutAck] = outputBuffer;
+            newOutputBufferArray[manager->numberOfOutput + 1] = ackBuffer;
+            newInputBufferArray[manager->numberOfInput] = ackBuffer;
+            manager->numberOfOutputWithoutAck++;
+            manager->numberOfOutput += 2;
+            manager->numberOfInput++;
+
+            manager->outputBufferMap[outputBuffer->ID] = outputBuffer;
+            manager->outputBufferMap[ackBuffer->ID] = ackBuffer;
+            manager->inputBufferMap[ackBuffer->ID] = ackBuffer;
+        }
 
-    if (error == ARNETWORK_OK)
-    {
-        /** lock the IOBuffer */
-        error = ARNETWORK_IOBuffer_Lock (outputBuffer);
+        ARSAL_Mutex_Unlock (&(manager->buffersMutex));
+
+        ARNETWORK_Manager_UnlockBuffers (manager);
     }
 
-    if (error == ARNETWORK_OK)
+    if (error != ARNETWORK_OK)
     {
-        error = ARNETWORK_IOBuffer_ReadData (outputBuffer, data, dataLimitSize, readSize);
-
-        /** unlock the IOBuffer */
-        ARNETWORK_IOBuffer_Unlock (outputBuffer);
+        ARNETWORK_IOBuffer_Delete (&outputBuffer);
+        ARNETWORK_IOBuffer_Delete (&ackBuffer);
     }
 
     return error;
 }
 
-eARNETWORK_ERROR ARNETWORK_Manager_ReadDataWithTimeout (ARNETWORK_Manager_t *manager, int outputBufferID, uint8_t *data, int dataLimitSize, int *readSize, int timeoutMs)
+eARNETWORK_ERROR ARNETWORK_Manager_RemoveInputBuffer (ARNETWORK_Manager_t *manager, int inputBufferID)
 {
-    /** -- Read, with timeout, a data received in IOBuffer using variable size data -- */
+    /** -- Remove an input buffer from the Manager -- */
 
     /** local declarations */
     eARNETWORK_ERROR error = ARNETWORK_OK;
-    ARNETWORK_IOBuffer_t *outputBuffer = NULL;
-    int semError = 0;
-    struct timespec semTimeout;
+    ARNETWORK_IOBuffer_t *inputBuffer = NULL;
+    int bufferIndex = 0;
+    int isFound = 0;
 
-    /** check paratemters */
-    if (manager != NULL)
+    /** check paratemters: only the input buffers of the application can be removed */
+    if ((manager == NULL) ||
+        (inputBufferID < ARNETWORK_MANAGER_INTERNAL_BUFFER_ID_MAX) ||
+        (inputBufferID >= (manager->networkALManager->maxIds / 2)))
     {
-        outputBuffer = manager->outputBufferMap[outputBufferID];
+        error = ARNETWORK_ERROR_BAD_PARAMETER;
+    }
 
-        /** check pOutputBuffer */
-        if (outputBuffer == NULL)
+    if (error == ARNETWORK_OK)
+    {
+        ARNETWORK_Manager_LockBuffers (manager);
+
+        inputBuffer = manager->inputBufferMap[inputBufferID];
+        if (inputBuffer == NULL)
         {
             error = ARNETWORK_ERROR_ID_UNKNOWN;
         }
+
+        for (bufferIndex = 0; (error == ARNETWORK_OK) && (!isFound) && (bufferIndex < manager->numberOfInputWithoutAck); bufferIndex++)
+        {
+            if (manager->inputBufferArray[bufferIndex] == inputBuffer)
+            {
+                /** the producers waiting a free cell return an error */
+                ARNETWORK_Manager_MarkBufferRemoved (inputBuffer);
+
+                ARSAL_Mutex_Lock (&(manager->buffersMutex));
+                memmove (&(manager->inputBufferArray[bufferIndex]), &(manager->inputBufferArray[bufferIndex + 1]), (manager->numberOfInput - bufferIndex - 1) * sizeof (ARNETWORK_IOBuffer_t*));
+                manager->numberOfInputWithoutAck--;
+                manager->numberOfInput--;
+                manager->inputBufferMap[inputBufferID] = NULL;
+                ARSAL_Mutex_Unlock (&(manager->buffersMutex));
+                isFound = 1;
+            }
+        }
+
+        ARNETWORK_Manager_UnlockBuffers (manager);
     }
-    else
+
+    /** the buffer is not seen anymore by the sender ; it is deleted once no call of the application uses it */
+    if ((error == ARNETWORK_OK) && (isFound))
+    {
+        ARNETWORK_Manager_ReleaseBuffer (manager, inputBuffer);
+    }
+
+    return error;
+}
+
+eARNETWORK_ERROR ARNETWORK_Manager_RemoveOutputBuffer (ARNETWORK_Manager_t *manager, int outputBufferID)
+{
+    /** -- Remove an output buffer, and its buffer of acknowledgement, from the Manager -- */
+
+    /** local declarations */
+    eARNETWORK_ERROR error = ARNETWORK_OK;
+    ARNETWORK_IOBuffer_t *outputBuffer = NULL;
+    ARNETWORK_IOBuffer_t *ackBuffer = NULL;
+    int bufferIndex = 0;
+    int foundIndex = 0;
+    int isFound = 0;
+
+    /** check paratemters: only the output buffers of the application can be removed */
+    if ((manager == NULL) ||
+        (outputBufferID < ARNETWORK_MANAGER_INTERNAL_BUFFER_ID_MAX) ||
+        (outputBufferID >= (manager->networkALManager->maxIds / 2)))
     {
         error = ARNETWORK_ERROR_BAD_PARAMETER;
     }
 
     if (error == ARNETWORK_OK)
     {
-        /** convert timeoutMs in timespec */
-        semTimeout.tv_sec = timeoutMs / 1000;
-        semTimeout.tv_nsec = (timeoutMs % 1000) * 1000000;
+        ARNETWORK_Manager_LockBuffers (manager);
 
-        /** try to take the semaphore with timeout*/
-        semError = ARSAL_Sem_Timedwait (&(outputBuffer->outputSem), &semTimeout);
+        outputBuffer = manager->outputBufferMap[outputBufferID];
+        if (outputBuffer == NULL)
+        {
+            error = ARNETWORK_ERROR_ID_UNKNOWN;
+        }
 
-        if (semError)
+        for (bufferIndex = 0; (error == ARNETWORK_OK) && (!isFound) && (bufferIndex < manager->numberOfOutputWithoutAck); bufferIndex++)
         {
-            switch (errno)
+            if (manager->outputBufferArray[bufferIndex] == outputBuffer)
             {
-            case ETIMEDOUT : /** semaphore time out */
-                error = ARNETWORK_ERROR_BUFFER_EMPTY;
-                break;
-
-            default:
-                error = ARNETWORK_ERROR_SEMAPHORE;
-                break;
+                /** the readers waiting a data return an error ; refused while a data is borrowed, its memory being freed with the buffer */
+                error = ARNETWORK_Manager_MarkBufferRemoved (outputBuffer);
+                foundIndex = bufferIndex;
+                isFound = 1;
             }
         }
-    }
 
-    /** read data */
+        if ((error == ARNETWORK_OK) && (isFound))
+        {
+            ARSAL_Mutex_Lock (&(manager->buffersMutex));
 
-    if (error == ARNETWORK_OK)
-    {
-        /** lock the IOBuffer */
-        error = ARNETWORK_IOBuffer_Lock (outputBuffer);
+            /** the buffer of acknowledgement has the same index among the buffers of acknowledgement of the output and input buffer lists */
+            ackBuffer = manager->outputBufferArray[manager->numberOfOutputWithoutAck + foundIndex];
+            memmove (&(manager->outputBufferArray[manager->numberOfOutputWithoutAck + foundIndex]), &(manager->outputBufferArray[manager->numberOfOutputWithoutAck + foundIndex + 1]), (manager->numberOfOutputWithoutAck - foundIndex - 1) * sizeof (ARNETWORK_IOBuffer_t*));
+            memmove (&(manager->outputBufferArray[foundIndex]), &(manager->outputBufferArray[foundIndex + 1]), (manager->numberOfOutput - foundIndex - 2) * sizeof (ARNETWORK_IOBuffer_t*));
+            memmove (&(manager->inputBufferArray[manager->numberOfInputWithoutAck + foundIndex]), &(manager->inputBufferArray[manager->numberOfInputWithoutAck + foundIndex + 1]), (manager->numberOfInput - manager->numberOfInputWithoutAck - foundIndex - 1) * sizeof (ARNETWORK_IOBuffer_t*));
+            manager->numberOfOutputWithoutAck--;
+            manager->numberOfOutput -= 2;
+            manager->numberOfInput--;
+
+            manager->outputBufferMap[outputBuffer->ID] = NULL;
+            manager->outputBufferMap[ackBuffer->ID] = NULL;
+            manager->inputBufferMap[ackBuffer->ID] = NULL;
+
+            ARSAL_Mutex_Unlock (&(manager->buffersMutex));
+
+            /** the data of a buffer of acknowledgement are not borrowed by the application */
+            ARNETWORK_Manager_MarkBufferRemoved (ackBuffer);
+        }
+
+        ARNETWORK_Manager_UnlockBuffers (manager);
     }
 
-    if (error == ARNETWORK_OK)
+    /** the buffers are not seen anymore by the sender and the receiver ; they are deleted once no call of the application uses them */
+    if ((error == ARNETWORK_OK) && (isFound))
     {
-        error = ARNETWORK_IOBuffer_ReadData (outputBuffer, data, dataLimitSize, readSize);
+        /** the calls of ARNETWORK_Manager_ReadAny() waiting check their output buffers again */
+        ARNETWORK_Notifier_Wake (manager->notifier);
 
-        /** unlock the IOBuffer */
-        ARNETWORK_IOBuffer_Unlock (outputBuffer);
+        ARNETWORK_Manager_ReleaseBuffer (manager, outputBuffer);
+        ARNETWORK_Manager_ReleaseBuffer (manager, ackBuffer);
     }
 
     return error;
 }
 
-/*****************************************
- *
- *             private implementation:
- *
- *****************************************/
-
-eARNETWORK_ERROR ARNETWORK_Manager_CreateIOBuffer (ARNETWORK_Manager_t *manager, ARNETWORK_IOBufferParam_t *inputParamArray, ARNETWORK_IOBufferParam_t *outputParamArray)
+eARNETWORK_ERROR ARNETWORK_Manager_GetMemoryFootprint (ARNETWORK_Manager_t *manager, ARNETWORK_Manager_BufferFootprint_t *footprintArray, int maxNumberOfFootprints, int *numberOfFootprints, int *totalSize)
 {
-    /** -- Create manager's IoBuffers --*/
+    /** -- Get the memory allocated by the Manager, with a breakdown by buffer -- */
 
     /** local declarations */
     eARNETWORK_ERROR error = ARNETWORK_OK;
-    int inputIndex = 0;
-    int outputIndex = 0;
-    int indexAckOutput = 0;
-    ARNETWORK_IOBufferParam_t paramNewACK;
-    ARNETWORK_IOBufferParam_t paramPingBuffer;
-
-    /** Initialize the default parameters for the buffers of acknowledgement. */
-    ARNETWORK_IOBufferParam_DefaultInit (&paramNewACK);
-    paramNewACK.dataType = ARNETWORKAL_FRAME_TYPE_ACK;
-    paramNewACK.numberOfCell = 1;
-    paramNewACK.dataCopyMaxSize = sizeof (( (ARNETWORKAL_Frame_t *)NULL)->seq);
-    paramNewACK.isOverwriting = 0;
-
-    /** Initialize the ping buffers parameters */
-    ARNETWORK_IOBufferParam_DefaultInit (&paramPingBuffer);
-    paramPingBuffer.dataType = ARNETWORKAL_FRAME_TYPE_DATA;
-    paramPingBuffer.numberOfCell = 1;
-    paramPingBuffer.dataCopyMaxSize = sizeof (struct timespec);
-    paramPingBuffer.isOverwriting = 1;
+    int localNumberOfFootprints = 0;
+    int localTotalSize = 0;
 
-    /**
-     *  For each output buffer a buffer of acknowledgement is add and referenced
-     *  in the output buffer list and the input buffer list.
-     */
+    /** check paratemters */
+    if ((manager == NULL) ||
+        (maxNumberOfFootprints < 0) ||
+        ((footprintArray == NULL) && (maxNumberOfFootprints > 0)))
+    {
+        error = ARNETWORK_ERROR_BAD_PARAMETER;
+    }
 
-    /*
-     * Create the input/output buffers for the "library reserved" part
-     * - Start by creating the input-only buffers
-     * - Then create all output buffers, and add loopback buffers to the end of the internal input buffers
-     */
-    outputIndex = 0;
-    inputIndex  = 0;
-    /* Generate inputs */
-    // Iterate on all ARNETWORK_MANAGER_INTERNAL_BUFFER_ID_XXX values
-    //  - ARNETWORK_MANAGER_INTERNAL_BUFFER_ID_PING
     if (error == ARNETWORK_OK)
     {
-        paramPingBuffer.ID = ARNETWORK_MANAGER_INTERNAL_BUFFER_ID_PING;
-        manager->internalInputBufferArray[inputIndex] = ARNETWORK_IOBuffer_New (&paramPingBuffer, 1);
-        if (manager->internalInputBufferArray[inputIndex] == NULL)
+        ARNETWORK_Manager_LockBuffers (manager);
+        localTotalSize = ARNETWORK_Manager_ComputeMemoryFootprint (manager, footprintArray, maxNumberOfFootprints, &localNumberOfFootprints);
+        ARNETWORK_Manager_UnlockBuffers (manager);
+
+        if (localNumberOfFootprints > maxNumberOfFootprints)
         {
-            error = ARNETWORK_ERROR_MANAGER_NEW_IOBUFFER;
+            error = ARNETWORK_ERROR_BUFFER_SIZE;
+        }
+
+        if (numberOfFootprints != NULL)
+        {
+            *numberOfFootprints = localNumberOfFootprints;
+        }
+
+        if (totalSize != NULL)
+        {
+            *totalSize = localTotalSize;
         }
-        manager->inputBufferMap [ARNETWORK_MANAGER_INTERNAL_BUFFER_ID_PING] = manager->internalInputBufferArray [inputIndex];
-        inputIndex++;
     }
-    //  - ARNETWORK_MANAGER_INTERNAL_BUFFER_ID_PONG
-    if (error == ARNETWORK_OK)
+
+    return error;
+}
+
+eARNETWORK_ERROR ARNETWORK_Manager_SendData (ARNETWORK_Manager_t *manager, int inputBufferID, uint8_t *data, int dataSize, void *customData, ARNETWORK_Manager_Callback_t callback, int doDataCopy)
+{
+    /** -- Add data to send in a IOBuffer using fixed size data -- */
+
+    /** local declarations */
+    struct iovec iov;
+
+    iov.iov_base = data;
+    iov.iov_len = dataSize;
+
+    return ARNETWORK_Manager_SendDataV (manager, inputBufferID, &iov, 1, customData, callback, doDataCopy);
+}
+
+eARNETWORK_ERROR ARNETWORK_Manager_SendDataWithTimeout (ARNETWORK_Manager_t *manager, int inputBufferID, uint8_t *data, int dataSize, void *customData, ARNETWORK_Manager_Callback_t callback, int doDataCopy, int timeoutMs)
+{
+    /** -- Add, with timeout, data to send in a IOBuffer using fixed size data -- */
+
+    /** local declarations */
+    struct iovec iov;
+
+    if (timeoutMs < 0)
     {
-        paramPingBuffer.ID = ARNETWORK_MANAGER_INTERNAL_BUFFER_ID_PONG;
-        manager->internalInputBufferArray[inputIndex] = ARNETWORK_IOBuffer_New (&paramPingBuffer, 1);
-        if (manager->internalInputBufferArray[inputIndex] == NULL)
+        return ARNETWORK_ERROR_BAD_PARAMETER;
+    }
+
+    iov.iov_base = data;
+    iov.iov_len = dataSize;
+
+    return ARNETWORK_Manager_AddData (manager, inputBufferID, &iov, 1, customData, callback, doDataCopy, timeoutMs);
+}
+
+eARNETWORK_ERROR ARNETWORK_Manager_SendDataV (ARNETWORK_Manager_t *manager, int inputBufferID, const struct iovec *iov, int iovcnt, void *customData, ARNETWORK_Manager_Callback_t callback, int doDataCopy)
+{
+    /** -- Add data gathered from several pieces to send in a IOBuffer -- */
+
+    return ARNETWORK_Manager_AddData (manager, inputBufferID, iov, iovcnt, customData, callback, doDataCopy, 0);
+}
+
+eARNETWORK_ERROR ARNETWORK_Manager_AddData (ARNETWORK_Manager_t *manager, int inputBufferID, const struct iovec *iov, int iovcnt, void *customData, ARNETWORK_Manager_Callback_t callback, int doDataCopy, int timeoutMs)
+{
+    /** -- Add data gathered from several pieces to send in a IOBuffer, waiting while the IOBuffer is full -- */
+
+    /** local declarations */
+    eARNETWORK_ERROR error = ARNETWORK_OK;
+    ARNETWORK_IOBuffer_t *inputBuffer = NULL;
+    int bufferWasEmpty = 0;
+    int dataSize = 0;
+    int iovIndex = 0;
+    int remainingTimeMs = timeoutMs;
+    struct timespec startTime;
+    struct timespec now;
+
+    /** check paratemters:
+     *  -   the manager ponter is not NUL
+     *  -   the array of pieces is not NULL nor empty
+     *  -   the callback is not NULL
+     */
+    if ((manager == NULL) || (iov == NULL) || (iovcnt <= 0) || (callback == NULL))
+    {
+        error = ARNETWORK_ERROR_BAD_PARAMETER;
+    }
+
+    /** the pieces must not be NULL, and their total size must fit in an int */
+    for (iovIndex = 0; (error == ARNETWORK_OK) && (iovIndex < iovcnt); iovIndex++)
+    {
+        if ((iov[iovIndex].iov_base == NULL) || (iov[iovIndex].iov_len > (size_t) (INT_MAX - dataSize)))
         {
-            error = ARNETWORK_ERROR_MANAGER_NEW_IOBUFFER;
+            error = ARNETWORK_ERROR_BAD_PARAMETER;
+        }
+        else
+        {
+            dataSize += iov[iovIndex].iov_len;
         }
-        manager->inputBufferMap [ARNETWORK_MANAGER_INTERNAL_BUFFER_ID_PONG] = manager->internalInputBufferArray [inputIndex];
-        inputIndex++;
     }
 
-    /* Generate outputs */
-    // Iterate on all ARNETWORK_MANAGER_INTERNAL_BUFFER_ID_XXX values
-    //  - Don't create output buffer for ARNETWORK_MANAGER_INTERNAL_BUFFER_ID_PING;
-    //  - Don't create output buffer for ARNETWORK_MANAGER_INTERNAL_BUFFER_ID_PONG;
+    if (error == ARNETWORK_OK)
+    {
+        /** get the address of the inputBuffer */
+        inputBuffer = ARNETWORK_Manager_AcquireBuffer (manager, manager->inputBufferMap, inputBufferID);
 
-    /* END OF INTERNAL BUFFERS CREATION */
+        if (inputBuffer == NULL)
+        {
+            error = ARNETWORK_ERROR_ID_UNKNOWN;
+        }
+    }
 
-    /** Create the output buffers and the buffers of acknowledgement */
-    for (outputIndex = 0; outputIndex < manager->numberOfOutputWithoutAck && error == ARNETWORK_OK ; ++outputIndex)
+    if (error == ARNETWORK_OK)
+    {
+        /** lock the IOBuffer */
+        error = ARNETWORK_IOBuffer_Lock(inputBuffer);
+    }
+
+    if(error == ARNETWORK_OK)
     {
-        /** check parameters */
-        /** -   all output buffer must have the ability to copy */
-        /** -   id must be within range [ackIdOffset;ARNETWORK_MANAGER_INTERNAL_BUFFER_ID_MAX] */
-        if ((outputParamArray[outputIndex].ID >= (manager->networkALManager->maxIds / 2)) ||
-            (outputParamArray[outputIndex].ID <  ARNETWORK_MANAGER_INTERNAL_BUFFER_ID_MAX) ||
-            (outputParamArray[outputIndex].dataCopyMaxSize == 0))
+        if (inputBuffer->isRemoved)
         {
-            error = ARNETWORK_ERROR_BAD_PARAMETER;
+            /** the IOBuffer has been removed since it was got */
+            error = ARNETWORK_ERROR_ID_UNKNOWN;
+        }
+        else
+        {
+            bufferWasEmpty = ARNETWORK_RingBuffer_IsEmpty(inputBuffer->dataDescriptorRBuffer);
+
+            /** add the data in the inputBuffer */
+            error = ARNETWORK_IOBuffer_AddDataV (inputBuffer, iov, iovcnt, dataSize, customData, callback, doDataCopy);
+        }
+
+        /** while the inputBuffer is full, wait the sender to free a cell, until the timeout */
+        if ((error == ARNETWORK_ERROR_BUFFER_SIZE) && (remainingTimeMs > 0))
+        {
+            ARSAL_Time_GetTime (&startTime);
         }
 
-        /** Check for special (negative) values for dataCopyMaxSize. */
-        if (outputParamArray[outputIndex].dataCopyMaxSize < 0)
+        while ((error == ARNETWORK_ERROR_BUFFER_SIZE) && (remainingTimeMs > 0))
         {
-            if (outputParamArray[outputIndex].dataCopyMaxSize == ARNETWORK_IOBUFFERPARAM_DATACOPYMAXSIZE_USE_MAX)
+            ARNETWORK_IOBuffer_WaitFreeCell (inputBuffer, remainingTimeMs);
+
+            if (inputBuffer->isRemoved)
             {
-                /* Set dataCopyMaxSize to the maximum value allowed by ARNetworkAL. */
-                outputParamArray[outputIndex].dataCopyMaxSize = manager->networkALManager->maxBufferSize;
+                /** the IOBuffer has been removed while waiting */
+                error = ARNETWORK_ERROR_ID_UNKNOWN;
             }
             else
             {
-                error = ARNETWORK_ERROR_BAD_PARAMETER;
+                bufferWasEmpty = ARNETWORK_RingBuffer_IsEmpty(inputBuffer->dataDescriptorRBuffer);
+                error = ARNETWORK_IOBuffer_AddDataV (inputBuffer, iov, iovcnt, dataSize, customData, callback, doDataCopy);
             }
+
+            ARSAL_Time_GetTime (&now);
+            remainingTimeMs = timeoutMs - ARSAL_Time_ComputeTimespecMsTimeDiff (&startTime, &now);
         }
 
+        ARNETWORK_IOBuffer_Unlock(inputBuffer);
+
         if (error == ARNETWORK_OK)
         {
-            /** Create the output buffer */
-            manager->outputBufferArray[outputIndex] = ARNETWORK_IOBuffer_New (&(outputParamArray[outputIndex]), 0);
-            if (manager->outputBufferArray[outputIndex] == NULL)
-            {
-                error = ARNETWORK_ERROR_MANAGER_NEW_IOBUFFER;
-            }
+            ARNETWORK_Trace_Record (manager->trace, ARNETWORK_TRACE_ROLE_APPLICATION, ARNETWORK_TRACE_EVENT_ENQUEUE, inputBufferID, 0, dataSize, 0);
+        }
+        else if (error == ARNETWORK_ERROR_BUFFER_SIZE)
+        {
+            ARNETWORK_Trace_Record (manager->trace, ARNETWORK_TRACE_ROLE_APPLICATION, ARNETWORK_TRACE_EVENT_DROP, inputBufferID, 0, dataSize, ARNETWORK_TRACE_DROP_REASON_INPUT_FULL);
         }
+    }
 
-        if (error == ARNETWORK_OK)
+    if (error == ARNETWORK_OK)
+    {
+        if ((inputBuffer->dataType == ARNETWORKAL_FRAME_TYPE_DATA_LOW_LATENCY) &&
+            (manager->sender->isLowLatencyDirectSend) &&
+            (ARNETWORK_Sender_TrySendDirectly (manager->sender, inputBuffer)))
+        {
+            /** the data has been sent by this thread, no need to wake up the sender */
+        }
+        else if ((inputBuffer->dataType == ARNETWORKAL_FRAME_TYPE_DATA_LOW_LATENCY) ||
+                 (bufferWasEmpty > 0))
         {
-            /** Create the buffer of acknowledgement associated with the output buffer */
+            ARNETWORK_Sender_SignalNewData (manager->sender);
+        }
+    }
 
-            paramNewACK.ID = ARNETWORK_Manager_IDOutputToIDAck (manager->networkALManager, outputParamArray[outputIndex].ID);
-            indexAckOutput = manager->numberOfOutputWithoutAck + outputIndex;
+    ARNETWORK_Manager_ReleaseBuffer (manager, inputBuffer);
 
-            manager->outputBufferArray[indexAckOutput] = ARNETWORK_IOBuffer_New (&paramNewACK, 1);
-            if (manager->outputBufferArray[indexAckOutput] == NULL)
-            {
-                error = ARNETWORK_ERROR_MANAGER_NEW_IOBUFFER;
-            }
+    return error;
+}
+
+eARNETWORK_ERROR ARNETWORK_Manager_ReadData (ARNETWORK_Manager_t *manager, int outputBufferID, uint8_t *data, int dataLimitSize, int *readSize)
+{
+    /** -- Read data received in a IOBuffer using variable size data (blocking function) -- */
+
+    /** local declarations */
+    eARNETWORK_ERROR error = ARNETWORK_OK;
+    ARNETWORK_IOBuffer_t *outputBuffer = NULL;
+    int semError = 0;
+
+    /** check paratemters */
+    if (manager != NULL)
+    {
+        /** get the address of the outputBuffer */
+        outputBuffer = ARNETWORK_Manager_AcquireBuffer (manager, manager->outputBufferMap, outputBufferID);
+
+        /** check outputBuffer */
+        if (outputBuffer == NULL)
+        {
+            error = ARNETWORK_ERROR_ID_UNKNOWN;
         }
+    }
+    else
+    {
+        error = ARNETWORK_ERROR_BAD_PARAMETER;
+    }
 
-        if (error == ARNETWORK_OK)
+    if (error == ARNETWORK_OK)
+    {
+        /** try to take the semaphore */
+        semError = ARSAL_Sem_Wait (&(outputBuffer->outputSem));
+
+        if (semError)
         {
-            /** store buffer of acknowledgement at the end of the output and input buffer lists. */
-            manager->inputBufferArray[manager->numberOfInputWithoutAck + outputIndex] = manager->outputBufferArray[indexAckOutput];
+            switch (errno)
+            {
+            case EAGAIN : /** no semaphore */
+                error = ARNETWORK_ERROR_BUFFER_EMPTY;
+                break;
 
-            /** store the outputBuffer and the buffer of acknowledgement in the IOBuffer Maps*/
-            manager->outputBufferMap[manager->outputBufferArray[outputIndex]->ID] = manager->outputBufferArray[outputIndex];
-            manager->outputBufferMap[manager->outputBufferArray[indexAckOutput]->ID] = manager->outputBufferArray[indexAckOutput];
-            manager->inputBufferMap[manager->outputBufferArray[indexAckOutput]->ID] = manager->outputBufferArray[indexAckOutput];
+            default:
+                error = ARNETWORK_ERROR_SEMAPHORE;
+                break;
+            }
         }
     }
 
-    /** Create the input buffers */
-    for (inputIndex = 0; inputIndex< manager->numberOfInputWithoutAck && error == ARNETWORK_OK ; ++inputIndex)
+    /** read data */
+
+    if (error == ARNETWORK_OK)
+    {
+        /** lock the IOBuffer */
+        error = ARNETWORK_IOBuffer_Lock (outputBuffer);
+    }
+
+    if (error == ARNETWORK_OK)
     {
-        /** check parameters: */
-        /** -   id is smaller than the id acknowledge offset */
-        /** -   dataCopyMaxSize isn't too big */
-        if ((inputParamArray[inputIndex].ID >= (manager->networkALManager->maxIds / 2)) ||
-            (inputParamArray[inputIndex].ID <  ARNETWORK_MANAGER_INTERNAL_BUFFER_ID_MAX))
+        if (outputBuffer->isRemoved)
         {
-            error = ARNETWORK_ERROR_BAD_PARAMETER;
+            /** the IOBuffer has been removed while waiting: give back the semaphore to wake up the next reader */
+            ARSAL_Sem_Post (&(outputBuffer->outputSem));
+            error = ARNETWORK_ERROR_ID_UNKNOWN;
         }
-
-        /** Check for special (negative) values for dataCopyMaxSize. */
-        if (inputParamArray[inputIndex].dataCopyMaxSize < 0)
+        else
         {
-            if (inputParamArray[inputIndex].dataCopyMaxSize == ARNETWORK_IOBUFFERPARAM_DATACOPYMAXSIZE_USE_MAX)
-            {
-                /* Set dataCopyMaxSize to the maximum value allowed by ARNetworkAL (minus the size of the header). */
-                inputParamArray[inputIndex].dataCopyMaxSize = manager->networkALManager->maxBufferSize;
-            }
-            else
+            error = ARNETWORK_IOBuffer_ReadData (outputBuffer, data, dataLimitSize, readSize);
+
+            /** the data not read is kept in the IOBuffer: give back the semaphore */
+            if ((error == ARNETWORK_ERROR_BUFFER_SIZE) || (error == ARNETWORK_ERROR_IOBUFFER_DATA_BORROWED))
             {
-                /* Unknown special value. */
-                error = ARNETWORK_ERROR_BAD_PARAMETER;
+                ARSAL_Sem_Post (&(outputBuffer->outputSem));
             }
         }
 
-        /* Check final buffer size. */
-        if (inputParamArray[inputIndex].dataCopyMaxSize > manager->networkALManager->maxBufferSize)
+        /** unlock the IOBuffer */
+        ARNETWORK_IOBuffer_Unlock (outputBuffer);
+    }
+
+    ARNETWORK_Manager_ReleaseBuffer (manager, outputBuffer);
+
+    return error;
+}
+
+eARNETWORK_ERROR ARNETWORK_Manager_TryReadData (ARNETWORK_Manager_t *manager, int outputBufferID, uint8_t *data, int dataLimitSize, int *readSize)
+{
+    /** -- try to read data received in a IOBuffer using variable size data (non-blocking function) -- */
+
+    /** local declarations */
+    eARNETWORK_ERROR error = ARNETWORK_OK;
+    ARNETWORK_IOBuffer_t *outputBuffer = NULL;
+    int semError = 0;
+
+    /** check paratemters */
+    if (manager != NULL)
+    {
+        /** get the address of the outputBuffer */
+        outputBuffer = ARNETWORK_Manager_AcquireBuffer (manager, manager->outputBufferMap, outputBufferID);
+
+        /** check outputBuffer */
+        if (outputBuffer == NULL)
         {
-            ARSAL_PRINT(ARSAL_PRINT_ERROR, ARNETWORK_MANAGER_TAG, "Final dataCopyMaxSize is higher than tha maximum allowed data size (%d).", manager->networkALManager->maxBufferSize);
-            error = ARNETWORK_ERROR_BAD_PARAMETER;
+            error = ARNETWORK_ERROR_ID_UNKNOWN;
         }
+    }
+    else
+    {
+        error = ARNETWORK_ERROR_BAD_PARAMETER;
+    }
 
-        if (error == ARNETWORK_OK)
+    if (error == ARNETWORK_OK)
+    {
+        /** try to take the semaphore */
+        semError = ARSAL_Sem_Trywait (&(outputBuffer->outputSem));
+
+        if (semError)
         {
-            /** Create the intput buffer */
-            manager->inputBufferArray[inputIndex] = ARNETWORK_IOBuffer_New (&(inputParamArray[inputIndex]), 0);
-            if (manager->inputBufferArray[inputIndex] == NULL)
+            switch (errno)
             {
-                error = ARNETWORK_ERROR_MANAGER_NEW_IOBUFFER;
+            case EAGAIN : /** no semaphore */
+                error = ARNETWORK_ERROR_BUFFER_EMPTY;
+                break;
+
+            default:
+                error = ARNETWORK_ERROR_SEMAPHORE;
+                break;
             }
         }
+    }
 
-        if (error == ARNETWORK_OK)
+    /** read data */
+
+    if (error == ARNETWORK_OK)
+    {
+        /** lock the IOBuffer */
+        error = ARNETWORK_IOBuffer_Lock (outputBuffer);
+    }
+
+    if (error == ARNETWORK_OK)
+    {
+        if (outputBuffer->isRemoved)
         {
-            /** store the inputBuffer in the ioBuffer Map */
-            manager->inputBufferMap[manager->inputBufferArray[inputIndex]->ID] = manager->inputBufferArray[inputIndex];
+            /** the IOBuffer has been removed while waiting: give back the semaphore to wake up the next reader */
+            ARSAL_Sem_Post (&(outputBuffer->outputSem));
+            error = ARNETWORK_ERROR_ID_UNKNOWN;
+        }
+        else
+        {
+            error = ARNETWORK_IOBuffer_ReadData (outputBuffer, data, dataLimitSize, readSize);
+
+            /** the data not read is kept in the IOBuffer: give back the semaphore */
+            if ((error == ARNETWORK_ERROR_BUFFER_SIZE) || (error == ARNETWORK_ERROR_IOBUFFER_DATA_BORROWED))
+            {
+                ARSAL_Sem_Post (&(outputBuffer->outputSem));
+            }
         }
+
+        /** unlock the IOBuffer */
+        ARNETWORK_IOBuffer_Unlock (outputBuffer);
+    }
+
+    ARNETWORK_Manager_ReleaseBuffer (manager, outputBuffer);
+
+    return error;
+}
+
+eARNETWORK_ERROR ARNETWORK_Manager_ReadDataWithTimeout (ARNETWORK_Manager_t *manager, int outputBufferID, uint8_t *data, int dataLimitSize, int *readSize, int timeoutMs)
+{
+    /** -- Read, with timeout, a data received in IOBuffer using variable size data -- */
+
+    /** local declarations */
+    eARNETWORK_ERROR error = ARNETWORK_OK;
+    ARNETWORK_IOBuffer_t *outputBuffer = NULL;
+    int semError = 0;
+    struct timespec semTimeout;
+
+    /** check paratemters */
+    if (manager != NULL)
+    {
+        outputBuffer = ARNETWORK_Manager_AcquireBuffer (manager, manager->outputBufferMap, outputBufferID);
+
+        /** check pOutputBuffer */
+        if (outputBuffer == NULL)
+        {
+            error = ARNETWORK_ERROR_ID_UNKNOWN;
+        }
+    }
+    else
+    {
+        error = ARNETWORK_ERROR_BAD_PARAMETER;
+    }
+
+    if (error == ARNETWORK_OK)
+    {
+        /** convert timeoutMs in timespec */
+        semTimeout.tv_sec = timeoutMs / 1000;
+        semTimeout.tv_nsec = (timeoutMs % 1000) * 1000000;
+
+        /** try to take the semaphore with timeout*/
+        semError = ARSAL_Sem_Timedwait (&(outputBuffer->outputSem), &semTimeout);
+
+        if (semError)
+        {
+            switch (errno)
+            {
+            case ETIMEDOUT : /** semaphore time out */
+                error = ARNETWORK_ERROR_BUFFER_EMPTY;
+                break;
+
+            default:
+                error = ARNETWORK_ERROR_SEMAPHORE;
+                break;
+            }
+        }
+    }
+
+    /** read data */
+
+    if (error == ARNETWORK_OK)
+    {
+        /** lock the IOBuffer */
+        error = ARNETWORK_IOBuffer_Lock (outputBuffer);
+    }
+
+    if (error == ARNETWORK_OK)
+    {
+        if (outputBuffer->isRemoved)
+        {
+            /** the IOBuffer has been removed while waiting: give back the semaphore to wake up the next reader */
+            ARSAL_Sem_Post (&(outputBuffer->outputSem));
+            error = ARNETWORK_ERROR_ID_UNKNOWN;
+        }
+        else
+        {
+            error = ARNETWORK_IOBuffer_ReadData (outputBuffer, data, dataLimitSize, readSize);
+
+            /** the data not read is kept in the IOBuffer: give back the semaphore */
+            if ((error == ARNETWORK_ERROR_BUFFER_SIZE) || (error == ARNETWORK_ERROR_IOBUFFER_DATA_BORROWED))
+            {
+                ARSAL_Sem_Post (&(outputBuffer->outputSem));
+            }
+        }
+
+        /** unlock the IOBuffer */
+        ARNETWORK_IOBuffer_Unlock (outputBuffer);
+    }
+
+    ARNETWORK_Manager_ReleaseBuffer (manager, outputBuffer);
+
+    return error;
+}
+
+eARNETWORK_ERROR ARNETWORK_Manager_ReadDataBatch (ARNETWORK_Manager_t *manager, int outputBufferID, uint8_t *arena, int arenaSize, ARNETWORK_Manager_DataRecord_t *recordArray, int maxNumberOfRecords, int *numberOfRecords)
+{
+    /** -- Read many data received in a IOBuffer (blocking function) -- */
+
+    /** local declarations */
+    eARNETWORK_ERROR error = ARNETWORK_OK;
+    ARNETWORK_IOBuffer_t *outputBuffer = NULL;
+    int semError = 0;
+
+    /** check paratemters */
+    if ((manager != NULL) && (arena != NULL) && (recordArray != NULL) && (maxNumberOfRecords > 0) && (numberOfRecords != NULL))
+    {
+        *numberOfRecords = 0;
+
+        /** get the address of the outputBuffer */
+        outputBuffer = ARNETWORK_Manager_AcquireBuffer (manager, manager->outputBufferMap, outputBufferID);
+
+        /** check outputBuffer */
+        if (outputBuffer == NULL)
+        {
+            error = ARNETWORK_ERROR_ID_UNKNOWN;
+        }
+    }
+    else
+    {
+        error = ARNETWORK_ERROR_BAD_PARAMETER;
+    }
+
+    if (error == ARNETWORK_OK)
+    {
+        /** try to take the semaphore of the first data */
+        semError = ARSAL_Sem_Wait (&(outputBuffer->outputSem));
+
+        if (semError)
+        {
+            switch (errno)
+            {
+            case EAGAIN : /** no semaphore */
+                error = ARNETWORK_ERROR_BUFFER_EMPTY;
+                break;
+
+            default:
+                error = ARNETWORK_ERROR_SEMAPHORE;
+                break;
+            }
+        }
+    }
+
+    /** read data */
+
+    if (error == ARNETWORK_OK)
+    {
+        error = ARNETWORK_Manager_ReadDataBatchLocked (outputBuffer, arena, arenaSize, recordArray, maxNumberOfRecords, numberOfRecords);
+    }
+
+    ARNETWORK_Manager_ReleaseBuffer (manager, outputBuffer);
+
+    return error;
+}
+
+eARNETWORK_ERROR ARNETWORK_Manager_TryReadDataBatch (ARNETWORK_Manager_t *manager, int outputBufferID, uint8_t *arena, int arenaSize, ARNETWORK_Manager_DataRecord_t *recordArray, int maxNumberOfRecords, int *numberOfRecords)
+{
+    /** -- try to read many data received in a IOBuffer (non-blocking function) -- */
+
+    /** local declarations */
+    eARNETWORK_ERROR error = ARNETWORK_OK;
+    ARNETWORK_IOBuffer_t *outputBuffer = NULL;
+    int semError = 0;
+
+    /** check paratemters */
+    if ((manager != NULL) && (arena != NULL) && (recordArray != NULL) && (maxNumberOfRecords > 0) && (numberOfRecords != NULL))
+    {
+        *numberOfRecords = 0;
+
+        /** get the address of the outputBuffer */
+        outputBuffer = ARNETWORK_Manager_AcquireBuffer (manager, manager->outputBufferMap, outputBufferID);
+
+        /** check outputBuffer */
+        if (outputBuffer == NULL)
+        {
+            error = ARNETWORK_ERROR_ID_UNKNOWN;
+        }
+    }
+    else
+    {
+        error = ARNETWORK_ERROR_BAD_PARAMETER;
+    }
+
+    if (error == ARNETWORK_OK)
+    {
+        /** try to take the semaphore of the first data */
+        semError = ARSAL_Sem_Trywait (&(outputBuffer->outputSem));
+
+        if (semError)
+        {
+            switch (errno)
+            {
+            case EAGAIN : /** no semaphore */
+                error = ARNETWORK_ERROR_BUFFER_EMPTY;
+                break;
+
+            default:
+                error = ARNETWORK_ERROR_SEMAPHORE;
+                break;
+            }
+        }
+    }
+
+    /** read data */
+
+    if (error == ARNETWORK_OK)
+    {
+        error = ARNETWORK_Manager_ReadDataBatchLocked (outputBuffer, arena, arenaSize, recordArray, maxNumberOfRecords, numberOfRecords);
+    }
+
+    ARNETWORK_Manager_ReleaseBuffer (manager, outputBuffer);
+
+    return error;
+}
+
+eARNETWORK_ERROR ARNETWORK_Manager_ReadDataBatchWithTimeout (ARNETWORK_Manager_t *manager, int outputBufferID, uint8_t *arena, int arenaSize, ARNETWORK_Manager_DataRecord_t *recordArray, int maxNumberOfRecords, int *numberOfRecords, int timeoutMs)
+{
+    /** -- Read, with timeout, many data received in a IOBuffer -- */
+
+    /** local declarations */
+    eARNETWORK_ERROR error = ARNETWORK_OK;
+    ARNETWORK_IOBuffer_t *outputBuffer = NULL;
+    int semError = 0;
+    struct timespec semTimeout;
+
+    /** check paratemters */
+    if ((manager != NULL) && (arena != NULL) && (recordArray != NULL) && (maxNumberOfRecords > 0) && (numberOfRecords != NULL))
+    {
+        *numberOfRecords = 0;
+
+        /** get the address of the outputBuffer */
+        outputBuffer = ARNETWORK_Manager_AcquireBuffer (manager, manager->outputBufferMap, outputBufferID);
+
+        /** check outputBuffer */
+        if (outputBuffer == NULL)
+        {
+            error = ARNETWORK_ERROR_ID_UNKNOWN;
+        }
+    }
+    else
+    {
+        error = ARNETWORK_ERROR_BAD_PARAMETER;
+    }
+
+    if (error == ARNETWORK_OK)
+    {
+        /** convert timeoutMs in timespec */
+        semTimeout.tv_sec = timeoutMs / 1000;
+        semTimeout.tv_nsec = (timeoutMs % 1000) * 1000000;
+
+        /** try to take the semaphore of the first data with timeout*/
+        semError = ARSAL_Sem_Timedwait (&(outputBuffer->outputSem), &semTimeout);
+
+        if (semError)
+        {
+            switch (errno)
+            {
+            case ETIMEDOUT : /** semaphore time out */
+                error = ARNETWORK_ERROR_BUFFER_EMPTY;
+                break;
+
+            default:
+                error = ARNETWORK_ERROR_SEMAPHORE;
+                break;
+            }
+        }
+    }
+
+    /** read data */
+
+    if (error == ARNETWORK_OK)
+    {
+        error = ARNETWORK_Manager_ReadDataBatchLocked (outputBuffer, arena, arenaSize, recordArray, maxNumberOfRecords, numberOfRecords);
+    }
+
+    ARNETWORK_Manager_ReleaseBuffer (manager, outputBuffer);
+
+    return error;
+}
+
+int ARNETWORK_Manager_GetReadyFd (ARNETWORK_Manager_t *manager)
+{
+    /** -- Get the file descriptor readable when output buffers are ready to be read -- */
+
+    if (manager == NULL)
+    {
+        return ARNETWORK_ERROR_BAD_PARAMETER;
+    }
+
+    return manager->notifier->readFd;
+}
+
+eARNETWORK_ERROR ARNETWORK_Manager_GetReadyBuffers (ARNETWORK_Manager_t *manager, int *outputBufferIDArray, int maxNumberOfIDs, int *numberOfIDs)
+{
+    /** -- Get the identifiers of the output buffers ready to be read -- */
+
+    /** local declarations */
+    eARNETWORK_ERROR error = ARNETWORK_OK;
+    ARNETWORK_IOBuffer_t *outputBuffer = NULL;
+    int bufferIndex = 0;
+    int numberOfReady = 0;
+    int isChecking = 1;
+
+    /** check paratemters */
+    if ((manager == NULL) || (outputBufferIDArray == NULL) || (numberOfIDs == NULL))
+    {
+        error = ARNETWORK_ERROR_BAD_PARAMETER;
+    }
+
+    if (error == ARNETWORK_OK)
+    {
+        /** clear the notifier before to check the buffers: a buffer becoming ready after the check signals it again */
+        ARNETWORK_Notifier_Clear (manager->notifier);
+
+        /** check the output buffers but not the buffers of acknowledgement ; each one is held while checked, the list being changed by the removal of a buffer */
+        for (bufferIndex = 0; isChecking; bufferIndex++)
+        {
+            ARSAL_Mutex_Lock (&(manager->buffersMutex));
+            if ((bufferIndex < manager->numberOfOutputWithoutAck) && (numberOfReady < maxNumberOfIDs))
+            {
+                outputBuffer = manager->outputBufferArray[bufferIndex];
+                outputBuffer->numberOfUsers++;
+            }
+            else
+            {
+                isChecking = 0;
+            }
+            ARSAL_Mutex_Unlock (&(manager->buffersMutex));
+
+            if (isChecking)
+            {
+                if (ARNETWORK_IOBuffer_Lock (outputBuffer) == ARNETWORK_OK)
+                {
+                    if (ARNETWORK_RingBuffer_GetNumberOfData (outputBuffer->dataDescriptorRBuffer) > outputBuffer->isBorrowed)
+                    {
+                        outputBufferIDArray[numberOfReady] = outputBuffer->ID;
+                        numberOfReady++;
+                    }
+
+                    ARNETWORK_IOBuffer_Unlock (outputBuffer);
+                }
+
+                ARNETWORK_Manager_ReleaseBuffer (manager, outputBuffer);
+            }
+        }
+
+        *numberOfIDs = numberOfReady;
+    }
+
+    return error;
+}
+
+eARNETWORK_ERROR ARNETWORK_Manager_ReadAny (ARNETWORK_Manager_t *manager, const int *outputBufferIDArray, int numberOfIDs, uint8_t *data, int dataLimitSize, int *readSize, int *outputBufferID, int timeoutMs)
+{
+    /** -- Read, with timeout, a data received in any of several IOBuffers -- */
+
+    /** local declarations */
+    eARNETWORK_ERROR error = ARNETWORK_OK;
+    int idIndex = 0;
+    int remainingTimeMs = timeoutMs;
+    int isWaiting = 0;
+    uint32_t generation = 0;
+    struct timespec startTime;
+    struct timespec now;
+
+    /** check paratemters */
+    if ((manager == NULL) ||
+        (outputBufferIDArray == NULL) ||
+        (numberOfIDs <= 0) ||
+        (outputBufferID == NULL) ||
+        (timeoutMs < 0))
+    {
+        error = ARNETWORK_ERROR_BAD_PARAMETER;
+    }
+
+    for (idIndex = 0; (error == ARNETWORK_OK) && (idIndex < numberOfIDs); idIndex++)
+    {
+        if ((outputBufferIDArray[idIndex] < 0) || (outputBufferIDArray[idIndex] >= manager->networkALManager->maxIds))
+        {
+            error = ARNETWORK_ERROR_BAD_PARAMETER;
+        }
+    }
+
+    if (error == ARNETWORK_OK)
+    {
+        ARSAL_Time_GetTime (&startTime);
+        isWaiting = 1;
+    }
+
+    while (isWaiting)
+    {
+        /** the generation is read before the check, so that a data received during the check ends the wait */
+        generation = ARNETWORK_Notifier_GetGeneration (manager->notifier);
+
+        /** the output buffers are checked in the order of the array */
+        error = ARNETWORK_ERROR_BUFFER_EMPTY;
+        for (idIndex = 0; (error == ARNETWORK_ERROR_BUFFER_EMPTY) && (idIndex < numberOfIDs); idIndex++)
+        {
+            *outputBufferID = outputBufferIDArray[idIndex];
+            error = ARNETWORK_Manager_TryReadData (manager, *outputBufferID, data, dataLimitSize, readSize);
+        }
+
+        if (error == ARNETWORK_ERROR_BUFFER_EMPTY)
+        {
+            ARSAL_Time_GetTime (&now);
+            remainingTimeMs = timeoutMs - ARSAL_Time_ComputeTimespecMsTimeDiff (&startTime, &now);
+
+            if (remainingTimeMs > 0)
+            {
+                /** wait an output buffer becoming ready ; the buffers are checked again after any wake up */
+                ARNETWORK_Notifier_Wait (manager->notifier, generation, remainingTimeMs);
+            }
+            else
+            {
+                *outputBufferID = -1;
+                isWaiting = 0;
+            }
+        }
+        else
+        {
+            /** a data is read, or the error of its buffer is returned */
+            isWaiting = 0;
+        }
+    }
+
+    return error;
+}
+
+eARNETWORK_ERROR ARNETWORK_Manager_ReadDataBorrow (ARNETWORK_Manager_t *manager, int outputBufferID, uint8_t **data, int *dataSize, int timeoutMs)
+{
+    /** -- Borrow, with timeout, a data received in IOBuffer without copy -- */
+
+    /** local declarations */
+    eARNETWORK_ERROR error = ARNETWORK_OK;
+    ARNETWORK_IOBuffer_t *outputBuffer = NULL;
+    int semError = 0;
+    struct timespec semTimeout;
+
+    /** check paratemters */
+    if ((manager != NULL) && (data != NULL) && (dataSize != NULL))
+    {
+        outputBuffer = ARNETWORK_Manager_AcquireBuffer (manager, manager->outputBufferMap, outputBufferID);
+
+        /** check pOutputBuffer */
+        if (outputBuffer == NULL)
+        {
+            error = ARNETWORK_ERROR_ID_UNKNOWN;
+        }
+    }
+    else
+    {
+        error = ARNETWORK_ERROR_BAD_PARAMETER;
+    }
+
+    if (error == ARNETWORK_OK)
+    {
+        if (timeoutMs < 0)
+        {
+            /** wait the semaphore without timeout */
+            semError = ARSAL_Sem_Wait (&(outputBuffer->outputSem));
+        }
+        else
+        {
+            /** convert timeoutMs in timespec */
+            semTimeout.tv_sec = timeoutMs / 1000;
+            semTimeout.tv_nsec = (timeoutMs % 1000) * 1000000;
+
+            /** try to take the semaphore with timeout*/
+            semError = ARSAL_Sem_Timedwait (&(outputBuffer->outputSem), &semTimeout);
+        }
+
+        if (semError)
+        {
+            switch (errno)
+            {
+            case ETIMEDOUT : /** semaphore time out */
+            case EAGAIN : /** no semaphore */
+                error = ARNETWORK_ERROR_BUFFER_EMPTY;
+                break;
+
+            default:
+                error = ARNETWORK_ERROR_SEMAPHORE;
+                break;
+            }
+        }
+    }
+
+    /** borrow data */
+
+    if (error == ARNETWORK_OK)
+    {
+        /** lock the IOBuffer */
+        error = ARNETWORK_IOBuffer_Lock (outputBuffer);
+    }
+
+    if (error == ARNETWORK_OK)
+    {
+        /** the removal of the IOBuffer, refused while a data is borrowed, is checked under the same lock */
+        if (outputBuffer->isRemoved)
+        {
+            /** the IOBuffer has been removed while waiting: give back the semaphore to wake up the next reader */
+            ARSAL_Sem_Post (&(outputBuffer->outputSem));
+            error = ARNETWORK_ERROR_ID_UNKNOWN;
+        }
+        else
+        {
+            error = ARNETWORK_IOBuffer_BorrowData (outputBuffer, data, dataSize);
+
+            /** the data is kept in the IOBuffer if it is already borrowed: give back the semaphore */
+            if (error == ARNETWORK_ERROR_IOBUFFER_DATA_BORROWED)
+            {
+                ARSAL_Sem_Post (&(outputBuffer->outputSem));
+            }
+        }
+
+        /** unlock the IOBuffer */
+        ARNETWORK_IOBuffer_Unlock (outputBuffer);
+    }
+
+    ARNETWORK_Manager_ReleaseBuffer (manager, outputBuffer);
+
+    return error;
+}
+
+eARNETWORK_ERROR ARNETWORK_Manager_ReleaseData (ARNETWORK_Manager_t *manager, int outputBufferID)
+{
+    /** -- Release the data borrowed in an IOBuffer -- */
+
+    /** local declarations */
+    eARNETWORK_ERROR error = ARNETWORK_OK;
+    ARNETWORK_IOBuffer_t *outputBuffer = NULL;
+
+    /** check paratemters */
+    if (manager != NULL)
+    {
+        outputBuffer = ARNETWORK_Manager_AcquireBuffer (manager, manager->outputBufferMap, outputBufferID);
+
+        /** check pOutputBuffer */
+        if (outputBuffer == NULL)
+        {
+            error = ARNETWORK_ERROR_ID_UNKNOWN;
+        }
+    }
+    else
+    {
+        error = ARNETWORK_ERROR_BAD_PARAMETER;
+    }
+
+    if (error == ARNETWORK_OK)
+    {
+        /** lock the IOBuffer */
+        error = ARNETWORK_IOBuffer_Lock (outputBuffer);
+    }
+
+    if (error == ARNETWORK_OK)
+    {
+        error = ARNETWORK_IOBuffer_ReleaseData (outputBuffer);
+
+        /** unlock the IOBuffer */
+        ARNETWORK_IOBuffer_Unlock (outputBuffer);
+    }
+
+    ARNETWORK_Manager_ReleaseBuffer (manager, outputBuffer);
+
+    return error;
+}
+
+/*****************************************
+ *
+ *             private implementation:
+ *
+ *****************************************/
+
+eARNETWORK_ERROR ARNETWORK_Manager_CreateIOBuffer (ARNETWORK_Manager_t *manager, ARNETWORK_IOBufferParam_t *inputParamArray, ARNETWORK_IOBufferParam_t *outputParamArray)
+{
+    /** -- Create manager's IoBuffers --*/
+
+    /** local declarations */
+    eARNETWORK_ERROR error = ARNETWORK_OK;
+    int inputIndex = 0;
+    int outputIndex = 0;
+    int indexAckOutput = 0;
+    ARNETWORK_IOBufferParam_t paramPingBuffer;
+    ARNETWORK_IOBufferParam_t paramCoalescedACK;
+
+    /** Initialize the ping buffers and the coalesced acknowledgments buffer parameters */
+    ARNETWORK_Manager_InitInternalParams (manager->networkALManager, &paramPingBuffer, &paramCoalescedACK);
+
+    /**
+     *  For each output buffer a buffer of acknowledgement is add and referenced
+     *  in the output buffer list and the input buffer list.
+     */
+
+    /*
+     * Create the input/output buffers for the "library reserved" part
+     * - Start by creating the input-only buffers
+     * - Then create all output buffers, and add loopback buffers to the end of the internal input buffers
+     */
+    outputIndex = 0;
+    inputIndex  = 0;
+    /* Generate inputs */
+    // Iterate on all ARNETWORK_MANAGER_INTERNAL_BUFFER_ID_XXX values
+    //  - ARNETWORK_MANAGER_INTERNAL_BUFFER_ID_PING
+    if (error == ARNETWORK_OK)
+    {
+        paramPingBuffer.ID = ARNETWORK_MANAGER_INTERNAL_BUFFER_ID_PING;
+        manager->internalInputBufferArray[inputIndex] = ARNETWORK_IOBuffer_NewInArena (&paramPingBuffer, 1, manager->arena);
+        if (manager->internalInputBufferArray[inputIndex] == NULL)
+        {
+            error = ARNETWORK_ERROR_MANAGER_NEW_IOBUFFER;
+        }
+        manager->inputBufferMap [ARNETWORK_MANAGER_INTERNAL_BUFFER_ID_PING] = manager->internalInputBufferArray [inputIndex];
+        inputIndex++;
+    }
+    //  - ARNETWORK_MANAGER_INTERNAL_BUFFER_ID_PONG
+    if (error == ARNETWORK_OK)
+    {
+        paramPingBuffer.ID = ARNETWORK_MANAGER_INTERNAL_BUFFER_ID_PONG;
+        manager->internalInputBufferArray[inputIndex] = ARNETWORK_IOBuffer_NewInArena (&paramPingBuffer, 1, manager->arena);
+        if (manager->internalInputBufferArray[inputIndex] == NULL)
+        {
+            error = ARNETWORK_ERROR_MANAGER_NEW_IOBUFFER;
+        }
+        manager->inputBufferMap [ARNETWORK_MANAGER_INTERNAL_BUFFER_ID_PONG] = manager->internalInputBufferArray [inputIndex];
+        inputIndex++;
+    }
+    //  - ARNETWORK_MANAGER_INTERNAL_BUFFER_ID_ACK_COALESCED
+    if (error == ARNETWORK_OK)
+    {
+        manager->internalInputBufferArray[inputIndex] = ARNETWORK_IOBuffer_NewInArena (&paramCoalescedACK, 1, manager->arena);
+        if (manager->internalInputBufferArray[inputIndex] == NULL)
+        {
+            error = ARNETWORK_ERROR_MANAGER_NEW_IOBUFFER;
+        }
+        manager->inputBufferMap [ARNETWORK_MANAGER_INTERNAL_BUFFER_ID_ACK_COALESCED] = manager->internalInputBufferArray [inputIndex];
+        inputIndex++;
+    }
+
+    /* Generate outputs */
+    // Iterate on all ARNETWORK_MANAGER_INTERNAL_BUFFER_ID_XXX values
+    //  - Don't create output buffer for ARNETWORK_MANAGER_INTERNAL_BUFFER_ID_PING;
+    //  - Don't create output buffer for ARNETWORK_MANAGER_INTERNAL_BUFFER_ID_PONG;
+    //  - Don't create output buffer for ARNETWORK_MANAGER_INTERNAL_BUFFER_ID_ACK_COALESCED;
+
+    /* END OF INTERNAL BUFFERS CREATION */
+
+    /** Create the output buffers and the buffers of acknowledgement */
+    for (outputIndex = 0; outputIndex < manager->numberOfOutputWithoutAck && error == ARNETWORK_OK ; ++outputIndex)
+    {
+        indexAckOutput = manager->numberOfOutputWithoutAck + outputIndex;
+        error = ARNETWORK_Manager_NewOutputBuffer (manager, &(outputParamArray[outputIndex]), manager->arena, &(manager->outputBufferArray[outputIndex]), &(manager->outputBufferArray[indexAckOutput]));
+
+        if (error == ARNETWORK_OK)
+        {
+            /** store buffer of acknowledgement at the end of the output and input buffer lists. */
+            manager->inputBufferArray[manager->numberOfInputWithoutAck + outputIndex] = manager->outputBufferArray[indexAckOutput];
+
+            /** store the outputBuffer and the buffer of acknowledgement in the IOBuffer Maps*/
+            manager->outputBufferMap[manager->outputBufferArray[outputIndex]->ID] = manager->outputBufferArray[outputIndex];
+            manager->outputBufferMap[manager->outputBufferArray[indexAckOutput]->ID] = manager->outputBufferArray[indexAckOutput];
+            manager->inputBufferMap[manager->outputBufferArray[indexAckOutput]->ID] = manager->outputBufferArray[indexAckOutput];
+        }
+    }
+
+    /** Create the input buffers */
+    for (inputIndex = 0; inputIndex< manager->numberOfInputWithoutAck && error == ARNETWORK_OK ; ++inputIndex)
+    {
+        manager->inputBufferArray[inputIndex] = ARNETWORK_Manager_NewInputBuffer (manager, &(inputParamArray[inputIndex]), manager->arena, &error);
+
+        if (error == ARNETWORK_OK)
+        {
+            /** store the inputBuffer in the ioBuffer Map */
+            manager->inputBufferMap[manager->inputBufferArray[inputIndex]->ID] = manager->inputBufferArray[inputIndex];
+        }
+    }
+
+    return error;
+}
+
+void ARNETWORK_Manager_InitInternalParams (ARNETWORKAL_Manager_t *alManager, ARNETWORK_IOBufferParam_t *pingParam, ARNETWORK_IOBufferParam_t *coalescedAckParam)
+{
+    /** -- Initialize the parameters of the internal buffers -- */
+
+    /** Initialize the ping buffers parameters */
+    ARNETWORK_IOBufferParam_DefaultInit (pingParam);
+    pingParam->dataType = ARNETWORKAL_FRAME_TYPE_DATA;
+    pingParam->numberOfCell = 1;
+    /* the ping frames carry the credits of the output buffers after their timestamp */
+    pingParam->dataCopyMaxSize = sizeof (struct timespec) + alManager->maxIds * ARNETWORK_SENDER_CREDITS_SIZE;
+    pingParam->isOverwriting = 1;
+    /* the internal buffers are not seen by the wait of the sender: a pong, or an advertisement of credits, is sent at once */
+    pingParam->sendingWaitTimeMs = 0;
+
+    /** Initialize the coalesced acknowledgments buffer parameters: one pair of identifier and sequence number by buffer at most */
+    ARNETWORK_IOBufferParam_DefaultInit (coalescedAckParam);
+    coalescedAckParam->ID = ARNETWORK_MANAGER_INTERNAL_BUFFER_ID_ACK_COALESCED;
+    coalescedAckParam->dataType = ARNETWORKAL_FRAME_TYPE_ACK;
+    coalescedAckParam->numberOfCell = ARNETWORK_MANAGER_COALESCED_ACK_NUMBER_OF_CELLS;
+    coalescedAckParam->dataCopyMaxSize = alManager->maxIds * ARNETWORK_SENDER_COALESCED_ACK_SIZE;
+    coalescedAckParam->isOverwriting = 0;
+    /* the internal buffers are not seen by the wait of the sender: all the frames pending are sent at once */
+    coalescedAckParam->sendingWaitTimeMs = 0;
+    coalescedAckParam->sendingBurstSize = ARNETWORK_MANAGER_COALESCED_ACK_NUMBER_OF_CELLS;
+}
+
+void ARNETWORK_Manager_InitAckParam (ARNETWORK_IOBufferParam_t *ackParam, int isFragmenting)
+{
+    /** -- Initialize the parameters of the buffer of acknowledgement of an output buffer -- */
+
+    ARNETWORK_IOBufferParam_DefaultInit (ackParam);
+    ackParam->dataType = ARNETWORKAL_FRAME_TYPE_ACK;
+    ackParam->numberOfCell = 1;
+    /* the acknowledgement of a buffer controlled by credits carries its credits after the sequence number */
+    ackParam->dataCopyMaxSize = ARNETWORK_RECEIVER_CREDIT_ACK_SIZE;
+    ackParam->isOverwriting = 0;
+
+    /** the buffers of acknowledgement of the fragmenting buffers receive up to a window of fragments at once */
+    if (isFragmenting)
+    {
+        ackParam->numberOfCell = ARNETWORK_IOBUFFERPARAM_FRAGMENTING_WINDOW_MAX;
+        ackParam->sendingWaitTimeMs = 0;
+        ackParam->sendingBurstSize = ARNETWORK_IOBUFFERPARAM_FRAGMENTING_WINDOW_MAX;
+    }
+}
+
+eARNETWORK_ERROR ARNETWORK_Manager_NewOutputBuffer (ARNETWORK_Manager_t *manager, ARNETWORK_IOBufferParam_t *outputParam, ARNETWORK_Arena_t *arena, ARNETWORK_IOBuffer_t **outputBufferPtrAddr, ARNETWORK_IOBuffer_t **ackBufferPtrAddr)
+{
+    /** -- Create an output buffer and its buffer of acknowledgement -- */
+
+    /** local declarations */
+    eARNETWORK_ERROR error = ARNETWORK_OK;
+    ARNETWORK_IOBufferParam_t paramACK;
+
+    *outputBufferPtrAddr = NULL;
+    *ackBufferPtrAddr = NULL;
+
+    /** Initialize the default parameters for the buffer of acknowledgement. */
+    ARNETWORK_Manager_InitAckParam (&paramACK, outputParam->isFragmenting);
+
+    /** check parameters */
+    /** -   all output buffer must have the ability to copy */
+    /** -   id must be within range [ackIdOffset;ARNETWORK_MANAGER_INTERNAL_BUFFER_ID_MAX] */
+    if ((outputParam->ID >= (manager->networkALManager->maxIds / 2)) ||
+        (outputParam->ID <  ARNETWORK_MANAGER_INTERNAL_BUFFER_ID_MAX) ||
+        (outputParam->dataCopyMaxSize == 0))
+    {
+        error = ARNETWORK_ERROR_BAD_PARAMETER;
+    }
+
+    /** Check for special (negative) values for dataCopyMaxSize. */
+    if (outputParam->dataCopyMaxSize < 0)
+    {
+        if (outputParam->dataCopyMaxSize == ARNETWORK_IOBUFFERPARAM_DATACOPYMAXSIZE_USE_MAX)
+        {
+            /* Set dataCopyMaxSize to the maximum value allowed by ARNetworkAL. */
+            outputParam->dataCopyMaxSize = manager->networkALManager->maxBufferSize;
+        }
+        else
+        {
+            error = ARNETWORK_ERROR_BAD_PARAMETER;
+        }
+    }
+
+    if (error == ARNETWORK_OK)
+    {
+        /** Create the output buffer */
+        (*outputBufferPtrAddr) = ARNETWORK_IOBuffer_NewInArena (outputParam, 0, arena);
+        if ((*outputBufferPtrAddr) == NULL)
+        {
+            error = ARNETWORK_ERROR_MANAGER_NEW_IOBUFFER;
+        }
+    }
+
+    if ((error == ARNETWORK_OK) && (outputParam->isFragmenting))
+    {
+        /** Allocate the reassembly of the messages of the output buffer */
+        error = ARNETWORK_IOBuffer_NewReassembly (*outputBufferPtrAddr);
+    }
+
+    if (error == ARNETWORK_OK)
+    {
+        /** Create the buffer of acknowledgement associated with the output buffer */
+
+        paramACK.ID = ARNETWORK_Manager_IDOutputToIDAck (manager->networkALManager, outputParam->ID);
+
+        (*ackBufferPtrAddr) = ARNETWORK_IOBuffer_NewInArena (&paramACK, 1, arena);
+        if ((*ackBufferPtrAddr) == NULL)
+        {
+            error = ARNETWORK_ERROR_MANAGER_NEW_IOBUFFER;
+        }
+    }
+
+    /** delete the buffers created if an error occurred */
+    if (error != ARNETWORK_OK)
+    {
+        ARNETWORK_IOBuffer_Delete (outputBufferPtrAddr);
+        ARNETWORK_IOBuffer_Delete (ackBufferPtrAddr);
+    }
+
+    return error;
+}
+
+ARNETWORK_IOBuffer_t* ARNETWORK_Manager_AcquireBuffer (ARNETWORK_Manager_t *manager, ARNETWORK_IOBuffer_t **bufferMap, int bufferID)
+{
+    /** -- get a buffer by its identifier, and hold it -- */
+
+    /** local declarations */
+    ARNETWORK_IOBuffer_t *buffer = NULL;
+
+    if ((bufferID >= 0) && (bufferID < manager->networkALManager->maxIds))
+    {
+        ARSAL_Mutex_Lock (&(manager->buffersMutex));
+
+        buffer = bufferMap[bufferID];
+        if (buffer != NULL)
+        {
+            buffer->numberOfUsers++;
+        }
+
+        ARSAL_Mutex_Unlock (&(manager->buffersMutex));
+    }
+
+    return buffer;
+}
+
+void ARNETWORK_Manager_ReleaseBuffer (ARNETWORK_Manager_t *manager, ARNETWORK_IOBuffer_t *buffer)
+{
+    /** -- stop holding a buffer, and delete it if it is removed and no more held -- */
+
+    /** local declarations */
+    int numberOfUsers = 0;
+
+    if (buffer != NULL)
+    {
+        ARSAL_Mutex_Lock (&(manager->buffersMutex));
+        buffer->numberOfUsers--;
+        numberOfUsers = buffer->numberOfUsers;
+        ARSAL_Mutex_Unlock (&(manager->buffersMutex));
+
+        /** the Manager holds the buffers not removed */
+        if (numberOfUsers == 0)
+        {
+            ARNETWORK_IOBuffer_Delete (&buffer);
+        }
+    }
+}
+
+eARNETWORK_ERROR ARNETWORK_Manager_MarkBufferRemoved (ARNETWORK_IOBuffer_t *buffer)
+{
+    /** -- mark a buffer removed from the Manager, and wake up its producers and readers waiting -- */
+
+    /** local declarations */
+    eARNETWORK_ERROR error = ARNETWORK_OK;
+
+    error = ARNETWORK_IOBuffer_Lock (buffer);
+
+    if (error == ARNETWORK_OK)
+    {
+        if (buffer->isBorrowed)
+        {
+            error = ARNETWORK_ERROR_IOBUFFER_DATA_BORROWED;
+        }
+        else
+        {
+            buffer->isRemoved = 1;
+
+            /** the producers wake up at once ; the first reader is woken up, and gives back the semaphore to wake up the next one */
+            ARSAL_Cond_Broadcast (&(buffer->freeCellCond));
+            ARSAL_Sem_Post (&(buffer->outputSem));
+        }
+
+        ARNETWORK_IOBuffer_Unlock (buffer);
+    }
+
+    return error;
+}
+
+void ARNETWORK_Manager_LockBuffers (ARNETWORK_Manager_t *manager)
+{
+    /** -- block the processing of the sender and the receiver -- */
+
+    /** always taken in this order, to not deadlock with another change of the buffers */
+    ARSAL_Mutex_Lock (&(manager->sender->buffersMutex));
+    ARSAL_Mutex_Lock (&(manager->receiver->buffersMutex));
+}
+
+void ARNETWORK_Manager_UnlockBuffers (ARNETWORK_Manager_t *manager)
+{
+    /** -- give the arrays of buffers to the sender and the receiver, and resume their processing -- */
+
+    manager->sender->inputBufferPtrArr = manager->inputBufferArray;
+    manager->sender->numberOfInputBuff = manager->numberOfInput;
+    manager->sender->outputBufferPtrArr = manager->outputBufferArray;
+    manager->sender->numberOfOutputBuff = manager->numberOfOutput;
+    manager->receiver->outputBufferPtrArr = manager->outputBufferArray;
+    manager->receiver->numberOfOutputBuff = manager->numberOfOutput;
+
+    ARSAL_Mutex_Unlock (&(manager->receiver->buffersMutex));
+    ARSAL_Mutex_Unlock (&(manager->sender->buffersMutex));
+}
+
+ARNETWORK_IOBuffer_t* ARNETWORK_Manager_NewInputBuffer (ARNETWORK_Manager_t *manager, ARNETWORK_IOBufferParam_t *inputParam, ARNETWORK_Arena_t *arena, eARNETWORK_ERROR *error)
+{
+    /** -- Create an input buffer -- */
+
+    /** local declarations */
+    eARNETWORK_ERROR localError = ARNETWORK_OK;
+    ARNETWORK_IOBuffer_t *inputBuffer = NULL;
+
+    /** check parameters: */
+    /** -   id is smaller than the id acknowledge offset */
+    /** -   dataCopyMaxSize isn't too big */
+    if ((inputParam->ID >= (manager->networkALManager->maxIds / 2)) ||
+        (inputParam->ID <  ARNETWORK_MANAGER_INTERNAL_BUFFER_ID_MAX))
+    {
+        localError = ARNETWORK_ERROR_BAD_PARAMETER;
+    }
+
+    /** Check for special (negative) values for dataCopyMaxSize. */
+    if (inputParam->dataCopyMaxSize < 0)
+    {
+        if (inputParam->dataCopyMaxSize == ARNETWORK_IOBUFFERPARAM_DATACOPYMAXSIZE_USE_MAX)
+        {
+            /* Set dataCopyMaxSize to the maximum value allowed by ARNetworkAL (minus the size of the header). */
+            inputParam->dataCopyMaxSize = manager->networkALManager->maxBufferSize;
+        }
+        else
+        {
+            /* Unknown special value. */
+            localError = ARNETWORK_ERROR_BAD_PARAMETER;
+        }
+    }
+
+    /* Check final buffer size ; the data of the fragmenting buffers are split in frames. */
+    if ((!inputParam->isFragmenting) &&
+        (inputParam->dataCopyMaxSize > manager->networkALManager->maxBufferSize))
+    {
+        ARSAL_PRINT(ARSAL_PRINT_ERROR, ARNETWORK_MANAGER_TAG, "Final dataCopyMaxSize is higher than tha maximum allowed data size (%d).", manager->networkALManager->maxBufferSize);
+        localError = ARNETWORK_ERROR_BAD_PARAMETER;
+    }
+
+    if (localError == ARNETWORK_OK)
+    {
+        /** Create the intput buffer */
+        inputBuffer = ARNETWORK_IOBuffer_NewInArena (inputParam, 0, arena);
+        if (inputBuffer == NULL)
+        {
+            localError = ARNETWORK_ERROR_MANAGER_NEW_IOBUFFER;
+        }
+    }
+
+    *error = localError;
+
+    return inputBuffer;
+}
+
+eARNETWORK_ERROR ARNETWORK_Manager_SetOutputCallback (ARNETWORK_Manager_t *manager, int outputBufferID, ARNETWORK_Manager_OutputCallback_t callback, void *customData)
+{
+    /** -- Sets the callback receiving the data of an output buffer, without copy -- */
+
+    /** local declarations */
+    eARNETWORK_ERROR error = ARNETWORK_OK;
+    ARNETWORK_IOBuffer_t *outputBuffer = NULL;
+
+    /** check paratemters */
+    if (manager != NULL)
+    {
+        /** get the address of the outputBuffer */
+        outputBuffer = ARNETWORK_Manager_AcquireBuffer (manager, manager->outputBufferMap, outputBufferID);
+
+        /** check outputBuffer */
+        if (outputBuffer == NULL)
+        {
+            error = ARNETWORK_ERROR_ID_UNKNOWN;
+        }
+    }
+    else
+    {
+        error = ARNETWORK_ERROR_BAD_PARAMETER;
+    }
+
+    if (error == ARNETWORK_OK)
+    {
+        /** the receiving thread calls the callback with the output buffer locked */
+        error = ARNETWORK_IOBuffer_Lock (outputBuffer);
+    }
+
+    if (error == ARNETWORK_OK)
+    {
+        outputBuffer->outputCallback = callback;
+        outputBuffer->outputCallbackCustomData = customData;
+        ARNETWORK_IOBuffer_Unlock (outputBuffer);
+    }
+
+    ARNETWORK_Manager_ReleaseBuffer (manager, outputBuffer);
+
+    return error;
+}
+
+eARNETWORK_ERROR ARNETWORK_Manager_SetConsumerLagCallback (ARNETWORK_Manager_t *manager, int outputBufferID, int lagThreshold, ARNETWORK_Manager_ConsumerLagCallback_t callback, void *customData)
+{
+    /** -- Sets the callback reporting the lag of the application reading an output buffer -- */
+
+    /** local declarations */
+    eARNETWORK_ERROR error = ARNETWORK_OK;
+    ARNETWORK_IOBuffer_t *outputBuffer = NULL;
+
+    /** check paratemters */
+    if (manager != NULL)
+    {
+        /** get the address of the outputBuffer */
+        outputBuffer = ARNETWORK_Manager_AcquireBuffer (manager, manager->outputBufferMap, outputBufferID);
+
+        /** check outputBuffer */
+        if (outputBuffer == NULL)
+        {
+            error = ARNETWORK_ERROR_ID_UNKNOWN;
+        }
+        else if ((callback != NULL) &&
+                 ((lagThreshold < 1) || (lagThreshold > (int) outputBuffer->dataDescriptorRBuffer->numberOfCell)))
+        {
+            error = ARNETWORK_ERROR_BAD_PARAMETER;
+        }
+    }
+    else
+    {
+        error = ARNETWORK_ERROR_BAD_PARAMETER;
+    }
+
+    if (error == ARNETWORK_OK)
+    {
+        /** the receiving thread calls the callback with the output buffer locked */
+        error = ARNETWORK_IOBuffer_Lock (outputBuffer);
+    }
+
+    if (error == ARNETWORK_OK)
+    {
+        outputBuffer->consumerLagCallback = callback;
+        outputBuffer->consumerLagCustomData = customData;
+        outputBuffer->consumerLagThreshold = lagThreshold;
+        outputBuffer->isConsumerLagReported = 0;
+        ARNETWORK_IOBuffer_Unlock (outputBuffer);
+    }
+
+    ARNETWORK_Manager_ReleaseBuffer (manager, outputBuffer);
+
+    return error;
+}
+
+eARNETWORK_ERROR ARNETWORK_Manager_GetConsumerStatus (ARNETWORK_Manager_t *manager, int outputBufferID, ARNETWORK_Manager_ConsumerStatus_t *status)
+{
+    /** -- Gets the status of the reading of an output buffer by the application -- */
+
+    /** local declarations */
+    eARNETWORK_ERROR error = ARNETWORK_OK;
+    ARNETWORK_IOBuffer_t *outputBuffer = NULL;
+
+    /** check paratemters */
+    if ((manager != NULL) && (status != NULL))
+    {
+        /** get the address of the outputBuffer */
+        outputBuffer = ARNETWORK_Manager_AcquireBuffer (manager, manager->outputBufferMap, outputBufferID);
+
+        /** check outputBuffer */
+        if (outputBuffer == NULL)
+        {
+            error = ARNETWORK_ERROR_ID_UNKNOWN;
+        }
+    }
+    else
+    {
+        error = ARNETWORK_ERROR_BAD_PARAMETER;
+    }
+
+    if (error == ARNETWORK_OK)
+    {
+        error = ARNETWORK_IOBuffer_Lock (outputBuffer);
+    }
+
+    if (error == ARNETWORK_OK)
+    {
+        status->numberOfData = ARNETWORK_RingBuffer_GetNumberOfData (outputBuffer->dataDescriptorRBuffer);
+        status->numberOfCells = outputBuffer->dataDescriptorRBuffer->numberOfCell;
+        status->numberOfDroppedNewest = outputBuffer->numberOfDroppedNewest;
+        status->numberOfDroppedOldest = outputBuffer->numberOfDroppedOldest;
+        status->numberOfConflated = outputBuffer->numberOfConflated;
+        status->numberOfAcksWithheld = outputBuffer->numberOfAcksWithheld;
+        ARNETWORK_IOBuffer_Unlock (outputBuffer);
     }
 
+    ARNETWORK_Manager_ReleaseBuffer (manager, outputBuffer);
+
     return error;
 }
 
@@ -921,7 +2776,7 @@ eARNETWORK_ERROR ARNETWORK_Manager_FlushInputBuffer (ARNETWORK_Manager_t *manage
     }
     else
     {
-        ARNETWORK_IOBuffer_t *buffer = manager->inputBufferMap[inBufferID];
+        ARNETWORK_IOBuffer_t *buffer = ARNETWORK_Manager_AcquireBuffer (manager, manager->inputBufferMap, inBufferID);
         if (buffer != NULL)
         {
             /** lock the IOBuffer */
@@ -940,6 +2795,8 @@ eARNETWORK_ERROR ARNETWORK_Manager_FlushInputBuffer (ARNETWORK_Manager_t *manage
         {
             error = ARNETWORK_ERROR_BAD_PARAMETER;
         }
+
+        ARNETWORK_Manager_ReleaseBuffer (manager, buffer);
     }
     return error;
 }
@@ -953,7 +2810,7 @@ eARNETWORK_ERROR ARNETWORK_Manager_FlushOutputBuffer (ARNETWORK_Manager_t *manag
     }
     else
     {
-        ARNETWORK_IOBuffer_t *buffer = manager->outputBufferMap[outBufferID];
+        ARNETWORK_IOBuffer_t *buffer = ARNETWORK_Manager_AcquireBuffer (manager, manager->outputBufferMap, outBufferID);
 
         if (buffer != NULL)
         {
@@ -973,6 +2830,8 @@ eARNETWORK_ERROR ARNETWORK_Manager_FlushOutputBuffer (ARNETWORK_Manager_t *manag
         {
             error = ARNETWORK_ERROR_BAD_PARAMETER;
         }
+
+        ARNETWORK_Manager_ReleaseBuffer (manager, buffer);
     }
     return error;
 }
@@ -997,7 +2856,7 @@ int ARNETWORK_Manager_GetEstimatedMissPercentage (ARNETWORK_Manager_t *manager,
     }
     else
     {
-        ARNETWORK_IOBuffer_t *buffer = manager->outputBufferMap[outBufferID];
+        ARNETWORK_IOBuffer_t *buffer = ARNETWORK_Manager_AcquireBuffer (manager, manager->outputBufferMap, outBufferID);
 
         if (buffer != NULL)
         {
@@ -1021,6 +2880,8 @@ int ARNETWORK_Manager_GetEstimatedMissPercentage (ARNETWORK_Manager_t *manager,
         {
             error = ARNETWORK_ERROR_BAD_PARAMETER;
         }
+
+        ARNETWORK_Manager_ReleaseBuffer (manager, buffer);
     }
 
     if (error != ARNETWORK_OK)
@@ -1033,6 +2894,50 @@ int ARNETWORK_Manager_GetEstimatedMissPercentage (ARNETWORK_Manager_t *manager,
     }
 }
 
+eARNETWORK_ERROR ARNETWORK_Manager_GetLinkQuality (ARNETWORK_Manager_t *manager, int outBufferID, ARNETWORK_Manager_LinkQuality_t *linkQuality)
+{
+    /** -- Gets the quality of the link seen by an output buffer -- */
+
+    /** local declarations */
+    eARNETWORK_ERROR error = ARNETWORK_OK;
+    ARNETWORK_IOBuffer_t *buffer = NULL;
+    struct timespec now;
+
+    /** check parameters */
+    if ((manager == NULL) || (linkQuality == NULL))
+    {
+        error = ARNETWORK_ERROR_BAD_PARAMETER;
+    }
+
+    if (error == ARNETWORK_OK)
+    {
+        buffer = ARNETWORK_Manager_AcquireBuffer (manager, manager->outputBufferMap, outBufferID);
+        if (buffer == NULL)
+        {
+            error = ARNETWORK_ERROR_ID_UNKNOWN;
+        }
+    }
+
+    if (error == ARNETWORK_OK)
+    {
+        /** lock the IOBuffer */
+        error = ARNETWORK_IOBuffer_Lock (buffer);
+
+        if (error == ARNETWORK_OK)
+        {
+            ARSAL_Time_GetTime (&now);
+            ARNETWORK_LinkQuality_Get (&(buffer->linkQuality), &now, linkQuality);
+
+            /** unlock the IOBuffer */
+            ARNETWORK_IOBuffer_Unlock (buffer);
+        }
+    }
+
+    ARNETWORK_Manager_ReleaseBuffer (manager, buffer);
+
+    return error;
+}
+
 eARNETWORK_ERROR ARNETWORK_Manager_SetMinimumTimeBetweenSends (ARNETWORK_Manager_t *manager, int minimumTimeMs)
 {
     if ((manager == NULL) ||
@@ -1040,10 +2945,373 @@ eARNETWORK_ERROR ARNETWORK_Manager_SetMinimumTimeBetweenSends (ARNETWORK_Manager
     {
         return ARNETWORK_ERROR_BAD_PARAMETER;
     }
-    manager->sender->minimumTimeBetweenSendsMs = minimumTimeMs;
+    manager->sender->minimumTimeBetweenSendsUs = minimumTimeMs * ARNETWORK_IOBUFFER_MICROSECONDS_PER_MILLISECOND;
+    return ARNETWORK_OK;
+}
+
+eARNETWORK_ERROR ARNETWORK_Manager_SetMinimumTimeBetweenSendsUs (ARNETWORK_Manager_t *manager, int minimumTimeUs)
+{
+    if ((manager == NULL) ||
+        (manager->sender == NULL) ||
+        (minimumTimeUs < 0))
+    {
+        return ARNETWORK_ERROR_BAD_PARAMETER;
+    }
+    manager->sender->minimumTimeBetweenSendsUs = minimumTimeUs;
+    return ARNETWORK_OK;
+}
+
+eARNETWORK_ERROR ARNETWORK_Manager_SetCongestionControl (ARNETWORK_Manager_t *manager, eARNETWORK_MANAGER_CONGESTION_CONTROL algorithm)
+{
+    if ((manager == NULL) ||
+        (manager->sender == NULL))
+    {
+        return ARNETWORK_ERROR_BAD_PARAMETER;
+    }
+    return ARNETWORK_CongestionControl_SetAlgorithm (manager->sender->congestionControl, algorithm);
+}
+
+eARNETWORK_ERROR ARNETWORK_Manager_GetCongestionControlStatus (ARNETWORK_Manager_t *manager, ARNETWORK_Manager_CongestionControlStatus_t *status)
+{
+    if ((manager == NULL) ||
+        (manager->sender == NULL) ||
+        (status == NULL))
+    {
+        return ARNETWORK_ERROR_BAD_PARAMETER;
+    }
+    ARNETWORK_CongestionControl_GetStatus (manager->sender->congestionControl, status);
+    return ARNETWORK_OK;
+}
+
+eARNETWORK_ERROR ARNETWORK_Manager_SetLowLatencyDirectSend (ARNETWORK_Manager_t *manager, int isDirectSend)
+{
+    if ((manager == NULL) ||
+        (manager->sender == NULL) ||
+        ((isDirectSend != 0) && (isDirectSend != 1)))
+    {
+        return ARNETWORK_ERROR_BAD_PARAMETER;
+    }
+    manager->sender->isLowLatencyDirectSend = isDirectSend;
     return ARNETWORK_OK;
 }
 
+eARNETWORK_ERROR ARNETWORK_Manager_SetSenderWaitStrategy (ARNETWORK_Manager_t *manager, eARNETWORK_MANAGER_SENDER_WAIT_STRATEGY strategy, int maxSpinTimeUs)
+{
+    if ((manager == NULL) ||
+        (manager->sender == NULL))
+    {
+        return ARNETWORK_ERROR_BAD_PARAMETER;
+    }
+    return ARNETWORK_Sender_SetWaitStrategy (manager->sender, strategy, maxSpinTimeUs);
+}
+
+eARNETWORK_ERROR ARNETWORK_Manager_SetTrace (ARNETWORK_Manager_t *manager, int numberOfEntries)
+{
+    /** -- Enable or disable the binary trace -- */
+
+    /** local declarations */
+    eARNETWORK_ERROR error = ARNETWORK_OK;
+
+    if (manager == NULL)
+    {
+        return ARNETWORK_ERROR_BAD_PARAMETER;
+    }
+
+    if (manager->memoryBudget > 0)
+    {
+        /** the rings allocated at the first enabling must fit in the memory budget */
+        ARNETWORK_Manager_LockBuffers (manager);
+
+        if (ARNETWORK_Manager_ComputeMemoryFootprint (manager, NULL, 0, NULL) - ARNETWORK_Trace_GetMemoryFootprint (manager->trace, 0) + ARNETWORK_Trace_GetMemoryFootprint (manager->trace, numberOfEntries) > manager->memoryBudget)
+        {
+            error = ARNETWORK_ERROR_MANAGER_MEMORY_BUDGET;
+        }
+        else
+        {
+            error = ARNETWORK_Trace_Enable (manager->trace, numberOfEntries);
+        }
+
+        ARNETWORK_Manager_UnlockBuffers (manager);
+    }
+    else
+    {
+        error = ARNETWORK_Trace_Enable (manager->trace, numberOfEntries);
+    }
+
+    return error;
+}
+
+eARNETWORK_ERROR ARNETWORK_Manager_DumpTrace (ARNETWORK_Manager_t *manager, int fd)
+{
+    /** -- Write the binary trace in a file descriptor -- */
+
+    if (manager == NULL)
+    {
+        return ARNETWORK_ERROR_BAD_PARAMETER;
+    }
+
+    return ARNETWORK_Trace_Dump (manager->trace, fd);
+}
+
+eARNETWORK_ERROR ARNETWORK_Manager_SetDelayedAck (ARNETWORK_Manager_t *manager, int maxNumberOfAcks, int maxDelayUs)
+{
+    if ((manager == NULL) ||
+        (manager->sender == NULL))
+    {
+        return ARNETWORK_ERROR_BAD_PARAMETER;
+    }
+    return ARNETWORK_Sender_SetDelayedAck (manager->sender, maxNumberOfAcks, maxDelayUs);
+}
+
+eARNETWORK_ERROR ARNETWORK_Manager_SetImmediateAck (ARNETWORK_Manager_t *manager, int outputBufferID, int isImmediate)
+{
+    /** -- Sets an output buffer as latency-critical for its acknowledgments -- */
+
+    /** local declarations */
+    eARNETWORK_ERROR error = ARNETWORK_OK;
+    ARNETWORK_IOBuffer_t *outputBuffer = NULL;
+
+    /** check paratemters */
+    if ((manager != NULL) &&
+        (outputBufferID >= 0) &&
+        (outputBufferID < manager->networkALManager->maxIds))
+    {
+        /** get the address of the outputBuffer */
+        outputBuffer = ARNETWORK_Manager_AcquireBuffer (manager, manager->outputBufferMap, outputBufferID);
+
+        /** check outputBuffer */
+        if (outputBuffer == NULL)
+        {
+            error = ARNETWORK_ERROR_ID_UNKNOWN;
+        }
+        else if (outputBuffer->dataType != ARNETWORKAL_FRAME_TYPE_DATA_WITH_ACK)
+        {
+            error = ARNETWORK_ERROR_BAD_PARAMETER;
+        }
+    }
+    else
+    {
+        error = ARNETWORK_ERROR_BAD_PARAMETER;
+    }
+
+    if (error == ARNETWORK_OK)
+    {
+        error = ARNETWORK_IOBuffer_Lock (outputBuffer);
+    }
+
+    if (error == ARNETWORK_OK)
+    {
+        outputBuffer->isImmediateAck = (isImmediate) ? 1 : 0;
+        ARNETWORK_IOBuffer_Unlock (outputBuffer);
+    }
+
+    ARNETWORK_Manager_ReleaseBuffer (manager, outputBuffer);
+
+    return error;
+}
+
+eARNETWORK_ERROR ARNETWORK_Manager_ReadDataBatchLocked (ARNETWORK_IOBuffer_t *outputBuffer, uint8_t *arena, int arenaSize, ARNETWORK_Manager_DataRecord_t *recordArray, int maxNumberOfRecords, int *numberOfRecords)
+{
+    /** -- read the data available in an output buffer under one lock -- */
+
+    /** local declarations */
+    eARNETWORK_ERROR error = ARNETWORK_OK;
+    int offset = 0;
+    int readSize = 0;
+    int recordIndex = 0;
+    int isArenaFull = 0;
+
+    /** lock the IOBuffer */
+    error = ARNETWORK_IOBuffer_Lock (outputBuffer);
+
+    if ((error == ARNETWORK_OK) && (outputBuffer->isRemoved))
+    {
+        /** the IOBuffer has been removed while waiting: give back the semaphore to wake up the next reader */
+        ARSAL_Sem_Post (&(outputBuffer->outputSem));
+        ARNETWORK_IOBuffer_Unlock (outputBuffer);
+        error = ARNETWORK_ERROR_ID_UNKNOWN;
+    }
+
+    if (error == ARNETWORK_OK)
+    {
+        /** read the first data, its semaphore is already taken */
+        error = ARNETWORK_IOBuffer_ReadData (outputBuffer, arena, arenaSize, &readSize);
+        if (error == ARNETWORK_OK)
+        {
+            recordArray[0].offset = 0;
+            recordArray[0].size = readSize;
+            offset = readSize;
+            recordIndex = 1;
+        }
+        else
+        {
+            /** the first data is kept in the IOBuffer: return the size needed and give back the semaphore */
+            recordArray[0].offset = 0;
+            recordArray[0].size = readSize;
+            ARSAL_Sem_Post (&(outputBuffer->outputSem));
+        }
+
+        /** read the other data available while they fit in the arena */
+        while ((error == ARNETWORK_OK) && (!isArenaFull) && (recordIndex < maxNumberOfRecords) && (ARSAL_Sem_Trywait (&(outputBuffer->outputSem)) == 0))
+        {
+            if (ARNETWORK_IOBuffer_ReadData (outputBuffer, arena + offset, arenaSize - offset, &readSize) == ARNETWORK_OK)
+            {
+                recordArray[recordIndex].offset = offset;
+                recordArray[recordIndex].size = readSize;
+                offset += readSize;
+                recordIndex++;
+            }
+            else
+            {
+                /** the data is kept for the next read: give back the semaphore and stop */
+                ARSAL_Sem_Post (&(outputBuffer->outputSem));
+                isArenaFull = 1;
+            }
+        }
+
+        /** unlock the IOBuffer */
+        ARNETWORK_IOBuffer_Unlock (outputBuffer);
+    }
+
+    *numberOfRecords = recordIndex;
+
+    return error;
+}
+
+int ARNETWORK_Manager_ComputeMemoryFootprint (ARNETWORK_Manager_t *manager, ARNETWORK_Manager_BufferFootprint_t *footprintArray, int maxNumberOfFootprints, int *numberOfFootprints)
+{
+    /** -- Compute the memory allocated by the Manager -- */
+
+    /** local declarations */
+    int size = sizeof (ARNETWORK_Manager_t);
+    int localNumberOfFootprints = 0;
+    int bufferIndex = 0;
+
+    /** tables of the buffers, by index and by identifier */
+    size += (manager->numberOfInput + manager->numberOfOutput + manager->numberOfInternalInputs) * sizeof (ARNETWORK_IOBuffer_t*);
+    size += 2 * manager->networkALManager->maxIds * sizeof (ARNETWORK_IOBuffer_t*);
+
+    /** the buffers of acknowledgement are stored in both lists: they are counted from the output buffer list only */
+    for (bufferIndex = 0; bufferIndex < manager->numberOfInputWithoutAck; bufferIndex++)
+    {
+        size += ARNETWORK_Manager_AddBufferFootprint (manager->inputBufferArray[bufferIndex], ARNETWORK_MANAGER_BUFFER_KIND_INPUT, footprintArray, maxNumberOfFootprints, &localNumberOfFootprints);
+    }
+
+    for (bufferIndex = 0; bufferIndex < manager->numberOfOutput; bufferIndex++)
+    {
+        size += ARNETWORK_Manager_AddBufferFootprint (manager->outputBufferArray[bufferIndex], (bufferIndex < manager->numberOfOutputWithoutAck) ? ARNETWORK_MANAGER_BUFFER_KIND_OUTPUT : ARNETWORK_MANAGER_BUFFER_KIND_ACK, footprintArray, maxNumberOfFootprints, &localNumberOfFootprints);
+    }
+
+    for (bufferIndex = 0; bufferIndex < manager->numberOfInternalInputs; bufferIndex++)
+    {
+        size += ARNETWORK_Manager_AddBufferFootprint (manager->internalInputBufferArray[bufferIndex], ARNETWORK_MANAGER_BUFFER_KIND_INTERNAL, footprintArray, maxNumberOfFootprints, &localNumberOfFootprints);
+    }
+
+    size += ARNETWORK_Sender_GetMemoryFootprint (manager->sender);
+    size += (manager->receiver != NULL) ? sizeof (ARNETWORK_Receiver_t) : 0;
+    size += (manager->notifier != NULL) ? sizeof (ARNETWORK_Notifier_t) : 0;
+    size += ARNETWORK_Trace_GetMemoryFootprint (manager->trace, 0);
+    size += ARNETWORK_CompletionQueue_GetMemoryFootprint (manager->completionQueue, 0);
+
+    if (numberOfFootprints != NULL)
+    {
+        *numberOfFootprints = localNumberOfFootprints;
+    }
+
+    return size;
+}
+
+size_t ARNETWORK_Manager_GetNewMemoryFootprint (ARNETWORKAL_Manager_t *networkALManager, unsigned int numberOfInput, ARNETWORK_IOBufferParam_t *inputParamArr, unsigned int numberOfOutput, ARNETWORK_IOBufferParam_t *outputParamArr)
+{
+    /** -- Compute the memory that the creation of a Manager will allocate -- */
+
+    /** local declarations */
+    size_t size = sizeof (ARNETWORK_Manager_t);
+    unsigned int bufferIndex = 0;
+    ARNETWORK_IOBufferParam_t pingParam;
+    ARNETWORK_IOBufferParam_t coalescedAckParam;
+
+    /** same sum as ARNETWORK_Manager_ComputeMemoryFootprint(): tables of the buffers, by index and by identifier */
+    size += ((2 * (size_t) numberOfOutput) + numberOfInput + numberOfOutput + ARNETWORK_MANAGER_INTERNAL_BUFFER_ID_MAX) * sizeof (ARNETWORK_IOBuffer_t*);
+    size += 2 * networkALManager->maxIds * sizeof (ARNETWORK_IOBuffer_t*);
+
+    /** internal buffers: ping, pong and coalesced acknowledgments */
+    ARNETWORK_Manager_InitInternalParams (networkALManager, &pingParam, &coalescedAckParam);
+    size += 2 * ARNETWORK_IOBuffer_GetParamMemoryFootprint (&pingParam, 0);
+    size += ARNETWORK_IOBuffer_GetParamMemoryFootprint (&coalescedAckParam, 0);
+
+    for (bufferIndex = 0; bufferIndex < numberOfOutput; bufferIndex++)
+    {
+        size += ARNETWORK_Manager_GetBufferNewMemoryFootprint (networkALManager, &(outputParamArr[bufferIndex]), 1);
+    }
+
+    for (bufferIndex = 0; bufferIndex < numberOfInput; bufferIndex++)
+    {
+        size += ARNETWORK_Manager_GetBufferNewMemoryFootprint (networkALManager, &(inputParamArr[bufferIndex]), 0);
+    }
+
+    /** the trace is created disabled, the completion queue is not created */
+    size += ARNETWORK_Sender_GetNewMemoryFootprint (networkALManager);
+    size += sizeof (ARNETWORK_Receiver_t);
+    size += sizeof (ARNETWORK_Notifier_t);
+    size += sizeof (ARNETWORK_Trace_t);
+
+    return size;
+}
+
+size_t ARNETWORK_Manager_GetBufferNewMemoryFootprint (ARNETWORKAL_Manager_t *networkALManager, const ARNETWORK_IOBufferParam_t *param, int isOutput)
+{
+    /** -- Compute the memory that the creation of a buffer will allocate -- */
+
+    /** local declarations */
+    size_t size = 0;
+    ARNETWORK_IOBufferParam_t finalParam = *param;
+
+    /** same resolution of the size of the data as ARNETWORK_Manager_NewOutputBuffer() and ARNETWORK_Manager_NewInputBuffer() */
+    if (finalParam.dataCopyMaxSize == ARNETWORK_IOBUFFERPARAM_DATACOPYMAXSIZE_USE_MAX)
+    {
+        finalParam.dataCopyMaxSize = networkALManager->maxBufferSize;
+    }
+
+    if (isOutput)
+    {
+        /** the output buffer reassembles its messages if it is fragmenting, and has a buffer of acknowledgement */
+        size += ARNETWORK_IOBuffer_GetParamMemoryFootprint (&finalParam, (finalParam.isFragmenting == 1));
+
+        ARNETWORK_Manager_InitAckParam (&finalParam, param->isFragmenting);
+        size += ARNETWORK_IOBuffer_GetParamMemoryFootprint (&finalParam, 0);
+    }
+    else
+    {
+        size += ARNETWORK_IOBuffer_GetParamMemoryFootprint (&finalParam, 0);
+    }
+
+    return size;
+}
+
+int ARNETWORK_Manager_AddBufferFootprint (ARNETWORK_IOBuffer_t *buffer, eARNETWORK_MANAGER_BUFFER_KIND kind, ARNETWORK_Manager_BufferFootprint_t *footprintArray, int maxNumberOfFootprints, int *numberOfFootprints)
+{
+    /** -- Store the memory allocated by a buffer in the breakdown -- */
+
+    /** local declarations */
+    int size = 0;
+
+    if (buffer != NULL)
+    {
+        size = ARNETWORK_IOBuffer_GetMemoryFootprint (buffer);
+
+        if (*numberOfFootprints < maxNumberOfFootprints)
+        {
+            footprintArray[*numberOfFootprints].ID = buffer->ID;
+            footprintArray[*numberOfFootprints].kind = kind;
+            footprintArray[*numberOfFootprints].size = size;
+        }
+        (*numberOfFootprints)++;
+    }
+
+    return size;
+}
+
 void ARNETWORK_Manager_OnDisconnect (ARNETWORKAL_Manager_t *alManager, void *customData)
 {
     /* -- function called on disconnect -- */
@@ -41,12 +41,14 @@
 #include "ARNETWORK_IOBuffer.h"
 #include "ARNETWORK_Sender.h"
 #include "ARNETWORK_Receiver.h"
+#include "ARNETWORK_Arena.h"
 #include <libARNetwork/ARNETWORK_Manager.h>
 #include <libARNetworkAL/ARNETWORKAL_Manager.h>
 
 typedef enum {
     ARNETWORK_MANAGER_INTERNAL_BUFFER_ID_PING = 0, /**< Ping buffer id - ping requests */
     ARNETWORK_MANAGER_INTERNAL_BUFFER_ID_PONG, /**< Pong buffer id - ping reply */
+    ARNETWORK_MANAGER_INTERNAL_BUFFER_ID_ACK_COALESCED, /**< Coalesced acknowledgments buffer id - acknowledgments of several buffers */
     ARNETWORK_MANAGER_INTERNAL_BUFFER_ID_MAX, /**< Should always be kept less or equal to 10 */
 } eARNETWORK_MANAGER_INTERNAL_BUFFER_ID;
 
@@ -78,6 +80,9 @@ struct ARNETWORK_Manager_t
     ARNETWORKAL_Manager_t *networkALManager; /**< Pointer on the OS specific manager */
     ARNETWORK_Sender_t *sender; /**< The sender */
     ARNETWORK_Receiver_t *receiver; /**< The receiver */
+    ARNETWORK_Notifier_t *notifier; /**< The notifier of the output buffers ready to be read */
+    ARNETWORK_Trace_t *trace; /**< The binary trace of the sending and the receiving paths */
+    ARNETWORK_CompletionQueue_t *completionQueue; /**< The queue of the completions of the data sent ; NULL if not enabled */
     ARNETWORK_IOBuffer_t **inputBufferArray; /**< The array storing the input buffer */
     ARNETWORK_IOBuffer_t **outputBufferArray; /**< The array storing the output buffer */
     ARNETWORK_IOBuffer_t **internalInputBufferArray; /**< The array storing the internal input buffers */
@@ -88,8 +93,11 @@ struct ARNETWORK_Manager_t
     int numberOfInternalInputs; /**< Number of internal input buffers */
     ARNETWORK_IOBuffer_t **inputBufferMap; /**< array storing the inputBuffers by their identifier */
     ARNETWORK_IOBuffer_t **outputBufferMap; /**< array storing the outputBuffers by their identifier */
+    ARSAL_Mutex_t buffersMutex; /**< Mutex protecting, against the adding and the removal of buffers, the arrays and the maps of buffers read by the calls of the application, and the number of users of the buffers. Never taken with a buffer locked */
     ARNETWORK_Manager_OnDisconnect_t onDisconnect; /**< Manager specific on disconnect function */
     void *customData; /**< custom data sent to the callbacks */
+    int memoryBudget; /**< Maximum memory, in byte, the Manager can allocate ; 0 if not limited */
+    ARNETWORK_Arena_t *arena; /**< Arena in which the Manager, its tables and its buffers created with it are allocated ; NULL if allocated by malloc() */
 };
 
 #endif /** _NETWORK_MANAGER_PRIVATE_H_ */
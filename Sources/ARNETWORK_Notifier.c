@@ -0,0 +1,262 @@
+/*
+    Copyright (C) 2014 Parrot SA
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions
+    are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in
+      the documentation and/or other materials provided with the 
+      distribution.
+    * Neither the name of Parrot nor the names
+      of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written
+      permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+    "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+    LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+    FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+    COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+    INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+    BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+    OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED 
+    AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+    OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+    OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+    SUCH DAMAGE.
+*/
+/**
+ * @file ARNETWORK_Notifier.c
+ * @brief notifier of the output buffers ready to be read, through a pollable file descriptor or a condition
+ * @date 19/10/2026
+ **/
+
+/*****************************************
+ *
+ *             include file :
+ *
+ *****************************************/
+
+#include <stdlib.h>
+#include <stdint.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <errno.h>
+
+#ifdef __linux__
+#include <sys/eventfd.h>
+#endif
+
+#include <libARSAL/ARSAL_Print.h>
+
+#include <libARNetwork/ARNETWORK_Error.h>
+
+#include "ARNETWORK_Notifier.h"
+
+/*****************************************
+ *
+ *             define :
+ *
+ *****************************************/
+
+#define ARNETWORK_NOTIFIER_TAG "ARNETWORK_Notifier"
+
+/**
+ * size of the buffer used to clear the notifier
+ */
+#define ARNETWORK_NOTIFIER_CLEAR_BUFFER_SIZE (64)
+
+/*****************************************
+ *
+ *             implementation :
+ *
+ *****************************************/
+
+ARNETWORK_Notifier_t* ARNETWORK_Notifier_New (eARNETWORK_ERROR *error)
+{
+    /** -- Create a new notifier -- */
+
+    /** local declarations */
+    eARNETWORK_ERROR localError = ARNETWORK_OK;
+    ARNETWORK_Notifier_t *notifierPtr = malloc (sizeof (ARNETWORK_Notifier_t));
+#ifndef __linux__
+    int pipeFds[2];
+#endif
+
+    if (notifierPtr != NULL)
+    {
+        notifierPtr->readFd = -1;
+        notifierPtr->writeFd = -1;
+        notifierPtr->generation = 0;
+        notifierPtr->numberOfWaiters = 0;
+        ARSAL_Mutex_Init (&(notifierPtr->mutex));
+        ARSAL_Cond_Init (&(notifierPtr->cond));
+
+#ifdef __linux__
+        /** an eventfd is a counter: both readable and writable */
+        notifierPtr->readFd = eventfd (0, EFD_NONBLOCK | EFD_CLOEXEC);
+        notifierPtr->writeFd = notifierPtr->readFd;
+        if (notifierPtr->readFd < 0)
+        {
+            localError = ARNETWORK_ERROR_MANAGER_NEW_NOTIFIER;
+        }
+#else
+        /** fallback on a non blocking pipe */
+        if (pipe (pipeFds) == 0)
+        {
+            notifierPtr->readFd = pipeFds[0];
+            notifierPtr->writeFd = pipeFds[1];
+            if ((fcntl (notifierPtr->readFd, F_SETFL, O_NONBLOCK) != 0) ||
+                (fcntl (notifierPtr->writeFd, F_SETFL, O_NONBLOCK) != 0))
+            {
+                localError = ARNETWORK_ERROR_MANAGER_NEW_NOTIFIER;
+            }
+            fcntl (notifierPtr->readFd, F_SETFD, FD_CLOEXEC);
+            fcntl (notifierPtr->writeFd, F_SETFD, FD_CLOEXEC);
+        }
+        else
+        {
+            localError = ARNETWORK_ERROR_MANAGER_NEW_NOTIFIER;
+        }
+#endif
+    }
+    else
+    {
+        localError = ARNETWORK_ERROR_ALLOC;
+    }
+
+    /** delete the notifier if an error occurred */
+    if (localError != ARNETWORK_OK)
+    {
+        ARSAL_PRINT (ARSAL_PRINT_ERROR, ARNETWORK_NOTIFIER_TAG, "error: %s (errno %d)", ARNETWORK_Error_ToString (localError), errno);
+        ARNETWORK_Notifier_Delete (&notifierPtr);
+    }
+
+    if (error != NULL)
+    {
+        *error = localError;
+    }
+
+    return notifierPtr;
+}
+
+void ARNETWORK_Notifier_Delete (ARNETWORK_Notifier_t **notifierPtrAddr)
+{
+    /** -- Delete the notifier -- */
+
+    if (notifierPtrAddr != NULL)
+    {
+        if ((*notifierPtrAddr) != NULL)
+        {
+            if ((*notifierPtrAddr)->writeFd != (*notifierPtrAddr)->readFd)
+            {
+                close ((*notifierPtrAddr)->writeFd);
+            }
+            if ((*notifierPtrAddr)->readFd >= 0)
+            {
+                close ((*notifierPtrAddr)->readFd);
+            }
+            ARSAL_Cond_Destroy (&((*notifierPtrAddr)->cond));
+            ARSAL_Mutex_Destroy (&((*notifierPtrAddr)->mutex));
+
+            free (*notifierPtrAddr);
+        }
+        *notifierPtrAddr = NULL;
+    }
+}
+
+void ARNETWORK_Notifier_Signal (ARNETWORK_Notifier_t *notifierPtr)
+{
+    /** -- Signal the notifier -- */
+
+#ifdef __linux__
+    uint64_t increment = 1;
+
+    /** the write can only fail if the counter is full, it is then already readable */
+    if (write (notifierPtr->writeFd, &increment, sizeof (increment)) < 0)
+    {
+        ARSAL_PRINT (ARSAL_PRINT_VERBOSE, ARNETWORK_NOTIFIER_TAG, "signal not written, errno %d", errno);
+    }
+#else
+    uint8_t byte = 1;
+
+    /** the write can only fail if the pipe is full, it is then already readable */
+    if (write (notifierPtr->writeFd, &byte, sizeof (byte)) < 0)
+    {
+        ARSAL_PRINT (ARSAL_PRINT_VERBOSE, ARNETWORK_NOTIFIER_TAG, "signal not written, errno %d", errno);
+    }
+#endif
+
+    ARNETWORK_Notifier_Wake (notifierPtr);
+}
+
+void ARNETWORK_Notifier_Wake (ARNETWORK_Notifier_t *notifierPtr)
+{
+    /** -- Wake up the threads waiting the notifier -- */
+
+    /**
+     * a waiter increments numberOfWaiters before to check the generation:
+     * either it sees the new generation, or the wake up sees it waiting and broadcasts under the mutex
+     */
+    __atomic_add_fetch (&(notifierPtr->generation), 1, __ATOMIC_SEQ_CST);
+    if (__atomic_load_n (&(notifierPtr->numberOfWaiters), __ATOMIC_SEQ_CST) > 0)
+    {
+        ARSAL_Mutex_Lock (&(notifierPtr->mutex));
+        ARSAL_Cond_Broadcast (&(notifierPtr->cond));
+        ARSAL_Mutex_Unlock (&(notifierPtr->mutex));
+    }
+}
+
+void ARNETWORK_Notifier_Clear (ARNETWORK_Notifier_t *notifierPtr)
+{
+    /** -- Clear the notifier -- */
+
+    /** local declarations */
+    uint8_t buffer[ARNETWORK_NOTIFIER_CLEAR_BUFFER_SIZE];
+
+#ifdef __linux__
+    /** one read resets the counter of the eventfd */
+    if (read (notifierPtr->readFd, buffer, sizeof (uint64_t)) < 0)
+    {
+        ARSAL_PRINT (ARSAL_PRINT_VERBOSE, ARNETWORK_NOTIFIER_TAG, "nothing to clear, errno %d", errno);
+    }
+#else
+    /** empty the pipe */
+    while (read (notifierPtr->readFd, buffer, sizeof (buffer)) > 0)
+    {
+        /** continue to read */
+    }
+#endif
+}
+
+uint32_t ARNETWORK_Notifier_GetGeneration (ARNETWORK_Notifier_t *notifierPtr)
+{
+    /** -- Get the generation of the notifier -- */
+
+    return __atomic_load_n (&(notifierPtr->generation), __ATOMIC_SEQ_CST);
+}
+
+int ARNETWORK_Notifier_Wait (ARNETWORK_Notifier_t *notifierPtr, uint32_t generation, int timeoutMs)
+{
+    /** -- Wait a signal of the notifier following a generation -- */
+
+    /** local declarations */
+    int isSignaled = 0;
+
+    ARSAL_Mutex_Lock (&(notifierPtr->mutex));
+    __atomic_add_fetch (&(notifierPtr->numberOfWaiters), 1, __ATOMIC_SEQ_CST);
+
+    if (__atomic_load_n (&(notifierPtr->generation), __ATOMIC_SEQ_CST) == generation)
+    {
+        ARSAL_Cond_Timedwait (&(notifierPtr->cond), &(notifierPtr->mutex), timeoutMs);
+    }
+    isSignaled = (__atomic_load_n (&(notifierPtr->generation), __ATOMIC_SEQ_CST) != generation);
+
+    __atomic_sub_fetch (&(notifierPtr->numberOfWaiters), 1, __ATOMIC_SEQ_CST);
+    ARSAL_Mutex_Unlock (&(notifierPtr->mutex));
+
+    return isSignaled;
+}
@@ -0,0 +1,121 @@
+/*
+    Copyright (C) 2014 Parrot SA
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions
+    are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in
+      the documentation and/or other materials provided with the 
+      distribution.
+    * Neither the name of Parrot nor the names
+      of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written
+      permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+    "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+    LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+    FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+    COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+    INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+    BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+    OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED 
+    AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+    OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+    OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+    SUCH DAMAGE.
+*/
+/**
+ * @file ARNETWORK_Notifier.h
+ * @brief notifier of the output buffers ready to be read, through a pollable file descriptor
+ * @date 19/10/2026
+ */
+
+#ifndef _ARNETWORK_NOTIFIER_PRIVATE_H_
+#define _ARNETWORK_NOTIFIER_PRIVATE_H_
+
+#include <inttypes.h>
+#include <libARSAL/ARSAL_Mutex.h>
+#include <libARNetwork/ARNETWORK_Error.h>
+
+/**
+ * @brief notifier of the output buffers ready to be read
+ * @details The notifier is a file descriptor, readable when at least one output buffer became ready since the last clear.
+ * It is an eventfd on Linux and a pipe on the other systems.
+ * Threads can also wait for the next signal on a condition, through a generation counter incremented by each signal ;
+ * the condition is only taken by the signal while threads wait.
+ * @warning before to be used the notifier must be created through ARNETWORK_Notifier_New()
+ * @post after its using the notifier must be deleted through ARNETWORK_Notifier_Delete()
+ */
+typedef struct
+{
+    int readFd; /**< file descriptor to poll, readable when the notifier is signaled */
+    int writeFd; /**< file descriptor written to signal the notifier (equal to readFd for an eventfd) */
+    ARSAL_Mutex_t mutex; /**< mutex of the condition */
+    ARSAL_Cond_t cond; /**< condition broadcast by a signal while threads wait */
+    uint32_t generation; /**< number of signals. Must be accessed with atomic operations */
+    int numberOfWaiters; /**< number of threads waiting on the condition. Must be accessed with atomic operations */
+
+}ARNETWORK_Notifier_t;
+
+/**
+ * @brief Create a new notifier
+ * @warning This function allocate memory and open file descriptors
+ * @post ARNETWORK_Notifier_Delete() must be called to delete the notifier, close its file descriptors and free the memory allocated
+ * @param[out] error pointer on the error output ; can be NULL
+ * @return Pointer on the new notifier, not signaled
+ * @see ARNETWORK_Notifier_Delete()
+ */
+ARNETWORK_Notifier_t* ARNETWORK_Notifier_New (eARNETWORK_ERROR *error);
+
+/**
+ * @brief Delete the notifier
+ * @warning This function free memory and close the file descriptors
+ * @param notifierPtrAddr address of the pointer on the notifier to delete
+ * @see ARNETWORK_Notifier_New()
+ */
+void ARNETWORK_Notifier_Delete (ARNETWORK_Notifier_t **notifierPtrAddr);
+
+/**
+ * @brief Signal the notifier: its file descriptor becomes readable, and the threads waiting are woken up
+ * @note can be called from any thread ; it only takes the mutex of the condition while threads wait
+ * @param notifierPtr the pointer on the notifier
+ */
+void ARNETWORK_Notifier_Signal (ARNETWORK_Notifier_t *notifierPtr);
+
+/**
+ * @brief Wake up the threads waiting the notifier, without signaling its file descriptor
+ * @note can be called from any thread ; it only takes the mutex of the condition while threads wait
+ * @param notifierPtr the pointer on the notifier
+ */
+void ARNETWORK_Notifier_Wake (ARNETWORK_Notifier_t *notifierPtr);
+
+/**
+ * @brief Clear the notifier: its file descriptor is not readable until the next signal
+ * @note it doesn't block
+ * @param notifierPtr the pointer on the notifier
+ */
+void ARNETWORK_Notifier_Clear (ARNETWORK_Notifier_t *notifierPtr);
+
+/**
+ * @brief Get the generation of the notifier, to give to ARNETWORK_Notifier_Wait()
+ * @details It must be read before to check the state notified, so that a signal between the check and the wait is not missed.
+ * @param notifierPtr the pointer on the notifier
+ * @return the number of signals of the notifier
+ */
+uint32_t ARNETWORK_Notifier_GetGeneration (ARNETWORK_Notifier_t *notifierPtr);
+
+/**
+ * @brief Wait a signal of the notifier following a generation
+ * @details The wait can end before a signal (timeout or spurious wake up): the caller must check again the state notified.
+ * @param notifierPtr the pointer on the notifier
+ * @param[in] generation generation read by ARNETWORK_Notifier_GetGeneration() ; the function returns at once if the notifier has been signaled since
+ * @param[in] timeoutMs maximum time, in millisecond, to wait
+ * @return 1 if the notifier has been signaled since the generation, otherwise 0
+ */
+int ARNETWORK_Notifier_Wait (ARNETWORK_Notifier_t *notifierPtr, uint32_t generation, int timeoutMs);
+
+#endif /** _ARNETWORK_NOTIFIER_PRIVATE_H_ */
@@ -58,6 +58,7 @@
 #include <libARNetwork/ARNETWORK_Error.h>
 #include <libARNetworkAL/ARNETWORKAL_Frame.h>
 #include "ARNETWORK_DataDescriptor.h"
+#include "ARNETWORK_RingBuffer.h"
 #include "ARNETWORK_Manager.h"
 #include <libARNetwork/ARNETWORK_Manager.h>
 #include "ARNETWORK_IOBuffer.h"
@@ -90,6 +91,46 @@
  */
 eARNETWORK_ERROR ARNETWORK_Receiver_CopyDataRecv (ARNETWORK_Receiver_t *receiverPtr, ARNETWORK_IOBuffer_t *outputBufferPtr, ARNETWORKAL_Frame_t *framePtr);
 
+/**
+ * @brief add a fragment received to the message being reassembled, and copy the message to the output buffer once all its fragments are received
+ * @param receiverPtr the pointer on the receiver
+ * @param outputBufferPtr[in] pointer on the fragmenting output buffer, locked
+ * @param framePtr[in] pointer on the frame of the fragment received
+ * @return eARNETWORK_ERROR ; ARNETWORK_ERROR_BAD_PARAMETER if the fragment is malformed
+ * @pre only call by ARNETWORK_Receiver_ThreadRun()
+ */
+eARNETWORK_ERROR ARNETWORK_Receiver_ReassembleFragment (ARNETWORK_Receiver_t *receiverPtr, ARNETWORK_IOBuffer_t *outputBufferPtr, ARNETWORKAL_Frame_t *framePtr);
+
+/**
+ * @brief give the data received to the output callback of the output buffer, without copy
+ * @param outputBufferPtr[in] pointer on the output buffer
+ * @param data[in] pointer on the data received, in the frame
+ * @param dataSize[in] size of the data received
+ * @return eARNETWORK_ERROR ; ARNETWORK_ERROR_BAD_PARAMETER if the aggregate received is malformed
+ * @pre only call by ARNETWORK_Receiver_CopyDataRecv(), with the output buffer locked
+ */
+eARNETWORK_ERROR ARNETWORK_Receiver_CallOutputCallback (ARNETWORK_IOBuffer_t *outputBufferPtr, uint8_t *data, int dataSize);
+
+/**
+ * @brief record in the trace the push of a data in an output buffer, or its drop
+ * @param receiverPtr the pointer on the Receiver
+ * @param outputBufferPtr pointer on the output buffer
+ * @param[in] seq sequence number of the frame received
+ * @param[in] dataSize size of the data
+ * @param[in] error error returned by the push of the data
+ */
+static inline void ARNETWORK_Receiver_TracePush (ARNETWORK_Receiver_t *receiverPtr, ARNETWORK_IOBuffer_t *outputBufferPtr, uint8_t seq, int dataSize, eARNETWORK_ERROR error)
+{
+    if (error == ARNETWORK_OK)
+    {
+        ARNETWORK_Trace_Record (receiverPtr->tracePtr, ARNETWORK_TRACE_ROLE_RECEIVER, ARNETWORK_TRACE_EVENT_PUSH, outputBufferPtr->ID, seq, dataSize, 0);
+    }
+    else if (error == ARNETWORK_ERROR_BUFFER_SIZE)
+    {
+        ARNETWORK_Trace_Record (receiverPtr->tracePtr, ARNETWORK_TRACE_ROLE_RECEIVER, ARNETWORK_TRACE_EVENT_DROP, outputBufferPtr->ID, seq, dataSize, ARNETWORK_TRACE_DROP_REASON_OUTPUT_FULL);
+    }
+}
+
 /*****************************************
  *
  *             implementation :
@@ -123,6 +164,8 @@ ARNETWORK_Receiver_t* ARNETWORK_Receiver_New (ARNETWORKAL_Manager_t *networkALMa
         {
             receiverPtr->isAlive = 1;
             receiverPtr->senderPtr = NULL;
+            receiverPtr->notifierPtr = NULL;
+            receiverPtr->tracePtr = NULL;
 
             receiverPtr->numberOfOutputBuff = numberOfOutputBuff;
             receiverPtr->outputBufferPtrArr = outputBufferPtrArr;
@@ -130,6 +173,12 @@ ARNETWORK_Receiver_t* ARNETWORK_Receiver_New (ARNETWORKAL_Manager_t *networkALMa
             receiverPtr->outputBufferPtrMap = outputBufferPtrMap;
         }
 
+        if ((error == ARNETWORK_OK) &&
+            (ARSAL_Mutex_Init (&(receiverPtr->buffersMutex)) != 0))
+        {
+            error = ARNETWORK_ERROR_NEW_BUFFER;
+        }
+
         /** delete the receiver if an error occurred */
         if (error != ARNETWORK_OK)
         {
@@ -154,6 +203,7 @@ void ARNETWORK_Receiver_Delete (ARNETWORK_Receiver_t **receiverPtrAddr)
 
         if (receiverPtr)
         {
+            ARSAL_Mutex_Destroy (&(receiverPtr->buffersMutex));
             free (receiverPtr);
             receiverPtr = NULL;
         }
@@ -167,59 +217,102 @@ void* ARNETWORK_Receiver_ThreadRun (void *data)
 
     /** local declarations */
     ARNETWORK_Receiver_t *receiverPtr = data;
+
+    while (receiverPtr->isAlive)
+    {
+        ARNETWORK_Receiver_Process (receiverPtr);
+    }
+
+    return NULL;
+}
+
+void ARNETWORK_Receiver_Process (ARNETWORK_Receiver_t *receiverPtr)
+{
+    /** -- Receive the data available on the Receiver' socket. -- */
+
+    /** local declarations */
     ARNETWORKAL_Frame_t frame ;
     ARNETWORK_IOBuffer_t* outBufferPtrTemp = NULL;
     eARNETWORK_ERROR error = ARNETWORK_OK;
     eARNETWORKAL_MANAGER_RETURN result = ARNETWORKAL_MANAGER_RETURN_DEFAULT;
     uint8_t ackSeqNumData = 0;
+    int isImmediateAck = 0;
+    int isAckWithheld = 0;
+    int frameDataSize = 0;
     struct timespec now;
 
-    while (receiverPtr->isAlive)
+    /** wait a receipt */
+    if (receiverPtr->networkALManager->receive(receiverPtr->networkALManager) == ARNETWORKAL_MANAGER_RETURN_DEFAULT)
     {
-        /** wait a receipt */
-        if (receiverPtr->networkALManager->receive(receiverPtr->networkALManager) == ARNETWORKAL_MANAGER_RETURN_DEFAULT)
+        /* The buffers can not be added or removed during the processing of the frames */
+        ARSAL_Mutex_Lock (&(receiverPtr->buffersMutex));
+
+        /** for each frame present in the receiver buffer */
+        result = receiverPtr->networkALManager->popFrame(receiverPtr->networkALManager, &frame);
+        while (result == ARNETWORKAL_MANAGER_RETURN_DEFAULT)
         {
-            /** for each frame present in the receiver buffer */
-            result = receiverPtr->networkALManager->popFrame(receiverPtr->networkALManager, &frame);
-            while (result == ARNETWORKAL_MANAGER_RETURN_DEFAULT)
+            ARNETWORK_Trace_Record (receiverPtr->tracePtr, ARNETWORK_TRACE_ROLE_RECEIVER, ARNETWORK_TRACE_EVENT_RECEIVE, frame.id, frame.seq, frame.size, frame.type);
+
+            /* Special handling of internal frames */
+            if (frame.id < ARNETWORK_MANAGER_INTERNAL_BUFFER_ID_MAX)
             {
-                /* Special handling of internal frames */
-                if (frame.id < ARNETWORK_MANAGER_INTERNAL_BUFFER_ID_MAX)
+                switch (frame.id)
                 {
-                    switch (frame.id)
-                    {
-                    case ARNETWORK_MANAGER_INTERNAL_BUFFER_ID_PING:
-                        /* Ping, send the corresponding pong */
+                case ARNETWORK_MANAGER_INTERNAL_BUFFER_ID_PING:
+                    /* Ping, send the corresponding pong ; the timestamp is followed by the credits advertised by the peer */
+                {
+                    frameDataSize = frame.size - offsetof (ARNETWORKAL_Frame_t, dataPtr);
+                    ARNETWORK_Sender_SendPong (receiverPtr->senderPtr, frame.dataPtr, frameDataSize);
+                    if (frameDataSize > (int) sizeof (struct timespec))
                     {
-                        ARNETWORK_Sender_SendPong (receiverPtr->senderPtr, frame.dataPtr, frame.size);
+                        ARNETWORK_Sender_CreditsReceived (receiverPtr->senderPtr, frame.dataPtr + sizeof (struct timespec), frameDataSize - sizeof (struct timespec));
                     }
-                    break;
-                    case ARNETWORK_MANAGER_INTERNAL_BUFFER_ID_PONG:
-                        /* Pong, tells the sender that we got a response */
+                }
+                break;
+                case ARNETWORK_MANAGER_INTERNAL_BUFFER_ID_PONG:
+                    /* Pong, tells the sender that we got a response ; the timestamp is followed by the credits advertised by the peer */
+                {
+                    struct timespec dataTime;
+                    frameDataSize = frame.size - offsetof (ARNETWORKAL_Frame_t, dataPtr);
+                    if (frameDataSize >= (int) sizeof (struct timespec))
                     {
-                        struct timespec dataTime;
                         memcpy (&dataTime, frame.dataPtr, sizeof (struct timespec));
                         ARSAL_Time_GetTime(&now);
                         ARNETWORK_Sender_GotPingAck (receiverPtr->senderPtr, &dataTime, &now);
+                        ARNETWORK_Sender_CreditsReceived (receiverPtr->senderPtr, frame.dataPtr + sizeof (struct timespec), frameDataSize - sizeof (struct timespec));
                     }
+                }
+                break;
+                case ARNETWORK_MANAGER_INTERNAL_BUFFER_ID_ACK_COALESCED:
+                    /* Acknowledgments of several buffers, transmitted one by one to the sender */
+                    ARNETWORK_Sender_CoalescedAckReceived (receiverPtr->senderPtr, frame.dataPtr, frame.size - offsetof (ARNETWORKAL_Frame_t, dataPtr));
+                    break;
+                default:
+                    /* Do nothing as we don't know how to handle it */
                     break;
-                    default:
-                        /* Do nothing as we don't know how to handle it */
-                        break;
-                    }
                 }
+            }
 
-                /** management by the command type */
-                switch (frame.type)
-                {
-                case ARNETWORKAL_FRAME_TYPE_ACK:
+            /** management by the command type */
+            switch (frame.type)
+            {
+            case ARNETWORKAL_FRAME_TYPE_ACK:
 
+                /** the coalesced acknowledgments are transmitted to the sender by the handling of the internal frames */
+                if (frame.id >= ARNETWORK_MANAGER_INTERNAL_BUFFER_ID_MAX)
+                {
                     /** get the acknowledge sequence number from the data */
                     memcpy (&ackSeqNumData, frame.dataPtr, sizeof(uint8_t));
                     ARSAL_PRINT (ARSAL_PRINT_DEBUG, ARNETWORK_RECEIVER_TAG, "- TYPE: ARNETWORKAL_FRAME_TYPE_ACK | SEQ:%d | ID:%d | SEQ ACK : %d", frame.seq, frame.id, ackSeqNumData);
                     /** transmit the acknowledgement to the sender */
                     error = ARNETWORK_Sender_AckReceived (receiverPtr->senderPtr, ARNETWORK_Manager_IDAckToIDInput (receiverPtr->networkALManager, frame.id), ackSeqNumData);
-                    if (error != ARNETWORK_OK)
+
+                    /** the acknowledgement of a buffer controlled by credits carries the credits advertised by the peer ; the credits of a bad acknowledge are outdated */
+                    if ((error == ARNETWORK_OK) && (frame.size - offsetof (ARNETWORKAL_Frame_t, dataPtr) >= ARNETWORK_RECEIVER_CREDIT_ACK_SIZE))
+                    {
+                        ARNETWORK_Sender_CreditReceived (receiverPtr->senderPtr, ARNETWORK_Manager_IDAckToIDInput (receiverPtr->networkALManager, frame.id), frame.dataPtr[1]);
+                    }
+                    else if (error != ARNETWORK_OK)
                     {
                         switch (error)
                         {
@@ -232,131 +325,160 @@ void* ARNETWORK_Receiver_ThreadRun (void *data)
                             break;
                         }
                     }
-                    break;
+                }
+                break;
 
-                case ARNETWORKAL_FRAME_TYPE_DATA:
-                    ARSAL_PRINT (ARSAL_PRINT_DEBUG, ARNETWORK_RECEIVER_TAG, "- TYPE: ARNETWORKAL_FRAME_TYPE_DATA | SEQ:%d | ID:%d", frame.seq, frame.id);
+            case ARNETWORKAL_FRAME_TYPE_DATA:
+                ARSAL_PRINT (ARSAL_PRINT_DEBUG, ARNETWORK_RECEIVER_TAG, "- TYPE: ARNETWORKAL_FRAME_TYPE_DATA | SEQ:%d | ID:%d", frame.seq, frame.id);
 
-                    /** push the data received in the output buffer targeted */
-                    outBufferPtrTemp = receiverPtr->outputBufferPtrMap[frame.id];
+                /** push the data received in the output buffer targeted */
+                outBufferPtrTemp = receiverPtr->outputBufferPtrMap[frame.id];
 
-                    if (outBufferPtrTemp != NULL)
+                if (outBufferPtrTemp != NULL)
+                {
+                    /** lock the IOBuffer */
+                    error = ARNETWORK_IOBuffer_Lock(outBufferPtrTemp);
+                    if(error == ARNETWORK_OK)
                     {
-                        /** lock the IOBuffer */
-                        error = ARNETWORK_IOBuffer_Lock(outBufferPtrTemp);
-                        if(error == ARNETWORK_OK)
+                        ARSAL_Time_GetTime(&now);
+                        ARNETWORK_LinkQuality_OnFrame (&(outBufferPtrTemp->linkQuality), frame.seq, &now);
+
+                        if (ARNETWORK_IOBuffer_ShouldAcceptData (outBufferPtrTemp, frame.seq) > 0)
                         {
-                            if (ARNETWORK_IOBuffer_ShouldAcceptData (outBufferPtrTemp, frame.seq) > 0)
-                            {
-                                error = ARNETWORK_Receiver_CopyDataRecv(receiverPtr, outBufferPtrTemp, &frame);
-                            }
-                            else
-                            {
-                                ARSAL_PRINT (ARSAL_PRINT_DEBUG, ARNETWORK_RECEIVER_TAG, "Received an old frame for buffer %d", outBufferPtrTemp->ID);
-                            }
+                            error = ARNETWORK_Receiver_CopyDataRecv(receiverPtr, outBufferPtrTemp, &frame);
+                        }
+                        else
+                        {
+                            ARSAL_PRINT (ARSAL_PRINT_DEBUG, ARNETWORK_RECEIVER_TAG, "Received an old frame for buffer %d", outBufferPtrTemp->ID);
+                            ARNETWORK_Trace_Record (receiverPtr->tracePtr, ARNETWORK_TRACE_ROLE_RECEIVER, ARNETWORK_TRACE_EVENT_DROP, frame.id, frame.seq, frame.size, ARNETWORK_TRACE_DROP_REASON_OLD_FRAME);
+                        }
 
-                            /** unlock the IOBuffer */
-                            ARNETWORK_IOBuffer_Unlock(outBufferPtrTemp);
+                        /** unlock the IOBuffer */
+                        ARNETWORK_IOBuffer_Unlock(outBufferPtrTemp);
 
-                            if(error != ARNETWORK_OK)
-                            {
-                                ARSAL_PRINT (ARSAL_PRINT_ERROR, ARNETWORK_RECEIVER_TAG, "data received, error: %s", ARNETWORK_Error_ToString (error));
-                            }
+                        /** the data dropped by a full output buffer are counted by its overflow policy */
+                        if ((error != ARNETWORK_OK) && (error != ARNETWORK_ERROR_BUFFER_SIZE))
+                        {
+                            ARSAL_PRINT (ARSAL_PRINT_ERROR, ARNETWORK_RECEIVER_TAG, "data received, error: %s", ARNETWORK_Error_ToString (error));
                         }
                     }
-                    break;
+                }
+                break;
 
-                case ARNETWORKAL_FRAME_TYPE_DATA_LOW_LATENCY:
-                    ARSAL_PRINT (ARSAL_PRINT_DEBUG, ARNETWORK_RECEIVER_TAG, "- TYPE: ARNETWORKAL_FRAME_TYPE_DATA_LOW_LATENCY | SEQ:%d | ID:%d", frame.seq, frame.id);
+            case ARNETWORKAL_FRAME_TYPE_DATA_LOW_LATENCY:
+                ARSAL_PRINT (ARSAL_PRINT_DEBUG, ARNETWORK_RECEIVER_TAG, "- TYPE: ARNETWORKAL_FRAME_TYPE_DATA_LOW_LATENCY | SEQ:%d | ID:%d", frame.seq, frame.id);
 
-                    /** push the data received in the output buffer targeted */
-                    outBufferPtrTemp = receiverPtr->outputBufferPtrMap[frame.id];
+                /** push the data received in the output buffer targeted */
+                outBufferPtrTemp = receiverPtr->outputBufferPtrMap[frame.id];
 
-                    if (outBufferPtrTemp != NULL)
+                if (outBufferPtrTemp != NULL)
+                {
+                    /** lock the IOBuffer */
+                    error = ARNETWORK_IOBuffer_Lock(outBufferPtrTemp);
+                    if(error == ARNETWORK_OK)
                     {
-                        /** lock the IOBuffer */
-                        error = ARNETWORK_IOBuffer_Lock(outBufferPtrTemp);
-                        if(error == ARNETWORK_OK)
+                        ARSAL_Time_GetTime(&now);
+                        ARNETWORK_LinkQuality_OnFrame (&(outBufferPtrTemp->linkQuality), frame.seq, &now);
+
+                        if (ARNETWORK_IOBuffer_ShouldAcceptData (outBufferPtrTemp, frame.seq) > 0)
                         {
-                            if (ARNETWORK_IOBuffer_ShouldAcceptData (outBufferPtrTemp, frame.seq) > 0)
-                            {
-                                error = ARNETWORK_Receiver_CopyDataRecv(receiverPtr, outBufferPtrTemp, &frame);
-                            }
-                            else
-                            {
-                                ARSAL_PRINT (ARSAL_PRINT_DEBUG, ARNETWORK_RECEIVER_TAG, "Received an old frame for buffer %d", outBufferPtrTemp->ID);
-                            }
+                            error = ARNETWORK_Receiver_CopyDataRecv(receiverPtr, outBufferPtrTemp, &frame);
+                        }
+                        else
+                        {
+                            ARSAL_PRINT (ARSAL_PRINT_DEBUG, ARNETWORK_RECEIVER_TAG, "Received an old frame for buffer %d", outBufferPtrTemp->ID);
+                            ARNETWORK_Trace_Record (receiverPtr->tracePtr, ARNETWORK_TRACE_ROLE_RECEIVER, ARNETWORK_TRACE_EVENT_DROP, frame.id, frame.seq, frame.size, ARNETWORK_TRACE_DROP_REASON_OLD_FRAME);
+                        }
 
-                            /** unlock the IOBuffer */
-                            ARNETWORK_IOBuffer_Unlock(outBufferPtrTemp);
+                        /** unlock the IOBuffer */
+                        ARNETWORK_IOBuffer_Unlock(outBufferPtrTemp);
 
-                            if(error != ARNETWORK_OK)
-                            {
-                                ARSAL_PRINT (ARSAL_PRINT_ERROR, ARNETWORK_RECEIVER_TAG, "data received, error: %s", ARNETWORK_Error_ToString (error));
-                            }
+                        /** the data dropped by a full output buffer are counted by its overflow policy */
+                        if ((error != ARNETWORK_OK) && (error != ARNETWORK_ERROR_BUFFER_SIZE))
+                        {
+                            ARSAL_PRINT (ARSAL_PRINT_ERROR, ARNETWORK_RECEIVER_TAG, "data received, error: %s", ARNETWORK_Error_ToString (error));
                         }
                     }
-                    break;
+                }
+                break;
 
-                case ARNETWORKAL_FRAME_TYPE_DATA_WITH_ACK:
-                    ARSAL_PRINT (ARSAL_PRINT_DEBUG, ARNETWORK_RECEIVER_TAG, "- TYPE: ARNETWORKAL_FRAME_TYPE_DATA_WITH_ACK | SEQ:%d | ID:%d", frame.seq, frame.id);
+            case ARNETWORKAL_FRAME_TYPE_DATA_WITH_ACK:
+                ARSAL_PRINT (ARSAL_PRINT_DEBUG, ARNETWORK_RECEIVER_TAG, "- TYPE: ARNETWORKAL_FRAME_TYPE_DATA_WITH_ACK | SEQ:%d | ID:%d", frame.seq, frame.id);
 
-                    /**
-                     * push the data received in the output buffer targeted,
-                     * save the sequence of the command and return an acknowledgement
-                     */
-                    outBufferPtrTemp = receiverPtr->outputBufferPtrMap[frame.id];
+                /**
+                 * push the data received in the output buffer targeted,
+                 * save the sequence of the command and return an acknowledgement
+                 */
+                outBufferPtrTemp = receiverPtr->outputBufferPtrMap[frame.id];
 
-                    if (outBufferPtrTemp != NULL)
+                if (outBufferPtrTemp != NULL)
+                {
+                    /** lock the IOBuffer */
+                    error = ARNETWORK_IOBuffer_Lock(outBufferPtrTemp);
+                    if(error == ARNETWORK_OK)
                     {
-                        /** lock the IOBuffer */
-                        error = ARNETWORK_IOBuffer_Lock(outBufferPtrTemp);
-                        if(error == ARNETWORK_OK)
+                        ARSAL_Time_GetTime(&now);
+                        ARNETWORK_LinkQuality_OnFrame (&(outBufferPtrTemp->linkQuality), frame.seq, &now);
+
+                        /** the fragments are sent in a window: their order is not checked by the sequence number */
+                        if (outBufferPtrTemp->isFragmenting)
                         {
-                            /** OutBuffer->seqWaitAck used to save the last seq */
-                            if (ARNETWORK_IOBuffer_ShouldAcceptData (outBufferPtrTemp, frame.seq) > 0)
-                            {
-                                error = ARNETWORK_Receiver_CopyDataRecv(receiverPtr, outBufferPtrTemp, &frame);
-                            }
-                            else
-                            {
-                                ARSAL_PRINT (ARSAL_PRINT_DEBUG, ARNETWORK_RECEIVER_TAG, "Received an old frame for buffer %d", outBufferPtrTemp->ID);
-                            }
+                            error = ARNETWORK_Receiver_ReassembleFragment(receiverPtr, outBufferPtrTemp, &frame);
+                        }
+                        /** OutBuffer->seqWaitAck used to save the last seq */
+                        else if (ARNETWORK_IOBuffer_ShouldAcceptData (outBufferPtrTemp, frame.seq) > 0)
+                        {
+                            error = ARNETWORK_Receiver_CopyDataRecv(receiverPtr, outBufferPtrTemp, &frame);
+                        }
+                        else
+                        {
+                            ARSAL_PRINT (ARSAL_PRINT_DEBUG, ARNETWORK_RECEIVER_TAG, "Received an old frame for buffer %d", outBufferPtrTemp->ID);
+                            ARNETWORK_Trace_Record (receiverPtr->tracePtr, ARNETWORK_TRACE_ROLE_RECEIVER, ARNETWORK_TRACE_EVENT_DROP, frame.id, frame.seq, frame.size, ARNETWORK_TRACE_DROP_REASON_OLD_FRAME);
+                        }
 
-                            if(error != ARNETWORK_OK)
-                            {
-                                ARSAL_PRINT (ARSAL_PRINT_ERROR, ARNETWORK_RECEIVER_TAG, "data acknowledged received, error: %s", ARNETWORK_Error_ToString (error));
-                            }
-                            /** unlock the IOBuffer */
-                            ARNETWORK_IOBuffer_Unlock(outBufferPtrTemp);
+                        /** the data dropped by a full output buffer are counted by its overflow policy */
+                        if ((error != ARNETWORK_OK) && (error != ARNETWORK_ERROR_BUFFER_SIZE))
+                        {
+                            ARSAL_PRINT (ARSAL_PRINT_ERROR, ARNETWORK_RECEIVER_TAG, "data acknowledged received, error: %s", ARNETWORK_Error_ToString (error));
+                        }
+                        isImmediateAck = outBufferPtrTemp->isImmediateAck;
 
-                            /** sending ack even if the seq is not correct */
-                            error = ARNETWORK_Receiver_ReturnACK(receiverPtr, frame.id, frame.seq);
-                            if(error != ARNETWORK_OK)
+                        /** the backpressure withholds the acknowledgement of the data not stored, so the sender sends it again later */
+                        isAckWithheld = ((error == ARNETWORK_ERROR_BUFFER_SIZE) && (outBufferPtrTemp->overflowPolicy == ARNETWORK_IOBUFFERPARAM_OVERFLOW_POLICY_BACKPRESSURE));
+                        if (isAckWithheld)
+                        {
+                            outBufferPtrTemp->numberOfAcksWithheld++;
+                        }
+
+                        /** unlock the IOBuffer */
+                        ARNETWORK_IOBuffer_Unlock(outBufferPtrTemp);
+
+                        /** sending ack even if the seq is not correct */
+                        error = (isAckWithheld) ? ARNETWORK_OK : ARNETWORK_Receiver_ReturnACK(receiverPtr, frame.id, frame.seq, isImmediateAck);
+                        if(error != ARNETWORK_OK)
+                        {
+                            int level = ARSAL_PRINT_ERROR;
+                            if (error == ARNETWORK_ERROR_BUFFER_SIZE)
                             {
-                                int level = ARSAL_PRINT_ERROR;
-                                if (error == ARNETWORK_ERROR_BUFFER_SIZE)
-                                {
-                                    level = ARSAL_PRINT_DEBUG;
-                                }
-                                ARSAL_PRINT(level, ARNETWORK_RECEIVER_TAG, "ReturnACK, error: %s", ARNETWORK_Error_ToString(error));
+                                level = ARSAL_PRINT_DEBUG;
                             }
+                            ARSAL_PRINT(level, ARNETWORK_RECEIVER_TAG, "ReturnACK, error: %s", ARNETWORK_Error_ToString(error));
                         }
                     }
-                    break;
-
-                default:
-                    ARSAL_PRINT (ARSAL_PRINT_WARNING, ARNETWORK_RECEIVER_TAG, "!!! command type: %d not known  !!!", frame.type);
-                    break;
                 }
+                break;
 
-                /** get the next frame*/
-                result = receiverPtr->networkALManager->popFrame(receiverPtr->networkALManager, &frame);
+            default:
+                ARSAL_PRINT (ARSAL_PRINT_WARNING, ARNETWORK_RECEIVER_TAG, "!!! command type: %d not known  !!!", frame.type);
+                break;
             }
+
+            /** get the next frame*/
+            result = receiverPtr->networkALManager->popFrame(receiverPtr->networkALManager, &frame);
         }
-    }
 
-    return NULL;
+        ARSAL_Mutex_Unlock (&(receiverPtr->buffersMutex));
+    }
 }
 
 void ARNETWORK_Receiver_Stop (ARNETWORK_Receiver_t *receiverPtr)
@@ -365,20 +487,72 @@ void ARNETWORK_Receiver_Stop (ARNETWORK_Receiver_t *receiverPtr)
     receiverPtr->isAlive = 0;
 }
 
-eARNETWORK_ERROR ARNETWORK_Receiver_ReturnACK (ARNETWORK_Receiver_t *receiverPtr, int id, uint8_t seq)
+eARNETWORK_ERROR ARNETWORK_Receiver_Reset (ARNETWORK_Receiver_t *receiverPtr)
+{
+    /** -- Reset the Receiver -- */
+
+    /** local declarations */
+    eARNETWORK_ERROR error = ARNETWORK_OK;
+    int outputIndex = 0;
+    ARNETWORK_IOBuffer_t *outputBufferTemp = NULL;
+
+    /** reset all output buffers, including the buffers of acknowledgement */
+    for (outputIndex = 0; (outputIndex < receiverPtr->numberOfOutputBuff) && (error == ARNETWORK_OK); ++outputIndex)
+    {
+        outputBufferTemp = receiverPtr->outputBufferPtrArr[outputIndex];
+
+        /** lock the IOBuffer */
+        error = ARNETWORK_IOBuffer_Lock (outputBufferTemp);
+
+        if (error == ARNETWORK_OK)
+        {
+            /** reset the IoBuffer */
+            error = ARNETWORK_IOBuffer_Reset (outputBufferTemp);
+
+            /** unlock the IOBuffer */
+            ARNETWORK_IOBuffer_Unlock (outputBufferTemp);
+        }
+    }
+
+    /** the reception can be started again after a stop */
+    receiverPtr->isAlive = 1;
+
+    return error;
+}
+
+eARNETWORK_ERROR ARNETWORK_Receiver_ReturnACK (ARNETWORK_Receiver_t *receiverPtr, int id, uint8_t seq, int isImmediate)
 {
     /** -- return an acknowledgement -- */
     /** local declarations */
     eARNETWORK_ERROR error = ARNETWORK_OK;
     ARNETWORK_IOBuffer_t* ACKIOBufferPtr = receiverPtr->outputBufferPtrMap[ARNETWORK_Manager_IDOutputToIDAck (receiverPtr->networkALManager, id)];
+    ARNETWORK_IOBuffer_t* outputBufferPtr = receiverPtr->outputBufferPtrMap[id];
+    uint8_t ackData[ARNETWORK_RECEIVER_CREDIT_ACK_SIZE];
+    int ackDataSize = sizeof (seq);
 
     if (ACKIOBufferPtr != NULL)
     {
-        int isEmpty = ARNETWORK_RingBuffer_IsEmpty(ACKIOBufferPtr->dataDescriptorRBuffer);
-        error = ARNETWORK_IOBuffer_AddData (ACKIOBufferPtr, (uint8_t*) &seq, sizeof(seq), NULL, NULL, 1);
-        if (error == ARNETWORK_OK && isEmpty > 0)
+        /**
+         * the delayed acknowledgments are coalesced by the sender ; otherwise the acknowledgment is sent alone in the buffer of acknowledgement.
+         * the acknowledgments of the fragments are never delayed: only the last one of a buffer would be kept
+         */
+        if ((outputBufferPtr->isFragmenting) || (outputBufferPtr->isCreditFlowControlled) ||
+            (!ARNETWORK_Sender_DelayAck (receiverPtr->senderPtr, id, seq, isImmediate)))
         {
-            ARNETWORK_Sender_SignalNewData (receiverPtr->senderPtr);
+            int isEmpty = ARNETWORK_RingBuffer_IsEmpty(ACKIOBufferPtr->dataDescriptorRBuffer);
+            ackData[0] = seq;
+            if ((outputBufferPtr->isCreditFlowControlled) && (ARNETWORK_IOBuffer_Lock (outputBufferPtr) == ARNETWORK_OK))
+            {
+                /** the acknowledgement carries the credits of the output buffer */
+                ackData[1] = (uint8_t) ARNETWORK_IOBuffer_AdvertiseCredits (outputBufferPtr);
+                ackDataSize = ARNETWORK_RECEIVER_CREDIT_ACK_SIZE;
+                ARNETWORK_IOBuffer_Unlock (outputBufferPtr);
+            }
+            error = ARNETWORK_IOBuffer_AddData (ACKIOBufferPtr, ackData, ackDataSize, NULL, NULL, 1);
+            if (error == ARNETWORK_OK && isEmpty > 0)
+            {
+                ARNETWORK_Sender_SignalNewData (receiverPtr->senderPtr);
+            }
         }
     }
 
@@ -398,30 +572,99 @@ eARNETWORK_ERROR ARNETWORK_Receiver_CopyDataRecv (ARNETWORK_Receiver_t *receiver
     eARNETWORK_ERROR error = ARNETWORK_OK;
     int semError = 0;
     int dataSize = 0;
+    int isAggregate = 0;
+    int isCallback = 0;
+    int aggregateOffset = 0;
+    int readSize = 0;
+    uint8_t *aggregatedData = NULL;
+    int aggregatedDataSize = 0;
+    int wasEmpty = (ARNETWORK_RingBuffer_GetNumberOfData (outputBufferPtr->dataDescriptorRBuffer) == 0);
 
     int nbNew = ARNETWORK_IOBuffer_ShouldAcceptData (outputBufferPtr, framePtr->seq);
 
     /** get the data size*/
     dataSize = framePtr->size - offsetof (ARNETWORKAL_Frame_t, dataPtr);
 
-    /** if the output buffer can copy the data */
-    if (ARNETWORK_IOBuffer_CanCopyData (outputBufferPtr))
+    if (outputBufferPtr->outputCallback != NULL)
     {
-        /** copy the data in the IOBuffer */
-        error = ARNETWORK_IOBuffer_AddData (outputBufferPtr, framePtr->dataPtr, dataSize, NULL, NULL, 1);
+        /** zero copy: the data are given to the callback directly from the frame received */
+        error = ARNETWORK_Receiver_CallOutputCallback (outputBufferPtr, framePtr->dataPtr, dataSize);
+        isCallback = 1;
     }
-    else
+    /** if the output buffer can copy the data */
+    else if (!ARNETWORK_IOBuffer_CanCopyData (outputBufferPtr))
     {
         error = ARNETWORK_ERROR_BAD_PARAMETER;
         ARSAL_PRINT (ARSAL_PRINT_ERROR, ARNETWORK_RECEIVER_TAG, "Error: output buffer can't copy data");
     }
+    else if ((outputBufferPtr->isAggregating) &&
+             (outputBufferPtr->overflowPolicy == ARNETWORK_IOBUFFERPARAM_OVERFLOW_POLICY_BACKPRESSURE) &&
+             (outputBufferPtr->dataType == ARNETWORKAL_FRAME_TYPE_DATA_WITH_ACK) &&
+             (!wasEmpty) &&
+             (ARNETWORK_IOBuffer_CountAggregatedData (framePtr->dataPtr, dataSize) > ARNETWORK_RingBuffer_GetFreeCellNumber (outputBufferPtr->dataDescriptorRBuffer)))
+    {
+        /**
+         * an aggregate is acknowledged as a whole: it is withheld if all its data can't be stored.
+         * an aggregate larger than the empty output buffer could never be stored: it is stored partially.
+         */
+        error = ARNETWORK_ERROR_BUFFER_SIZE;
+    }
+    else if (outputBufferPtr->isAggregating)
+    {
+        /** split the aggregate: each data is an entry of the output buffer */
+        while ((error == ARNETWORK_OK) && (aggregateOffset < dataSize))
+        {
+            readSize = ARNETWORK_IOBuffer_ReadAggregatedData (framePtr->dataPtr + aggregateOffset, dataSize - aggregateOffset, &aggregatedData, &aggregatedDataSize);
+            if (readSize < 0)
+            {
+                error = ARNETWORK_ERROR_BAD_PARAMETER;
+                ARSAL_PRINT (ARSAL_PRINT_ERROR, ARNETWORK_RECEIVER_TAG, "Error: malformed aggregate received in buffer %d", outputBufferPtr->ID);
+            }
+            else
+            {
+                /** copy the data in the IOBuffer */
+                error = ARNETWORK_IOBuffer_PushReceivedData (outputBufferPtr, aggregatedData, aggregatedDataSize);
+                ARNETWORK_Receiver_TracePush (receiverPtr, outputBufferPtr, framePtr->seq, aggregatedDataSize, error);
+                aggregateOffset += readSize;
+            }
 
-    if (error == ARNETWORK_OK)
+            /** post a semaphore to indicate data ready to be read */
+            if ((error == ARNETWORK_OK) && (ARSAL_Sem_Post (&(outputBufferPtr->outputSem)) != 0))
+            {
+                error = ARNETWORK_ERROR_SEMAPHORE;
+            }
+        }
+
+        if ((error == ARNETWORK_ERROR_BUFFER_SIZE) && (aggregateOffset > 0))
+        {
+            /** partial aggregate: the data following the data dropped are dropped too */
+            outputBufferPtr->numberOfDroppedNewest += ARNETWORK_IOBuffer_CountAggregatedData (framePtr->dataPtr + aggregateOffset, dataSize - aggregateOffset);
+            if (outputBufferPtr->overflowPolicy == ARNETWORK_IOBUFFERPARAM_OVERFLOW_POLICY_BACKPRESSURE)
+            {
+                /** it is acknowledged: the data withheld is dropped */
+                outputBufferPtr->numberOfDroppedNewest++;
+                error = ARNETWORK_OK;
+            }
+        }
+        isAggregate = 1;
+    }
+    else
+    {
+        /** copy the data in the IOBuffer */
+        error = ARNETWORK_IOBuffer_PushReceivedData (outputBufferPtr, framePtr->dataPtr, dataSize);
+        ARNETWORK_Receiver_TracePush (receiverPtr, outputBufferPtr, framePtr->seq, dataSize, error);
+    }
+
+    if ((error == ARNETWORK_OK) || (aggregateOffset > 0))
     {
-        /** Keep buffer "miss count" accurate */
+        /** Keep buffer "miss count" accurate ; the sequence number counts the frames, not the aggregated data */
         outputBufferPtr->nbPackets++;
         outputBufferPtr->nbNetwork += nbNew;
         outputBufferPtr->seq = framePtr->seq;
+    }
+
+    if ((error == ARNETWORK_OK) && (!isAggregate) && (!isCallback))
+    {
         /** post a semaphore to indicate data ready to be read */
         semError = ARSAL_Sem_Post (&(outputBufferPtr->outputSem));
 
@@ -431,5 +674,111 @@ eARNETWORK_ERROR ARNETWORK_Receiver_CopyDataRecv (ARNETWORK_Receiver_t *receiver
         }
     }
 
+    /** notify only the transition of the output buffer from empty to ready to be read */
+    if ((wasEmpty) && (receiverPtr->notifierPtr != NULL) && (ARNETWORK_RingBuffer_GetNumberOfData (outputBufferPtr->dataDescriptorRBuffer) > 0))
+    {
+        ARNETWORK_Notifier_Signal (receiverPtr->notifierPtr);
+    }
+    else if (((error == ARNETWORK_OK) || (aggregateOffset > 0)) && (!isCallback) && (receiverPtr->notifierPtr != NULL))
+    {
+        /** the readers waiting several buffers are woken up by each data, the buffer read by another thread may be not empty */
+        ARNETWORK_Notifier_Wake (receiverPtr->notifierPtr);
+    }
+
+    return error;
+}
+
+eARNETWORK_ERROR ARNETWORK_Receiver_ReassembleFragment (ARNETWORK_Receiver_t *receiverPtr, ARNETWORK_IOBuffer_t *outputBufferPtr, ARNETWORKAL_Frame_t *framePtr)
+{
+    /** -- add a fragment received to its message -- */
+
+    /** local declarations */
+    eARNETWORK_ERROR error = ARNETWORK_OK;
+    ARNETWORKAL_Frame_t messageFrame;
+    uint8_t messageNumber = 0;
+    int fragmentIndex = 0;
+    int numberOfFragments = 0;
+    int fragmentSize = 0;
+    int headerSize = 0;
+    int isComplete = 0;
+    int frameDataSize = framePtr->size - offsetof (ARNETWORKAL_Frame_t, dataPtr);
+
+    headerSize = ARNETWORK_IOBuffer_ReadFragmentHeader (framePtr->dataPtr, frameDataSize, &messageNumber, &fragmentIndex, &numberOfFragments, &fragmentSize);
+    if (headerSize < 0)
+    {
+        error = ARNETWORK_ERROR_BAD_PARAMETER;
+        ARSAL_PRINT (ARSAL_PRINT_ERROR, ARNETWORK_RECEIVER_TAG, "Error: malformed fragment received in buffer %d", outputBufferPtr->ID);
+    }
+    else
+    {
+        error = ARNETWORK_IOBuffer_AddFragment (outputBufferPtr, messageNumber, fragmentIndex, numberOfFragments, fragmentSize, framePtr->dataPtr + headerSize, frameDataSize - headerSize, &isComplete);
+    }
+
+    if (error == ARNETWORK_ERROR_BUFFER_EMPTY)
+    {
+        /** a fragment sent again after the reassembly of its message */
+        ARSAL_PRINT (ARSAL_PRINT_DEBUG, ARNETWORK_RECEIVER_TAG, "Received an old fragment for buffer %d", outputBufferPtr->ID);
+        ARNETWORK_Trace_Record (receiverPtr->tracePtr, ARNETWORK_TRACE_ROLE_RECEIVER, ARNETWORK_TRACE_EVENT_DROP, framePtr->id, framePtr->seq, frameDataSize, ARNETWORK_TRACE_DROP_REASON_OLD_FRAME);
+        error = ARNETWORK_OK;
+    }
+    else if (error == ARNETWORK_ERROR_BUFFER_SIZE)
+    {
+        /** a message larger than the output buffer could never be stored, whatever its overflow policy */
+        ARNETWORK_Trace_Record (receiverPtr->tracePtr, ARNETWORK_TRACE_ROLE_RECEIVER, ARNETWORK_TRACE_EVENT_DROP, framePtr->id, framePtr->seq, frameDataSize, ARNETWORK_TRACE_DROP_REASON_OUTPUT_FULL);
+        error = ARNETWORK_ERROR_BAD_PARAMETER;
+    }
+
+    if ((error == ARNETWORK_OK) && (isComplete))
+    {
+        /** the message reassembled is copied as the data of one frame */
+        messageFrame = *framePtr;
+        messageFrame.dataPtr = outputBufferPtr->reassemblyData;
+        messageFrame.size = offsetof (ARNETWORKAL_Frame_t, dataPtr) + outputBufferPtr->reassemblySize;
+        error = ARNETWORK_Receiver_CopyDataRecv (receiverPtr, outputBufferPtr, &messageFrame);
+
+        /** a message withheld by the backpressure is stored at the next reception of one of its fragments */
+        if ((error != ARNETWORK_ERROR_BUFFER_SIZE) || (outputBufferPtr->overflowPolicy != ARNETWORK_IOBUFFERPARAM_OVERFLOW_POLICY_BACKPRESSURE))
+        {
+            ARNETWORK_IOBuffer_EndReassembly (outputBufferPtr);
+        }
+    }
+
+    return error;
+}
+
+eARNETWORK_ERROR ARNETWORK_Receiver_CallOutputCallback (ARNETWORK_IOBuffer_t *outputBufferPtr, uint8_t *data, int dataSize)
+{
+    /** -- give the data received to the output callback -- */
+
+    /** local declarations */
+    eARNETWORK_ERROR error = ARNETWORK_OK;
+    int aggregateOffset = 0;
+    int readSize = 0;
+    uint8_t *aggregatedData = NULL;
+    int aggregatedDataSize = 0;
+
+    if (outputBufferPtr->isAggregating)
+    {
+        /** split the aggregate: the callback is called for each data */
+        while ((error == ARNETWORK_OK) && (aggregateOffset < dataSize))
+        {
+            readSize = ARNETWORK_IOBuffer_ReadAggregatedData (data + aggregateOffset, dataSize - aggregateOffset, &aggregatedData, &aggregatedDataSize);
+            if (readSize < 0)
+            {
+                error = ARNETWORK_ERROR_BAD_PARAMETER;
+                ARSAL_PRINT (ARSAL_PRINT_ERROR, ARNETWORK_RECEIVER_TAG, "Error: malformed aggregate received in buffer %d", outputBufferPtr->ID);
+            }
+            else
+            {
+                outputBufferPtr->outputCallback (outputBufferPtr->ID, aggregatedData, aggregatedDataSize, outputBufferPtr->outputCallbackCustomData);
+                aggregateOffset += readSize;
+            }
+        }
+    }
+    else
+    {
+        outputBufferPtr->outputCallback (outputBufferPtr->ID, data, dataSize, outputBufferPtr->outputCallbackCustomData);
+    }
+
     return error;
 }
@@ -41,6 +41,13 @@
 #include <libARNetworkAL/ARNETWORKAL_Manager.h>
 #include "ARNETWORK_IOBuffer.h"
 #include "ARNETWORK_Sender.h"
+#include "ARNETWORK_Notifier.h"
+#include "ARNETWORK_Trace.h"
+
+/**
+ * @brief Size of the acknowledgement of a buffer controlled by credits : sequence number acknowledged, then number of credits
+ */
+#define ARNETWORK_RECEIVER_CREDIT_ACK_SIZE (2)
 
 /**
  * @brief receiver manager
@@ -51,11 +58,14 @@ typedef struct
 {
 	ARNETWORKAL_Manager_t *networkALManager;
     ARNETWORK_Sender_t *senderPtr; /**< Pointer on the sender which waits the acknowledgments*/
+    ARNETWORK_Notifier_t *notifierPtr; /**< Pointer on the notifier signaled when an output buffer becomes ready to be read ; NULL if not used */
+    ARNETWORK_Trace_t *tracePtr; /**< Pointer on the trace of the Manager ; NULL if not used */
     ARNETWORK_IOBuffer_t **outputBufferPtrArr; /**< address of the array of pointers of output buffer*/
     int numberOfOutputBuff; /**< Number of output buffer*/
     ARNETWORK_IOBuffer_t **internalOutputBufferPtrArr; /**< address of the array of pointers of internal output buffer*/
     int numberOfInternalOutputBuff; /**< Number of internal output buffer*/
     ARNETWORK_IOBuffer_t** outputBufferPtrMap; /**< address of the array storing the outputBuffers by their identifier */
+    ARSAL_Mutex_t buffersMutex; /**< Mutex held during the processing of the frames received ; taken with the one of the sender to change the arrays of buffers */
 
     uint8_t* readingPointer; /** head of reading on the RecvBuffer */
 
@@ -96,6 +106,14 @@ void ARNETWORK_Receiver_Delete(ARNETWORK_Receiver_t **receiverPtrAddr);
  */
 void* ARNETWORK_Receiver_ThreadRun(void *data);
 
+/**
+ * @brief Receive the data available on the Receiver' socket once
+ * @details Used by ARNETWORK_Receiver_ThreadRun(), and by the drivers of a receiver run without its own thread, once its socket is readable ; it waits a receipt as the receive function of the networkAL does.
+ * @warning must not be called by several threads at once
+ * @param receiverPtr pointer on the Receiver
+ */
+void ARNETWORK_Receiver_Process (ARNETWORK_Receiver_t *receiverPtr);
+
 /**
  * @brief stop the reception
  * @details Used to kill the thread calling ARNETWORK_Receiver_ThreadRun().
@@ -104,14 +122,26 @@ void* ARNETWORK_Receiver_ThreadRun(void *data);
  */
 void ARNETWORK_Receiver_Stop(ARNETWORK_Receiver_t *receiverPtr);
 
+/**
+ * @brief reset the Receiver to its state of creation, keeping its memory and its settings
+ * @details All output buffers are reset. The Receiver is alive again: the thread calling ARNETWORK_Receiver_ThreadRun() can be started again after a stop.
+ * @warning the processing of the receiver must be blocked by its buffersMutex
+ * @param receiverPtr pointer on the Receiver
+ * @return eARNETWORK_ERROR
+ * @see ARNETWORK_IOBuffer_Reset()
+ */
+eARNETWORK_ERROR ARNETWORK_Receiver_Reset (ARNETWORK_Receiver_t *receiverPtr);
+
 /**
  * @brief return an acknowledgement to the sender
  * @param receiverPtr the pointer on the Receiver
  * @param[in] ID identifier of the command to acknowledged
  * @param[in] seq sequence number of the command to acknowledged
+ * @param[in] isImmediate 1 to send the acknowledgment immediately even if the acknowledgments are delayed, otherwise 0
  * @return eARNETWORK_ERROR
  * @see ARNETWORK_Receiver_New()
+ * @see ARNETWORK_Sender_DelayAck()
  */
-eARNETWORK_ERROR ARNETWORK_Receiver_ReturnACK(ARNETWORK_Receiver_t *receiverPtr, int identifer, uint8_t seq);
+eARNETWORK_ERROR ARNETWORK_Receiver_ReturnACK(ARNETWORK_Receiver_t *receiverPtr, int identifer, uint8_t seq, int isImmediate);
 
 #endif /** _ARNETWORK_RECEIVER_PRIVATE_H_ */
@@ -79,6 +79,31 @@ static inline void ARNETWORK_RingBuffer_NormalizeIndexes(ARNETWORK_RingBuffer_t
     /* No else: the Indexes are already normalized. */
 }
 
+/* Take the cell at the back of the ring buffer, overwriting the oldest data if the buffer is full and overwriting.
+ * The mutex of the ring buffer must be locked. Returns NULL if the buffer is full and not overwriting. */
+static inline uint8_t* ARNETWORK_RingBuffer_PushBackCell(ARNETWORK_RingBuffer_t *ringBuffer)
+{
+    uint8_t* buffer = NULL;
+
+    /* check if the has enough free cell or the buffer is overwriting */
+    if ((ARNETWORK_RingBuffer_GetFreeCellNumber(ringBuffer)) || (ringBuffer->isOverwriting))
+    {
+        if (!ARNETWORK_RingBuffer_GetFreeCellNumber(ringBuffer))
+        {
+            (ringBuffer->indexOutput) += ringBuffer->cellSize;
+        }
+        /* No else: the ringBuffer is not full */
+
+        buffer = ringBuffer->dataBuffer + ( ringBuffer->indexInput % (ringBuffer->numberOfCell * ringBuffer->cellSize) );
+
+        ringBuffer->indexInput += ringBuffer->cellSize;
+        ARNETWORK_RingBuffer_NormalizeIndexes(ringBuffer);
+    }
+    /* No else: the ringBuffer is full */
+
+    return buffer;
+}
+
 /*****************************************
  *
  *             implementation :
@@ -94,19 +119,26 @@ ARNETWORK_RingBuffer_t* ARNETWORK_RingBuffer_New(unsigned int numberOfCell, unsi
 ARNETWORK_RingBuffer_t* ARNETWORK_RingBuffer_NewWithOverwriting(unsigned int numberOfCell, unsigned int cellSize, int isOverwriting)
 {
     /* -- Create a new ring buffer -- */
+    return ARNETWORK_RingBuffer_NewInArena( NULL, numberOfCell, cellSize, isOverwriting );
+}
+
+ARNETWORK_RingBuffer_t* ARNETWORK_RingBuffer_NewInArena(ARNETWORK_Arena_t *arenaPtr, unsigned int numberOfCell, unsigned int cellSize, int isOverwriting)
+{
+    /* -- Create a new ring buffer in an arena -- */
 
     /* local declarations */
-    ARNETWORK_RingBuffer_t* ringBuffer =  malloc( sizeof(ARNETWORK_RingBuffer_t) );
+    ARNETWORK_RingBuffer_t* ringBuffer =  ARNETWORK_Arena_Malloc( arenaPtr, sizeof(ARNETWORK_RingBuffer_t) );
 
     if(ringBuffer)
     {
+        ringBuffer->arenaPtr = arenaPtr;
         ringBuffer->numberOfCell = numberOfCell;
         ringBuffer->cellSize = cellSize;
         ringBuffer->indexInput = 0;
         ringBuffer->indexOutput = 0;
         ringBuffer->isOverwriting = isOverwriting;
         ARSAL_Mutex_Init( &(ringBuffer->mutex) );
-        ringBuffer->dataBuffer = malloc( cellSize * numberOfCell );
+        ringBuffer->dataBuffer = ARNETWORK_Arena_Malloc( arenaPtr, cellSize * numberOfCell );
 
         if( ringBuffer->dataBuffer == NULL)
         {
@@ -129,10 +161,10 @@ void ARNETWORK_RingBuffer_Delete(ARNETWORK_RingBuffer_t **ringBuffer)
         if((*ringBuffer) != NULL)
         {
             ARSAL_Mutex_Destroy(&((*ringBuffer)->mutex));
-            free((*ringBuffer)->dataBuffer);
+            ARNETWORK_Arena_Free((*ringBuffer)->arenaPtr, (*ringBuffer)->dataBuffer);
             (*ringBuffer)->dataBuffer = NULL;
 
-            free(*ringBuffer);
+            ARNETWORK_Arena_Free((*ringBuffer)->arenaPtr, *ringBuffer);
             (*ringBuffer) = NULL;
         }
         /* No else: No ringBuffer to delete */
@@ -140,6 +172,12 @@ void ARNETWORK_RingBuffer_Delete(ARNETWORK_RingBuffer_t **ringBuffer)
     /* No else: Parameters check (stops the processing) */
 }
 
+size_t ARNETWORK_RingBuffer_GetArenaSize(unsigned int numberOfCell, unsigned int cellSize)
+{
+    /* -- Get the size taken in an arena by a ring buffer -- */
+    return ARNETWORK_Arena_GetAllocationSize( sizeof(ARNETWORK_RingBuffer_t) ) + ARNETWORK_Arena_GetAllocationSize( cellSize * numberOfCell );
+}
+
 eARNETWORK_ERROR ARNETWORK_RingBuffer_PushBack(ARNETWORK_RingBuffer_t *ringBuffer, const uint8_t *newData) //inline ?
 {
     /* -- Add the new data at the back of the ring buffer -- */
@@ -157,18 +195,51 @@ eARNETWORK_ERROR ARNETWORK_RingBuffer_PushBackWithSize(ARNETWORK_RingBuffer_t *r
 
     ARSAL_Mutex_Lock(&(ringBuffer->mutex));
 
-    /* check if the has enough free cell or the buffer is overwriting */
-    if ((ARNETWORK_RingBuffer_GetFreeCellNumber(ringBuffer)) || (ringBuffer->isOverwriting))
+    buffer = ARNETWORK_RingBuffer_PushBackCell(ringBuffer);
+
+    if (buffer != NULL)
     {
-        if (!ARNETWORK_RingBuffer_GetFreeCellNumber(ringBuffer))
+        memcpy(buffer, newData, dataSize);
+
+        /* return the pointer on the data copy in the ring buffer */
+        if(dataCopy != NULL)
         {
-            (ringBuffer->indexOutput) += ringBuffer->cellSize;
+            *dataCopy = buffer;
         }
-        /* No else: the ringBuffer is not full */
+        /* No else: data are not returned */
+    }
+    else
+    {
+        error = ARNETWORK_ERROR_BUFFER_SIZE;
+    }
 
-        buffer = ringBuffer->dataBuffer + ( ringBuffer->indexInput % (ringBuffer->numberOfCell * ringBuffer->cellSize) );
+    ARSAL_Mutex_Unlock(&(ringBuffer->mutex));
 
-        memcpy(buffer, newData, dataSize);
+    return error;
+}
+
+eARNETWORK_ERROR ARNETWORK_RingBuffer_PushBackV(ARNETWORK_RingBuffer_t *ringBuffer, const struct iovec *iov, int iovcnt, uint8_t **dataCopy)
+{
+    /* -- Add the new data gathered from several pieces at the back of the ring buffer -- */
+
+    /* local declarations */
+    int error = ARNETWORK_OK;
+    uint8_t* buffer = NULL;
+    int dataSize = 0;
+    int iovIndex = 0;
+
+    ARSAL_Mutex_Lock(&(ringBuffer->mutex));
+
+    buffer = ARNETWORK_RingBuffer_PushBackCell(ringBuffer);
+
+    if (buffer != NULL)
+    {
+        /* gather the pieces directly in the cell */
+        for (iovIndex = 0; iovIndex < iovcnt; iovIndex++)
+        {
+            memcpy(buffer + dataSize, iov[iovIndex].iov_base, iov[iovIndex].iov_len);
+            dataSize += iov[iovIndex].iov_len;
+        }
 
         /* return the pointer on the data copy in the ring buffer */
         if(dataCopy != NULL)
@@ -176,9 +247,6 @@ eARNETWORK_ERROR ARNETWORK_RingBuffer_PushBackWithSize(ARNETWORK_RingBuffer_t *r
             *dataCopy = buffer;
         }
         /* No else: data are not returned */
-
-        ringBuffer->indexInput += ringBuffer->cellSize;
-        ARNETWORK_RingBuffer_NormalizeIndexes(ringBuffer);
     }
     else
     {
@@ -229,6 +297,39 @@ eARNETWORK_ERROR ARNETWORK_RingBuffer_PopFrontWithSize(ARNETWORK_RingBuffer_t *r
     return error;
 }
 
+eARNETWORK_ERROR ARNETWORK_RingBuffer_PopBack(ARNETWORK_RingBuffer_t *ringBuffer, uint8_t *dataPop)
+{
+    /* -- Pop the newest data -- */
+
+    /* local declarations */
+    uint8_t *buffer = NULL;
+    eARNETWORK_ERROR error = ARNETWORK_OK;
+
+    ARSAL_Mutex_Lock(&(ringBuffer->mutex));
+
+    if (!ARNETWORK_RingBuffer_IsEmpty(ringBuffer))
+    {
+        /* the input index is always after the output index, so it can go back of one cell */
+        (ringBuffer->indexInput) -= ringBuffer->cellSize;
+
+        if(dataPop != NULL)
+        {
+            /* get the address of the back data */
+            buffer = ringBuffer->dataBuffer + (ringBuffer->indexInput % (ringBuffer->numberOfCell * ringBuffer->cellSize));
+            memcpy(dataPop, buffer, ringBuffer->cellSize);
+        }
+        /* No else: the data popped is not returned  */
+    }
+    else
+    {
+        error = ARNETWORK_ERROR_BUFFER_EMPTY;
+    }
+
+    ARSAL_Mutex_Unlock(&(ringBuffer->mutex));
+
+    return error;
+}
+
 eARNETWORK_ERROR ARNETWORK_RingBuffer_Front(ARNETWORK_RingBuffer_t *ringBuffer, uint8_t *frontData)
 {
     /* -- Return a pointer on the front data -- */
@@ -256,6 +357,32 @@ eARNETWORK_ERROR ARNETWORK_RingBuffer_Front(ARNETWORK_RingBuffer_t *ringBuffer,
     return error;
 }
 
+eARNETWORK_ERROR ARNETWORK_RingBuffer_Get(ARNETWORK_RingBuffer_t *ringBuffer, int index, uint8_t *data)
+{
+    /* -- Return a copy of a data of the ring buffer -- */
+
+    /* local declarations */
+    eARNETWORK_ERROR error = ARNETWORK_OK;
+    uint8_t *buffer = NULL;
+
+    ARSAL_Mutex_Lock(&(ringBuffer->mutex));
+
+    if ((index >= 0) && (index < ARNETWORK_RingBuffer_GetNumberOfData(ringBuffer)))
+    {
+        /* get the address of the data */
+        buffer = ringBuffer->dataBuffer + ((ringBuffer->indexOutput + (index * ringBuffer->cellSize)) % (ringBuffer->numberOfCell * ringBuffer->cellSize));
+        memcpy(data, buffer, ringBuffer->cellSize);
+    }
+    else
+    {
+        error = ARNETWORK_ERROR_BUFFER_EMPTY;
+    }
+
+    ARSAL_Mutex_Unlock(&(ringBuffer->mutex));
+
+    return error;
+}
+
 void ARNETWORK_RingBuffer_Print(ARNETWORK_RingBuffer_t *ringBuffer)
 {
     /* -- Print the state of the ring buffer -- */
@@ -40,6 +40,8 @@
 
 #include <libARSAL/ARSAL_Mutex.h>
 #include <inttypes.h>
+#include <sys/uio.h>
+#include "ARNETWORK_Arena.h"
 
 /**
  * @brief Basic ring buffer, multithread safe
@@ -58,6 +60,8 @@ typedef struct
     
     ARSAL_Mutex_t mutex; /**< Mutex to take before to use the ringBuffer*/
 
+    ARNETWORK_Arena_t *arenaPtr; /**< Arena in which the ring buffer is allocated ; NULL if allocated by malloc() */
+
 }ARNETWORK_RingBuffer_t;
 
 /**
@@ -85,6 +89,29 @@ ARNETWORK_RingBuffer_t* ARNETWORK_RingBuffer_New(unsigned int numberOfCell, unsi
 **/
 ARNETWORK_RingBuffer_t* ARNETWORK_RingBuffer_NewWithOverwriting(unsigned int numberOfCell, unsigned int cellSize, int isOverwriting); 
 
+/**
+ * @brief Create a new ring buffer in an arena.
+ * @warning This function allocate memory
+ * @post ARNETWORK_RingBuffer_Delete() must be called to delete the ring buffer ; the memory of the arena is freed by the deletion of the arena
+ * @param arenaPtr arena in which the ring buffer is allocated ; NULL to allocate it by malloc()
+ * @param[in] numberOfCell Maximum number of data cell of the ring buffer
+ * @param[in] cellSize size of one data cell of the ring buffer
+ * @param[in] isOverwriting set to 1 allow the overwriting if the buffer is full otherwise set 0
+ * @return Pointer on the new ring buffer
+ * @see ARNETWORK_RingBuffer_GetArenaSize()
+ * @see ARNETWORK_RingBuffer_Delete()
+**/
+ARNETWORK_RingBuffer_t* ARNETWORK_RingBuffer_NewInArena(ARNETWORK_Arena_t *arenaPtr, unsigned int numberOfCell, unsigned int cellSize, int isOverwriting);
+
+/**
+ * @brief Get the size taken in an arena by a ring buffer
+ * @param[in] numberOfCell Maximum number of data cell of the ring buffer
+ * @param[in] cellSize size of one data cell of the ring buffer
+ * @return size in byte
+ * @see ARNETWORK_RingBuffer_NewInArena()
+**/
+size_t ARNETWORK_RingBuffer_GetArenaSize(unsigned int numberOfCell, unsigned int cellSize);
+
 /**
  * @brief Delete the ring buffer
  * @warning This function free memory
@@ -116,6 +143,19 @@ eARNETWORK_ERROR ARNETWORK_RingBuffer_PushBack(ARNETWORK_RingBuffer_t *ringBuffe
 **/
 eARNETWORK_ERROR ARNETWORK_RingBuffer_PushBackWithSize(ARNETWORK_RingBuffer_t *ringBuffer, const uint8_t *newData, int dataSize, uint8_t **dataCopy);
 
+/**
+ * @brief Add the new data, gathered from several pieces, at the back of the ring buffer
+ * @warning the pieces must be different of NULL
+ * @warning the total size of the pieces must not be more than ring buffer's cell size
+ * @note the pieces are copied one after the other in the cell, without intermediate copy
+ * @param ringBuffer the ring buffer which will push back
+ * @param[in] iov array of the pieces of the data to add
+ * @param[in] iovcnt number of pieces
+ * @param[out] dataCopy address to return the pointer on the data copy in the ring buffer ; can be equal to NULL
+ * @return error eARNETWORK_ERROR
+**/
+eARNETWORK_ERROR ARNETWORK_RingBuffer_PushBackV(ARNETWORK_RingBuffer_t *ringBuffer, const struct iovec *iov, int iovcnt, uint8_t **dataCopy);
+
 /**
  * @brief Pop the oldest data
  * @param ringBuffer the ring buffer which will pop front
@@ -135,6 +175,14 @@ eARNETWORK_ERROR ARNETWORK_RingBuffer_PopFront(ARNETWORK_RingBuffer_t *ringBuffe
 **/
 eARNETWORK_ERROR ARNETWORK_RingBuffer_PopFrontWithSize(ARNETWORK_RingBuffer_t *ringBuffer, uint8_t *dataPop, int dataSize);
 
+/**
+ * @brief Pop the newest data
+ * @param ringBuffer the ring buffer which will pop back
+ * @param[out] dataPop pointer on the data popped ; can be equal to NULL
+ * @return error eARNETWORK_ERROR
+**/
+eARNETWORK_ERROR ARNETWORK_RingBuffer_PopBack(ARNETWORK_RingBuffer_t *ringBuffer, uint8_t *dataPop);
+
 /**
  * @brief Return the number of free cell of the ring buffer
  * @param ringBuffer the ring buffer which will give the number of its free cells
@@ -145,6 +193,16 @@ static inline int ARNETWORK_RingBuffer_GetFreeCellNumber(const ARNETWORK_RingBuf
     return ringBuffer->numberOfCell - ( (ringBuffer->indexInput - ringBuffer->indexOutput) / ringBuffer->cellSize );
 }
 
+/**
+ * @brief Return the number of data stored in the ring buffer
+ * @param ringBuffer the ring buffer which will give its number of data
+ * @return number of data stored in the ring buffer
+**/
+static inline int ARNETWORK_RingBuffer_GetNumberOfData(const ARNETWORK_RingBuffer_t *ringBuffer)
+{
+    return (ringBuffer->indexInput - ringBuffer->indexOutput) / ringBuffer->cellSize;
+}
+
 /**
  * @brief Check if the ring buffer is empty
  * @param ringBuffer the ring buffer which will check if it is empty
@@ -163,6 +221,15 @@ static inline int ARNETWORK_RingBuffer_IsEmpty(const ARNETWORK_RingBuffer_t *rin
 **/
 eARNETWORK_ERROR ARNETWORK_RingBuffer_Front(ARNETWORK_RingBuffer_t *ringBuffer, uint8_t *frontData);
 
+/**
+ * @brief Return a copy of a data of the ring buffer
+ * @param ringBuffer the ring buffer which will give the data
+ * @param[in] index index of the data, 0 is the front data
+ * @param[out] data the data
+ * @return error eARNETWORK_ERROR ; ARNETWORK_ERROR_BUFFER_EMPTY if the index is negative or if the ring buffer doesn't store so many data
+**/
+eARNETWORK_ERROR ARNETWORK_RingBuffer_Get(ARNETWORK_RingBuffer_t *ringBuffer, int index, uint8_t *data);
+
 /**
  * @brief Clean the ring buffer
  * @param ringBuffer the ring buffer to clean
@@ -41,6 +41,11 @@
  *
  *****************************************/
 
+#if defined(__linux__) && !defined(_GNU_SOURCE)
+/* ppoll() */
+#define _GNU_SOURCE
+#endif
+
 #include <stdlib.h>
 
 #include <stddef.h>
@@ -49,6 +54,9 @@
 
 #include <unistd.h>
 #include <string.h>
+#include <time.h>
+#include <sched.h>
+#include <poll.h>
 
 #include <libARSAL/ARSAL_Print.h>
 #include <libARSAL/ARSAL_Socket.h>
@@ -70,7 +78,12 @@
  *****************************************/
 
 #define ARNETWORK_SENDER_TAG "ARNETWORK_Sender"
-#define ARNETWORK_SENDER_MILLISECOND 1
+#define ARNETWORK_SENDER_MINIMUM_TIME_BETWEEN_SENDS_US_DEFAULT (1000)
+#define ARNETWORK_SENDER_MAXIMUM_WAIT_TIME_US (500000)
+#define ARNETWORK_SENDER_NANOSECONDS_PER_MICROSECOND (1000)
+#define ARNETWORK_SENDER_MICROSECONDS_PER_SECOND (1000000)
+#define ARNETWORK_SENDER_NANOSECONDS_PER_SECOND (1000000000)
+#define ARNETWORK_SENDER_MAXIMUM_SPIN_TIME_US_DEFAULT (50)
 
 /*****************************************
  *
@@ -83,12 +96,43 @@
  * @param senderPtr the pointer on the Sender
  * @param inputBufferPtr Pointer on the input buffer
  * @param isRetry Don't increment sequence number for retries
- * @return error eARNETWORK_ERROR
+ * @return error eARNETWORK_ERROR ; ARNETWORK_ERROR_BUFFER_SIZE if the network buffer is full and the data must be sent later
  * @note only call by ARNETWORK_Sender_ThreadRun()
  * @see ARNETWORK_Sender_ThreadRun()
  */
 eARNETWORK_ERROR ARNETWORK_Sender_AddToBuffer (ARNETWORK_Sender_t *senderPtr, ARNETWORK_IOBuffer_t *inputBufferPtr, int isRetry);
 
+/**
+ * @brief send the fragments of the messages of a fragmenting input buffer: the new fragments in the window of the fragments not acknowledged, and the retries of the fragments not acknowledged at the timeout
+ * @param senderPtr the pointer on the Sender
+ * @param buffer Pointer on the input buffer, locked
+ * @param[in] hasWaitedUs time elapsed since the last processing, in microsecond
+ * @note only call by ARNETWORK_Sender_ProcessBufferToSend()
+ */
+void ARNETWORK_Sender_ProcessFragmentsToSend (ARNETWORK_Sender_t *senderPtr, ARNETWORK_IOBuffer_t *buffer, int hasWaitedUs);
+
+/**
+ * @brief add a fragment of the message being sent to the sender buffer ; callback with sent status once the last fragment is sent
+ * @param senderPtr the pointer on the Sender
+ * @param inputBufferPtr Pointer on the input buffer
+ * @param[in] fragmentIndex index of the fragment in the message
+ * @param[in] isRetry 1 to send again the fragment with its sequence number, otherwise 0
+ * @return error eARNETWORK_ERROR ; ARNETWORK_ERROR_BUFFER_SIZE if the network buffer is full and the fragment must be sent later
+ * @note only call by ARNETWORK_Sender_ProcessFragmentsToSend()
+ */
+eARNETWORK_ERROR ARNETWORK_Sender_AddFragmentToBuffer (ARNETWORK_Sender_t *senderPtr, ARNETWORK_IOBuffer_t *inputBufferPtr, int fragmentIndex, int isRetry);
+
+/**
+ * @brief get the size of the fragments sent: the largest data of a frame, except the fragment header
+ * @param senderPtr the pointer on the Sender
+ * @return size of the fragments, in byte
+ */
+static inline int ARNETWORK_Sender_GetFragmentSize (ARNETWORK_Sender_t *senderPtr)
+{
+    int fragmentSize = senderPtr->aggregationBufferSize - ARNETWORK_IOBUFFER_FRAGMENT_HEADER_SIZE;
+    return (fragmentSize < ARNETWORK_IOBUFFER_FRAGMENT_SIZE_MAX) ? fragmentSize : ARNETWORK_IOBUFFER_FRAGMENT_SIZE_MAX;
+}
+
 /**
  * @brief call the Callback this timeout status
  * @param senderPtr the pointer on the Sender
@@ -104,6 +148,7 @@ eARNETWORK_MANAGER_CALLBACK_RETURN ARNETWORK_Sender_TimeOutCallback (ARNETWORK_S
  * @param senderPtr the pointer on the Sender
  * @param[in] inputBufferPtr Pointer on the input buffer
  * @param[in] callbackReturn return of the callback
+ * @warning the IOBuffer mutex of inputBufferPtr must be locked by the caller
  * @note only call by ARNETWORK_Sender_ThreadRun()
  * @see ARNETWORK_Sender_ThreadRun()
  */
@@ -111,6 +156,65 @@ void ARNETWORK_Sender_ManageTimeOut (ARNETWORK_Sender_t *senderPtr, ARNETWORK_IO
 
 
 
+/**
+ * @brief compute the time, in microsecond, between two timestamps of the monotonic clock
+ * @param[in] start the first timestamp
+ * @param[in] end the second timestamp
+ * @return the time elapsed from start to end, in microsecond
+ */
+int ARNETWORK_Sender_ComputeTimespecUsTimeDiff (const struct timespec *start, const struct timespec *end);
+
+/**
+ * @brief wait the next sending, or a signal of new data
+ * @details with the spin then block strategy, the sender first yields the CPU in a loop, until a new data is notified or the spin time is elapsed.
+ * The sender then polls the nextSendNotifier until an absolute deadline of the monotonic clock: the wait has a microsecond resolution on Linux,
+ * a millisecond one rounded up on the other systems, and it ends at the first signal of the notifier.
+ * @param senderPtr the pointer on the Sender
+ * @param[in] waitTimeUs time to wait, in microsecond
+ * @note only call by ARNETWORK_Sender_ThreadRun()
+ */
+void ARNETWORK_Sender_Wait (ARNETWORK_Sender_t *senderPtr, int waitTimeUs);
+
+/**
+ * @brief pack the pending acknowledgments in one coalesced frame, queued in the internal buffer of the coalesced acknowledgments
+ * @warning the delayedAckMutex must be locked by the caller
+ * @param senderPtr the pointer on the Sender
+ * @return 1 if the frame is queued, otherwise 0
+ */
+int ARNETWORK_Sender_SendDelayedAcks (ARNETWORK_Sender_t *senderPtr);
+
+/**
+ * @brief get the time to wait before an input buffer can send its next data
+ * @warning the IOBuffer mutex must be locked by the caller
+ * @param buffer the input buffer
+ * @return time to wait, in microsecond ; the probe time of a buffer without credit
+ */
+int ARNETWORK_Sender_GetSendWaitTimeUs (ARNETWORK_IOBuffer_t *buffer);
+
+/**
+ * @brief write the credits of the output buffers controlled by credits, and keep them as advertised
+ * @param senderPtr the pointer on the Sender
+ * @param[out] data buffer of networkALManager->maxIds * ARNETWORK_SENDER_CREDITS_SIZE bytes at least
+ * @return size of the credits written
+ */
+int ARNETWORK_Sender_WriteCredits (ARNETWORK_Sender_t *senderPtr, uint8_t *data);
+
+/**
+ * @brief check if the peer must be told the credits of the output buffers
+ * @details the credits of an output buffer are advertised at the start, then again once the peer has used all its credits and half of the buffer is free
+ * @param senderPtr the pointer on the Sender
+ * @param[out] isWaitingCredits 1 if the peer of an output buffer has no credit, otherwise 0
+ * @return 1 if the credits must be advertised, otherwise 0
+ */
+int ARNETWORK_Sender_IsCreditUpdateNeeded (ARNETWORK_Sender_t *senderPtr, int *isWaitingCredits);
+
+/**
+ * @brief queue a pong frame with the credits of the output buffers
+ * @param senderPtr the pointer on the Sender
+ * @param[in] pingTime timestamp of the ping replied ; zero for an advertisement of credits alone
+ */
+void ARNETWORK_Sender_SendCredits (ARNETWORK_Sender_t *senderPtr, const struct timespec *pingTime);
+
 void ARNETWORK_Sender_ManageIOBufferIsInRemovingStatus(ARNETWORK_IOBuffer_t *inputBufferPtr, eARNETWORK_MANAGER_CALLBACK_STATUS callbackStatus);
 
 /*****************************************
@@ -132,6 +236,17 @@ ARNETWORK_Sender_t* ARNETWORK_Sender_New (ARNETWORKAL_Manager_t *networkALManage
 
     if (senderPtr)
     {
+        senderPtr->aggregationBuffer = NULL;
+        senderPtr->congestionControl = NULL;
+        senderPtr->tracePtr = NULL;
+        senderPtr->pendingAckSeqArr = NULL;
+        senderPtr->coalescedAckData = NULL;
+        senderPtr->outputBufferPtrArr = NULL;
+        senderPtr->numberOfOutputBuff = 0;
+        senderPtr->pingData = NULL;
+        senderPtr->pongData = NULL;
+        senderPtr->nextSendNotifier = NULL;
+
         if(networkALManager != NULL)
         {
             senderPtr->networkALManager = networkALManager;
@@ -149,8 +264,18 @@ ARNETWORK_Sender_t* ARNETWORK_Sender_New (ARNETWORKAL_Manager_t *networkALManage
             senderPtr->numberOfInternalInputBuff = numberOfInternalInputBuffer;
             senderPtr->internalInputBufferPtrArr = internalInputBufferPtrArr;
             senderPtr->inputBufferPtrMap = inputBufferPtrMap;
-            senderPtr->minimumTimeBetweenSendsMs = ARNETWORK_SENDER_MILLISECOND;
+            senderPtr->minimumTimeBetweenSendsUs = ARNETWORK_SENDER_MINIMUM_TIME_BETWEEN_SENDS_US_DEFAULT;
+            senderPtr->waitStrategy = ARNETWORK_MANAGER_SENDER_WAIT_STRATEGY_BLOCK;
+            senderPtr->maxSpinTimeUs = ARNETWORK_SENDER_MAXIMUM_SPIN_TIME_US_DEFAULT;
+            senderPtr->spinTimeUs = ARNETWORK_SENDER_MAXIMUM_SPIN_TIME_US_DEFAULT;
+            senderPtr->isSpinning = 0;
+            senderPtr->hasNewData = 0;
+            senderPtr->isLowLatencyDirectSend = 0;
+            senderPtr->maxNumberOfDelayedAcks = 0;
+            senderPtr->maxAckDelayUs = 0;
+            senderPtr->numberOfPendingAcks = 0;
             senderPtr->isPingRunning = 0;
+            senderPtr->lastPingValue = -1;
             if (pingDelayMs == 0)
             {
                 senderPtr->minTimeBetweenPings = ARNETWORK_SENDER_MINIMUM_TIME_BETWEEN_PINGS_MS;
@@ -160,23 +285,91 @@ ARNETWORK_Sender_t* ARNETWORK_Sender_New (ARNETWORKAL_Manager_t *networkALManage
                 senderPtr->minTimeBetweenPings = pingDelayMs;
             }
             ARSAL_Time_GetTime(&(senderPtr->pingStartTime));
+            ARSAL_Time_GetTime(&(senderPtr->lastProcessTime));
+            senderPtr->wakeUpCallback = NULL;
+            senderPtr->wakeUpCustomData = NULL;
+        }
+
+        /* Create the aggregation buffer, sized for the largest frame payload */
+        if (error == ARNETWORK_OK)
+        {
+            senderPtr->aggregationBufferSize = networkALManager->maxBufferSize - offsetof (ARNETWORKAL_Frame_t, dataPtr);
+            senderPtr->aggregationBuffer = malloc (networkALManager->maxBufferSize);
+            if (senderPtr->aggregationBuffer == NULL)
+            {
+                error = ARNETWORK_ERROR_ALLOC;
+            }
+        }
+
+        /* Create the table of the delayed acknowledgments, by identifier of buffer, and the buffer packing them */
+        if (error == ARNETWORK_OK)
+        {
+            senderPtr->pendingAckSeqArr = malloc (networkALManager->maxIds * sizeof (int));
+            senderPtr->coalescedAckData = malloc (networkALManager->maxIds * ARNETWORK_SENDER_COALESCED_ACK_SIZE);
+            if ((senderPtr->pendingAckSeqArr == NULL) || (senderPtr->coalescedAckData == NULL))
+            {
+                error = ARNETWORK_ERROR_ALLOC;
+            }
+            else
+            {
+                memset (senderPtr->pendingAckSeqArr, -1, networkALManager->maxIds * sizeof (int));
+            }
+        }
+
+        /* Create the buffers of the ping frames : timestamp, then credits of the output buffers */
+        if (error == ARNETWORK_OK)
+        {
+            senderPtr->pingData = malloc (sizeof (struct timespec) + networkALManager->maxIds * ARNETWORK_SENDER_CREDITS_SIZE);
+            senderPtr->pongData = malloc (sizeof (struct timespec) + networkALManager->maxIds * ARNETWORK_SENDER_CREDITS_SIZE);
+            if ((senderPtr->pingData == NULL) || (senderPtr->pongData == NULL))
+            {
+                error = ARNETWORK_ERROR_ALLOC;
+            }
+        }
+
+        /* Create the congestion control (disabled by default) */
+        if (error == ARNETWORK_OK)
+        {
+            senderPtr->congestionControl = ARNETWORK_CongestionControl_New ();
+            if (senderPtr->congestionControl == NULL)
+            {
+                error = ARNETWORK_ERROR_ALLOC;
+            }
+        }
+
+        /* Create the notifier waited between two sends */
+        if (error == ARNETWORK_OK)
+        {
+            senderPtr->nextSendNotifier = ARNETWORK_Notifier_New (&error);
         }
 
-        /* Create the mutex/condition */
+        /* Create the mutexes */
         if ( (error == ARNETWORK_OK) &&
-             (ARSAL_Mutex_Init (&(senderPtr->nextSendMutex)) != 0))
+             (ARSAL_Mutex_Init (&(senderPtr->pingMutex)) != 0))
         {
             error = ARNETWORK_ERROR_NEW_BUFFER;
         }
 
         if ( (error == ARNETWORK_OK) &&
-             (ARSAL_Cond_Init (&(senderPtr->nextSendCond)) != 0))
+             (ARSAL_Mutex_Init (&(senderPtr->sendMutex)) != 0))
         {
             error = ARNETWORK_ERROR_NEW_BUFFER;
         }
 
         if ( (error == ARNETWORK_OK) &&
-             (ARSAL_Mutex_Init (&(senderPtr->pingMutex)) != 0))
+             (ARSAL_Mutex_Init (&(senderPtr->delayedAckMutex)) != 0))
+        {
+            error = ARNETWORK_ERROR_NEW_BUFFER;
+        }
+
+        if ( (error == ARNETWORK_OK) &&
+             (ARSAL_Mutex_Init (&(senderPtr->buffersMutex)) != 0))
+        {
+            error = ARNETWORK_ERROR_NEW_BUFFER;
+        }
+
+        if ( (error == ARNETWORK_OK) &&
+             (ARSAL_Mutex_Init (&(senderPtr->wakeUpMutex)) != 0))
         {
             error = ARNETWORK_ERROR_NEW_BUFFER;
         }
@@ -205,9 +398,18 @@ void ARNETWORK_Sender_Delete (ARNETWORK_Sender_t **senderPtrAddr)
 
         if (senderPtr != NULL)
         {
-            ARSAL_Cond_Destroy (&(senderPtr->nextSendCond));
-            ARSAL_Mutex_Destroy (&(senderPtr->nextSendMutex));
+            ARNETWORK_Notifier_Delete (&(senderPtr->nextSendNotifier));
             ARSAL_Mutex_Destroy (&(senderPtr->pingMutex));
+            ARSAL_Mutex_Destroy (&(senderPtr->sendMutex));
+            ARSAL_Mutex_Destroy (&(senderPtr->delayedAckMutex));
+            ARSAL_Mutex_Destroy (&(senderPtr->buffersMutex));
+            ARSAL_Mutex_Destroy (&(senderPtr->wakeUpMutex));
+            ARNETWORK_CongestionControl_Delete (&(senderPtr->congestionControl));
+            free (senderPtr->aggregationBuffer);
+            free (senderPtr->pendingAckSeqArr);
+            free (senderPtr->coalescedAckData);
+            free (senderPtr->pingData);
+            free (senderPtr->pongData);
 
             free (senderPtr);
             senderPtr = NULL;
@@ -222,168 +424,293 @@ void* ARNETWORK_Sender_ThreadRun (void* data)
 
     /** local declarations */
     ARNETWORK_Sender_t *senderPtr = data;
+    int waitTimeUs = 0;
+
+    ARSAL_Time_GetTime(&(senderPtr->lastProcessTime));
+
+    while (senderPtr->isAlive)
+    {
+        waitTimeUs = ARNETWORK_Sender_GetWaitTimeUs (senderPtr);
+        if (waitTimeUs > 0)
+        {
+            ARNETWORK_Sender_Wait (senderPtr, waitTimeUs);
+        }
+
+        ARNETWORK_Sender_Process (senderPtr);
+    }
+
+    return NULL;
+}
+
+int ARNETWORK_Sender_GetWaitTimeUs (ARNETWORK_Sender_t *senderPtr)
+{
+    /** -- Compute the time to wait before the next processing of the input buffers -- */
+
+    /** local declarations */
     int inputBufferIndex = 0;
     ARNETWORK_IOBuffer_t *inputBufferPtrTemp = NULL; /**< pointer of the input buffer in processing */
     eARNETWORK_ERROR error = ARNETWORK_OK;
-    int waitTimeMs = 0;
+    int waitTimeUs = 0;
     struct timespec now;
-    struct timespec sleepStart;
-    int sleepDurationMs = 0;
-    int timeDiffMs;
+    int throttleWaitTimeUs = 0;
+    int candidateWaitTimeUs = 0;
+    int ackWaitTimeUs = 0;
+    int isCreditUpdateNeeded = 0;
+    int isWaitingCredits = 0;
 
-    while (senderPtr->isAlive)
+    waitTimeUs = ARNETWORK_SENDER_MAXIMUM_WAIT_TIME_US;
+
+    /* The buffers can not be added or removed during the computation */
+    ARSAL_Mutex_Lock (&(senderPtr->buffersMutex));
+
+    /* The delayed acknowledgments must be sent at the end of their delay */
+    ARSAL_Mutex_Lock (&(senderPtr->delayedAckMutex));
+    if (senderPtr->numberOfPendingAcks > 0)
+    {
+        ARSAL_Time_GetTime(&now);
+        ackWaitTimeUs = senderPtr->maxAckDelayUs - ARNETWORK_Sender_ComputeTimespecUsTimeDiff (&(senderPtr->firstPendingAckTime), &now);
+        if (ackWaitTimeUs < waitTimeUs)
+        {
+            waitTimeUs = (ackWaitTimeUs > 0) ? ackWaitTimeUs : 0;
+        }
+    }
+    ARSAL_Mutex_Unlock (&(senderPtr->delayedAckMutex));
+
+    /* The peer without credit is told the new credits of the output buffers as soon as they are read */
+    isCreditUpdateNeeded = ARNETWORK_Sender_IsCreditUpdateNeeded (senderPtr, &isWaitingCredits);
+    if ((isCreditUpdateNeeded) || ((isWaitingCredits) && (ARNETWORK_SENDER_CREDIT_UPDATE_TIME_US < waitTimeUs)))
     {
-        waitTimeMs = 500;
-        for (inputBufferIndex = 0; inputBufferIndex < senderPtr->numberOfInputBuff && waitTimeMs > 0; ++inputBufferIndex)
+        waitTimeUs = (isCreditUpdateNeeded) ? 0 : ARNETWORK_SENDER_CREDIT_UPDATE_TIME_US;
+    }
+
+    /* Throttled buffers can not be sent before the congestion window is refilled */
+    throttleWaitTimeUs = ARNETWORK_CongestionControl_GetWaitTimeMs (senderPtr->congestionControl) * ARNETWORK_IOBUFFER_MICROSECONDS_PER_MILLISECOND;
+    for (inputBufferIndex = 0; inputBufferIndex < senderPtr->numberOfInputBuff && waitTimeUs > 0; ++inputBufferIndex)
+    {
+        inputBufferPtrTemp = senderPtr->inputBufferPtrArr[inputBufferIndex];
+        error = ARNETWORK_IOBuffer_Lock(inputBufferPtrTemp);
+        switch (inputBufferPtrTemp->dataType)
         {
-            inputBufferPtrTemp = senderPtr->inputBufferPtrArr[inputBufferIndex];
-            error = ARNETWORK_IOBuffer_Lock(inputBufferPtrTemp);
-            switch (inputBufferPtrTemp->dataType)
+            // Low latency : no wait if any data available, except the time before next send
+        case ARNETWORKAL_FRAME_TYPE_DATA_LOW_LATENCY:
+            if ((error == ARNETWORK_OK) &&
+                (!ARNETWORK_RingBuffer_IsEmpty (inputBufferPtrTemp->dataDescriptorRBuffer)) &&
+                (ARNETWORK_Sender_GetSendWaitTimeUs (inputBufferPtrTemp) < waitTimeUs))
             {
-                // Low latency : no wait if any data available
-            case ARNETWORKAL_FRAME_TYPE_DATA_LOW_LATENCY:
-                if ((error == ARNETWORK_OK) &&
-                    (!ARNETWORK_RingBuffer_IsEmpty (inputBufferPtrTemp->dataDescriptorRBuffer)))
-                {
-                    waitTimeMs = 0;
-                }
-                break;
-                // Acknowledged buffer :
-                //  - If waiting an ack, wait time = time before ack timeout
-                //  - If not waiting an ack and not empty, wait time = time before next send
-            case ARNETWORKAL_FRAME_TYPE_DATA_WITH_ACK:
-                if (error == ARNETWORK_OK)
+                waitTimeUs = ARNETWORK_Sender_GetSendWaitTimeUs (inputBufferPtrTemp);
+            }
+            break;
+            // Acknowledged buffer :
+            //  - If waiting an ack, wait time = time before ack timeout
+            //  - If not waiting an ack (or able to send a fragment) and not empty, wait time = time before next send
+        case ARNETWORKAL_FRAME_TYPE_DATA_WITH_ACK:
+            if (error == ARNETWORK_OK)
+            {
+                if (ARNETWORK_IOBuffer_IsWaitAck(inputBufferPtrTemp))
                 {
-                    if (ARNETWORK_IOBuffer_IsWaitAck(inputBufferPtrTemp))
-                    {
-                        if (inputBufferPtrTemp->ackWaitTimeCount < waitTimeMs)
-                        {
-                            waitTimeMs = inputBufferPtrTemp->ackWaitTimeCount;
-                        }
-                    }
-                    else if (!ARNETWORK_RingBuffer_IsEmpty (inputBufferPtrTemp->dataDescriptorRBuffer))
+                    /* A negative count is an infinite timeout */
+                    if ((inputBufferPtrTemp->ackWaitTimeCount >= 0) && (inputBufferPtrTemp->ackWaitTimeCount < waitTimeUs))
                     {
-                        if (inputBufferPtrTemp->waitTimeCount < waitTimeMs)
-                        {
-                            waitTimeMs = inputBufferPtrTemp->waitTimeCount;
-                        }
+                        waitTimeUs = inputBufferPtrTemp->ackWaitTimeCount;
                     }
                 }
-                break;
-                // All non Ack buffers
-                //  - 
-            default:
-                if ((error == ARNETWORK_OK) &&
+                if (((!ARNETWORK_IOBuffer_IsWaitAck(inputBufferPtrTemp)) || (ARNETWORK_IOBuffer_CanSendFragment (inputBufferPtrTemp))) &&
                     (!ARNETWORK_RingBuffer_IsEmpty (inputBufferPtrTemp->dataDescriptorRBuffer)))
                 {
-                    if (inputBufferPtrTemp->waitTimeCount < waitTimeMs)
+                    /* the throttle delays only this buffer, not the shorter waits of the others */
+                    candidateWaitTimeUs = ARNETWORK_Sender_GetSendWaitTimeUs (inputBufferPtrTemp);
+                    if ((candidateWaitTimeUs < throttleWaitTimeUs) && (ARNETWORK_Sender_IsThrottled (inputBufferPtrTemp)))
+                    {
+                        candidateWaitTimeUs = throttleWaitTimeUs;
+                    }
+                    if (candidateWaitTimeUs < waitTimeUs)
                     {
-                        waitTimeMs = inputBufferPtrTemp->waitTimeCount;
+                        waitTimeUs = candidateWaitTimeUs;
                     }
                 }
-                break;
             }
-            ARNETWORK_IOBuffer_Unlock(inputBufferPtrTemp);
-        }
-        ARSAL_Time_GetTime(&sleepStart);
-        if (waitTimeMs > 0)
-        {
-            if (waitTimeMs < senderPtr->minimumTimeBetweenSendsMs)
+            break;
+            // All non Ack buffers
+            //  - 
+        default:
+            if ((error == ARNETWORK_OK) &&
+                (!ARNETWORK_RingBuffer_IsEmpty (inputBufferPtrTemp->dataDescriptorRBuffer)))
             {
-                waitTimeMs = senderPtr->minimumTimeBetweenSendsMs;
+                /* the throttle delays only this buffer, not the shorter waits of the others */
+                candidateWaitTimeUs = ARNETWORK_Sender_GetSendWaitTimeUs (inputBufferPtrTemp);
+                if ((candidateWaitTimeUs < throttleWaitTimeUs) && (ARNETWORK_Sender_IsThrottled (inputBufferPtrTemp)))
+                {
+                    candidateWaitTimeUs = throttleWaitTimeUs;
+                }
+                if (candidateWaitTimeUs < waitTimeUs)
+                {
+                    waitTimeUs = candidateWaitTimeUs;
+                }
             }
-            ARSAL_Mutex_Lock (&(senderPtr->nextSendMutex));
-            ARSAL_Cond_Timedwait (&(senderPtr->nextSendCond), &(senderPtr->nextSendMutex), waitTimeMs);
-            ARSAL_Mutex_Unlock (&(senderPtr->nextSendMutex));
+            break;
         }
+        ARNETWORK_IOBuffer_Unlock(inputBufferPtrTemp);
+    }
 
-        /** Process internal input buffers */
-        ARSAL_Time_GetTime(&now);
-        sleepDurationMs = ARSAL_Time_ComputeTimespecMsTimeDiff (&sleepStart, &now);
-        ARSAL_Mutex_Lock (&(senderPtr->pingMutex));
-        timeDiffMs = ARSAL_Time_ComputeTimespecMsTimeDiff (&(senderPtr->pingStartTime), &now);
-        /* Send only new pings if ping function is active (min time > 0) */
-        if (senderPtr->minTimeBetweenPings > 0)
+    ARSAL_Mutex_Unlock (&(senderPtr->buffersMutex));
+
+    if ((waitTimeUs > 0) && (waitTimeUs < senderPtr->minimumTimeBetweenSendsUs))
+    {
+        waitTimeUs = senderPtr->minimumTimeBetweenSendsUs;
+    }
+
+    return waitTimeUs;
+}
+
+void ARNETWORK_Sender_Process (ARNETWORK_Sender_t *senderPtr)
+{
+    /** -- Process the input buffers: send the data, the pings and the acknowledgments due -- */
+
+    /** local declarations */
+    int inputBufferIndex = 0;
+    ARNETWORK_IOBuffer_t *inputBufferPtrTemp = NULL; /**< pointer of the input buffer in processing */
+    struct timespec now;
+    int elapsedTimeUs = 0;
+    int timeDiffMs;
+    int isWaitingCredits = 0;
+    int pingDataSize = 0;
+
+    /* The buffers can not be added or removed during the processing */
+    ARSAL_Mutex_Lock (&(senderPtr->buffersMutex));
+
+    /** Process internal input buffers */
+    /* The time elapsed since the last processing is counted even without wait, so the counters of the buffers always progress */
+    ARSAL_Time_GetTime(&now);
+    elapsedTimeUs = ARNETWORK_Sender_ComputeTimespecUsTimeDiff (&(senderPtr->lastProcessTime), &now);
+    senderPtr->lastProcessTime = now;
+    ARSAL_Mutex_Lock (&(senderPtr->pingMutex));
+    timeDiffMs = ARSAL_Time_ComputeTimespecMsTimeDiff (&(senderPtr->pingStartTime), &now);
+    /* Send only new pings if ping function is active (min time > 0) */
+    if (senderPtr->minTimeBetweenPings > 0)
+    {
+        int maxWaitTime = senderPtr->minTimeBetweenPings;
+        if (ARNETWORK_SENDER_PING_TIMEOUT_MS > maxWaitTime)
         {
-            int maxWaitTime = senderPtr->minTimeBetweenPings;
-            if (ARNETWORK_SENDER_PING_TIMEOUT_MS > maxWaitTime)
-            {
-                maxWaitTime = ARNETWORK_SENDER_PING_TIMEOUT_MS;
-            }
+            maxWaitTime = ARNETWORK_SENDER_PING_TIMEOUT_MS;
+        }
 
-            /* Send new ping if :
-             *  -> DT > minTimeBetweenPings AND we're not waiting for a ping
-             *  -> DT > maxWaitTime
-             */
-            if (((senderPtr->isPingRunning == 0) &&
-                 (timeDiffMs > senderPtr->minTimeBetweenPings)) ||
-                (timeDiffMs > maxWaitTime))
+        /* Send new ping if :
+         *  -> DT > minTimeBetweenPings AND we're not waiting for a ping
+         *  -> DT > maxWaitTime
+         */
+        if (((senderPtr->isPingRunning == 0) &&
+             (timeDiffMs > senderPtr->minTimeBetweenPings)) ||
+            (timeDiffMs > maxWaitTime))
+        {
+            if (timeDiffMs > ARNETWORK_SENDER_PING_TIMEOUT_MS)
             {
-                if (timeDiffMs > ARNETWORK_SENDER_PING_TIMEOUT_MS)
-                {
-                    senderPtr->lastPingValue = -1;
-                }
-                inputBufferPtrTemp = senderPtr->inputBufferPtrMap[ARNETWORK_MANAGER_INTERNAL_BUFFER_ID_PING];
-                ARNETWORK_IOBuffer_Lock (inputBufferPtrTemp);
-                ARNETWORK_IOBuffer_AddData (inputBufferPtrTemp, (uint8_t *)&now, sizeof (now), NULL, NULL, 1);
-                ARNETWORK_IOBuffer_Unlock (inputBufferPtrTemp);
-                senderPtr->pingStartTime.tv_sec = now.tv_sec;
-                senderPtr->pingStartTime.tv_nsec = now.tv_nsec;
-                senderPtr->isPingRunning = 1;
+                senderPtr->lastPingValue = -1;
             }
+            /* the ping carries the credits of the output buffers */
+            memcpy (senderPtr->pingData, &now, sizeof (now));
+            pingDataSize = sizeof (now) + ARNETWORK_Sender_WriteCredits (senderPtr, senderPtr->pingData + sizeof (now));
+            inputBufferPtrTemp = senderPtr->inputBufferPtrMap[ARNETWORK_MANAGER_INTERNAL_BUFFER_ID_PING];
+            ARNETWORK_IOBuffer_Lock (inputBufferPtrTemp);
+            ARNETWORK_IOBuffer_AddData (inputBufferPtrTemp, senderPtr->pingData, pingDataSize, NULL, NULL, 1);
+            ARNETWORK_IOBuffer_Unlock (inputBufferPtrTemp);
+            senderPtr->pingStartTime.tv_sec = now.tv_sec;
+            senderPtr->pingStartTime.tv_nsec = now.tv_nsec;
+            senderPtr->isPingRunning = 1;
         }
+    }
+
+    ARSAL_Mutex_Unlock (&(senderPtr->pingMutex));
+
+    /* Advertise the credits alone ; a pong without timestamp is not a ping reply */
+    if (ARNETWORK_Sender_IsCreditUpdateNeeded (senderPtr, &isWaitingCredits))
+    {
+        struct timespec noPingTime = { 0 };
+        ARNETWORK_Sender_SendCredits (senderPtr, &noPingTime);
+    }
+
+    /* Send the acknowledgments delayed for their maximum delay */
+    ARSAL_Mutex_Lock (&(senderPtr->delayedAckMutex));
+    if ((senderPtr->numberOfPendingAcks > 0) &&
+        (ARNETWORK_Sender_ComputeTimespecUsTimeDiff (&(senderPtr->firstPendingAckTime), &now) >= senderPtr->maxAckDelayUs))
+    {
+        ARNETWORK_Sender_SendDelayedAcks (senderPtr);
+    }
+    ARSAL_Mutex_Unlock (&(senderPtr->delayedAckMutex));
 
-        ARSAL_Mutex_Unlock (&(senderPtr->pingMutex));
+    /* The low latency data can also be pushed and sent by the threads adding them */
+    ARSAL_Mutex_Lock (&(senderPtr->sendMutex));
 
-        for (inputBufferIndex = 0; inputBufferIndex < senderPtr->networkALManager->maxIds ; inputBufferIndex++)
+    for (inputBufferIndex = 0; inputBufferIndex < senderPtr->networkALManager->maxIds ; inputBufferIndex++)
+    {
+        inputBufferPtrTemp = senderPtr->inputBufferPtrMap[inputBufferIndex];
+        if (inputBufferPtrTemp != NULL)
         {
-            inputBufferPtrTemp = senderPtr->inputBufferPtrMap[inputBufferIndex];
-            if (inputBufferPtrTemp != NULL)
-            {
-                ARNETWORK_Sender_ProcessBufferToSend (senderPtr, inputBufferPtrTemp, (waitTimeMs > 0) ? sleepDurationMs : 0);
-            }
+            ARNETWORK_Sender_ProcessBufferToSend (senderPtr, inputBufferPtrTemp, elapsedTimeUs);
         }
-
-        senderPtr->networkALManager->send(senderPtr->networkALManager);
     }
 
-    return NULL;
+    senderPtr->networkALManager->send(senderPtr->networkALManager);
+
+    ARSAL_Mutex_Unlock (&(senderPtr->sendMutex));
+    ARSAL_Mutex_Unlock (&(senderPtr->buffersMutex));
 }
 
-void ARNETWORK_Sender_ProcessBufferToSend (ARNETWORK_Sender_t *senderPtr, ARNETWORK_IOBuffer_t *buffer, int hasWaitedMs)
+void ARNETWORK_Sender_ProcessBufferToSend (ARNETWORK_Sender_t *senderPtr, ARNETWORK_IOBuffer_t *buffer, int hasWaitedUs)
 {
     eARNETWORK_MANAGER_CALLBACK_RETURN callbackReturn = ARNETWORK_MANAGER_CALLBACK_RETURN_DEFAULT;
     eARNETWORK_ERROR error = ARNETWORK_OK;
+    struct timespec now;
+    int burstIndex = 0;
+    int isBurstEnded = 0;
+    int dataIndex = 0;
     /** lock the IOBuffer */
     error = ARNETWORK_IOBuffer_Lock(buffer);
 
     if(error == ARNETWORK_OK)
     {
         /** decrement the time to wait */
-        if ((buffer->waitTimeCount > 0) && (hasWaitedMs > 0))
+        if ((buffer->waitTimeCount > 0) && (hasWaitedUs > 0))
         {
-            if (hasWaitedMs > buffer->waitTimeCount)
+            if (hasWaitedUs > buffer->waitTimeCount)
             {
                 buffer->waitTimeCount = 0;
             }
             else
             {
-                buffer->waitTimeCount -= hasWaitedMs;
+                buffer->waitTimeCount -= hasWaitedUs;
+            }
+        }
+
+        /** without credit, a data is sent at the end of the probe time */
+        if ((!ARNETWORK_IOBuffer_HasCredit (buffer)) && (hasWaitedUs > 0))
+        {
+            if (hasWaitedUs >= buffer->creditProbeTimeCount)
+            {
+                buffer->credits = 1;
+                buffer->creditProbeTimeCount = ARNETWORK_IOBUFFER_CREDIT_PROBE_TIME_US;
+            }
+            else
+            {
+                buffer->creditProbeTimeCount -= hasWaitedUs;
             }
         }
 
-        if (ARNETWORK_IOBuffer_IsWaitAck (buffer))
+        if (buffer->isFragmenting)
+        {
+            ARNETWORK_Sender_ProcessFragmentsToSend (senderPtr, buffer, hasWaitedUs);
+        }
+        else if (ARNETWORK_IOBuffer_IsWaitAck (buffer))
         {
             /** decrement the time to wait before considering as a timeout */
-            if ((buffer->ackWaitTimeCount > 0) && (hasWaitedMs > 0))
+            if ((buffer->ackWaitTimeCount > 0) && (hasWaitedUs > 0))
             {
-                if (hasWaitedMs > buffer->ackWaitTimeCount)
+                if (hasWaitedUs > buffer->ackWaitTimeCount)
                 {
                     buffer->ackWaitTimeCount = 0;
                 }
                 else
                 {
-                    buffer->ackWaitTimeCount -= hasWaitedMs;
+                    buffer->ackWaitTimeCount -= hasWaitedUs;
                 }
             }
 
@@ -394,6 +721,7 @@ void ARNETWORK_Sender_ProcessBufferToSend (ARNETWORK_Sender_t *senderPtr, ARNETW
                     /** if there are timeout and too sending retry ... */
 
                     ARSAL_PRINT (ARSAL_PRINT_DEBUG, ARNETWORK_SENDER_TAG, "!!! too retry !!!");
+                    ARNETWORK_Trace_Record (senderPtr->tracePtr, ARNETWORK_TRACE_ROLE_SENDER, ARNETWORK_TRACE_EVENT_DROP, buffer->ID, buffer->seq, 0, ARNETWORK_TRACE_DROP_REASON_ACK_TIMEOUT);
 
                     callbackReturn = ARNETWORK_Sender_TimeOutCallback (senderPtr, buffer);
 
@@ -407,8 +735,16 @@ void ARNETWORK_Sender_ProcessBufferToSend (ARNETWORK_Sender_t *senderPtr, ARNETW
                     error = ARNETWORK_Sender_AddToBuffer (senderPtr, buffer, 1);
                     if (error == ARNETWORK_OK)
                     {
+                        /** a timeout is a loss for the congestion control */
+                        if (ARNETWORK_Sender_IsThrottled (buffer))
+                        {
+                            ARSAL_Time_GetTime (&now);
+                            ARNETWORK_CongestionControl_OnLoss (senderPtr->congestionControl, &now);
+                        }
+                        buffer->isRetried = 1;
+
                         /** reset the timeout counter*/
-                        buffer->ackWaitTimeCount = buffer->ackTimeoutMs;
+                        buffer->ackWaitTimeCount = buffer->ackTimeoutUs;
 
                         /** decrement the number of retry still possible is retryCount isn't -1 */
                         if (buffer->retryCount > 0)
@@ -420,44 +756,77 @@ void ARNETWORK_Sender_ProcessBufferToSend (ARNETWORK_Sender_t *senderPtr, ARNETW
             }
         }
 
-        else if ((!ARNETWORK_RingBuffer_IsEmpty (buffer->dataDescriptorRBuffer)) && (buffer->waitTimeCount == 0))
+        else if ((!ARNETWORK_RingBuffer_IsEmpty (buffer->dataDescriptorRBuffer)) && (buffer->waitTimeCount == 0) && (ARNETWORK_IOBuffer_HasCredit (buffer)))
         {
-            /** try to add the latest data of the input buffer in the sending buffer; callback with sent status */
-            if (!ARNETWORK_Sender_AddToBuffer (senderPtr, buffer, 0))
+            ARSAL_Time_GetTime (&now);
+
+            /** send up to sendingBurstSize data, while the network buffer is not full */
+            for (burstIndex = 0; (burstIndex < buffer->sendingBurstSize) && (!isBurstEnded); burstIndex++)
             {
-                buffer->waitTimeCount = buffer->sendingWaitTimeMs;
+                /** try to add the latest data of the input buffer in the sending buffer; callback with sent status */
+                if ((ARNETWORK_Sender_IsThrottled (buffer)) &&
+                    (!ARNETWORK_CongestionControl_CanSend (senderPtr->congestionControl, &now)))
+                {
+                    /** the congestion window is full, the data will be sent later */
+                    isBurstEnded = 1;
+                }
+                else if (!ARNETWORK_Sender_AddToBuffer (senderPtr, buffer, 0))
+                {
+                    buffer->waitTimeCount = buffer->sendingWaitTimeUs;
+                    ARNETWORK_IOBuffer_ConsumeCredits (buffer, buffer->numberOfDataInFrame);
+
+                    switch (buffer->dataType)
+                    {
+                    case ARNETWORKAL_FRAME_TYPE_DATA_WITH_ACK:
+                        /**
+                         * reinitialize the input buffer parameters,
+                         * save the sequence wait for the acknowledgement,
+                         * and pass on waiting acknowledgement.
+                         */
+                        buffer->isWaitAck = 1;
+                        buffer->ackWaitTimeCount = buffer->ackTimeoutUs;
+                        buffer->retryCount = buffer->numberOfRetry;
+                        buffer->ackSendTime = now;
+                        buffer->isRetried = 0;
+                        isBurstEnded = 1;
+                        break;
+
+                    case ARNETWORKAL_FRAME_TYPE_DATA:
+                        /** pop the data sent */
+                        for (dataIndex = 0; dataIndex < buffer->numberOfDataInFrame; dataIndex++)
+                        {
+                            ARNETWORK_IOBuffer_PopData (buffer);
+                        }
+                        break;
+
+                    case ARNETWORKAL_FRAME_TYPE_DATA_LOW_LATENCY:
+                        /** pop the data sent */
+                        for (dataIndex = 0; dataIndex < buffer->numberOfDataInFrame; dataIndex++)
+                        {
+                            ARNETWORK_IOBuffer_PopData (buffer);
+                        }
+                        break;
+
+                    case ARNETWORKAL_FRAME_TYPE_ACK:
+                        /** pop the acknowledgement sent */
+                        ARNETWORK_IOBuffer_PopData (buffer);
+                        break;
+
+                    default:
+                        ARSAL_PRINT (ARSAL_PRINT_ERROR, ARNETWORK_SENDER_TAG, "dataType: %d unknow \n", buffer->dataType);
+                        isBurstEnded = 1;
+                        break;
+                    }
 
-                switch (buffer->dataType)
+                    if ((ARNETWORK_RingBuffer_IsEmpty (buffer->dataDescriptorRBuffer)) || (!ARNETWORK_IOBuffer_HasCredit (buffer)))
+                    {
+                        isBurstEnded = 1;
+                    }
+                }
+                else
                 {
-                case ARNETWORKAL_FRAME_TYPE_DATA_WITH_ACK:
-                    /**
-                     * reinitialize the input buffer parameters,
-                     * save the sequence wait for the acknowledgement,
-                     * and pass on waiting acknowledgement.
-                     */
-                    buffer->isWaitAck = 1;
-                    buffer->ackWaitTimeCount = buffer->ackTimeoutMs;
-                    buffer->retryCount = buffer->numberOfRetry;
-                    break;
-
-                case ARNETWORKAL_FRAME_TYPE_DATA:
-                    /** pop the data sent */
-                    ARNETWORK_IOBuffer_PopData (buffer);
-                    break;
-
-                case ARNETWORKAL_FRAME_TYPE_DATA_LOW_LATENCY:
-                    /** pop the data sent */
-                    ARNETWORK_IOBuffer_PopData (buffer);
-                    break;
-
-                case ARNETWORKAL_FRAME_TYPE_ACK:
-                    /** pop the acknowledgement sent */
-                    ARNETWORK_IOBuffer_PopData (buffer);
-                    break;
-
-                default:
-                    ARSAL_PRINT (ARSAL_PRINT_ERROR, ARNETWORK_SENDER_TAG, "dataType: %d unknow \n", buffer->dataType);
-                    break;
+                    /** the network buffer is full, the data will be sent at the next pass */
+                    isBurstEnded = 1;
                 }
             }
         }
@@ -467,58 +836,419 @@ void ARNETWORK_Sender_ProcessBufferToSend (ARNETWORK_Sender_t *senderPtr, ARNETW
     }
 }
 
-void ARNETWORK_Sender_Stop (ARNETWORK_Sender_t *senderPtr)
-{
-    /** -- Stop the sending -- */
-    senderPtr->isAlive = 0;
-}
-
-void ARNETWORK_Sender_SignalNewData (ARNETWORK_Sender_t *senderPtr)
+int ARNETWORK_Sender_ComputeTimespecUsTimeDiff (const struct timespec *start, const struct timespec *end)
 {
-    ARSAL_Cond_Signal (&(senderPtr->nextSendCond));
+    return (int) ((end->tv_sec - start->tv_sec) * ARNETWORK_SENDER_MICROSECONDS_PER_SECOND + (end->tv_nsec - start->tv_nsec) / ARNETWORK_SENDER_NANOSECONDS_PER_MICROSECOND);
 }
 
-eARNETWORK_ERROR ARNETWORK_Sender_AckReceived (ARNETWORK_Sender_t *senderPtr, int identifier, uint8_t seqNumber)
+void ARNETWORK_Sender_Wait (ARNETWORK_Sender_t *senderPtr, int waitTimeUs)
 {
-    /** -- Receive an acknowledgment fo a data -- */
+    /** -- wait the next sending -- */
 
     /** local declarations */
-    ARNETWORK_IOBuffer_t *inputBufferPtr = NULL;
-    eARNETWORK_ERROR error = ARNETWORK_OK;
-
-    inputBufferPtr = senderPtr->inputBufferPtrMap[identifier];
-
-    if (inputBufferPtr != NULL)
+    struct timespec spinStart;
+    struct timespec deadline;
+    struct timespec now;
+    struct pollfd pollFd;
+#ifdef __linux__
+    struct timespec pollTimeout;
+#endif
+    int pollResult = 0;
+    int spinTimeUs = 0;
+    int spunTimeUs = 0;
+    int hasNewData = 0;
+    int hasPendingData = 0;
+    int isSignaled = 0;
+
+    if (senderPtr->waitStrategy == ARNETWORK_MANAGER_SENDER_WAIT_STRATEGY_SPIN_THEN_BLOCK)
     {
-        /** lock the IOBuffer */
-        error = ARNETWORK_IOBuffer_Lock (inputBufferPtr);
-
-        if (error == ARNETWORK_OK)
+        /* a data signaled while the sender was processing is sent at once: it was not caught by the spin, the spin time is kept */
+        hasPendingData = __atomic_exchange_n (&(senderPtr->hasNewData), 0, __ATOMIC_SEQ_CST);
+        if (hasPendingData)
         {
-            /**
-             *  Transmit the acknowledgment to the input buffer.
-             *     if the acknowledgment is suiarray the waiting data is popped
-             */
-            error = ARNETWORK_IOBuffer_AckReceived (inputBufferPtr, seqNumber);
-
-            /** unlock the IOBuffer */
-            ARNETWORK_IOBuffer_Unlock (inputBufferPtr);
-
-            /* Wake up the send thread to update the wait time of buffers */
-            ARNETWORK_Sender_SignalNewData (senderPtr);
+            waitTimeUs = 0;
         }
     }
-    else
+
+    if ((senderPtr->waitStrategy == ARNETWORK_MANAGER_SENDER_WAIT_STRATEGY_SPIN_THEN_BLOCK) && (!hasPendingData))
     {
-        error = ARNETWORK_ERROR_ID_UNKNOWN;
-    }
+        spinTimeUs = (waitTimeUs < senderPtr->spinTimeUs) ? waitTimeUs : senderPtr->spinTimeUs;
 
-    return error;
-}
+        /* while the flag is set, the producers only set hasNewData, without signaling the notifier */
+        __atomic_store_n (&(senderPtr->isSpinning), 1, __ATOMIC_SEQ_CST);
+        ARSAL_Time_GetTime (&spinStart);
+        while ((!hasNewData) && (spunTimeUs < spinTimeUs))
+        {
+            hasNewData = __atomic_exchange_n (&(senderPtr->hasNewData), 0, __ATOMIC_SEQ_CST);
+            if (!hasNewData)
+            {
+                sched_yield ();
+                ARSAL_Time_GetTime (&now);
+                spunTimeUs = ARNETWORK_Sender_ComputeTimespecUsTimeDiff (&spinStart, &now);
+            }
+        }
+        __atomic_store_n (&(senderPtr->isSpinning), 0, __ATOMIC_SEQ_CST);
 
-eARNETWORK_ERROR ARNETWORK_Sender_Flush (ARNETWORK_Sender_t *senderPtr)
-{
-    /** -- Flush all IoBuffer -- */
+        /* a producer may have seen the spinning flag just before it was cleared: check its data once more before blocking */
+        if (!hasNewData)
+        {
+            hasNewData = __atomic_exchange_n (&(senderPtr->hasNewData), 0, __ATOMIC_SEQ_CST);
+        }
+
+        /* adapt the spin time: longer if it caught a data, shorter if the whole spin was useless */
+        if (hasNewData)
+        {
+            senderPtr->spinTimeUs *= 2;
+            if (senderPtr->spinTimeUs > senderPtr->maxSpinTimeUs)
+            {
+                senderPtr->spinTimeUs = senderPtr->maxSpinTimeUs;
+            }
+            waitTimeUs = 0;
+        }
+        else
+        {
+            if (spunTimeUs >= senderPtr->spinTimeUs)
+            {
+                senderPtr->spinTimeUs /= 2;
+                if (senderPtr->spinTimeUs < senderPtr->maxSpinTimeUs / ARNETWORK_SENDER_SPIN_TIME_RANGE)
+                {
+                    senderPtr->spinTimeUs = senderPtr->maxSpinTimeUs / ARNETWORK_SENDER_SPIN_TIME_RANGE;
+                }
+                if (senderPtr->spinTimeUs < 1)
+                {
+                    senderPtr->spinTimeUs = 1;
+                }
+            }
+            waitTimeUs -= spunTimeUs;
+        }
+    }
+
+    if (waitTimeUs > 0)
+    {
+        /* absolute deadline: the polls ended early by a signal of the system are resumed for the remaining time only */
+        clock_gettime (CLOCK_MONOTONIC, &deadline);
+        deadline.tv_sec += waitTimeUs / ARNETWORK_SENDER_MICROSECONDS_PER_SECOND;
+        deadline.tv_nsec += (waitTimeUs % ARNETWORK_SENDER_MICROSECONDS_PER_SECOND) * ARNETWORK_SENDER_NANOSECONDS_PER_MICROSECOND;
+        if (deadline.tv_nsec >= ARNETWORK_SENDER_NANOSECONDS_PER_SECOND)
+        {
+            deadline.tv_sec++;
+            deadline.tv_nsec -= ARNETWORK_SENDER_NANOSECONDS_PER_SECOND;
+        }
+
+        /* the notifier stays readable from the signal to its clear: a new data signaled before the poll is not missed */
+        pollFd.fd = senderPtr->nextSendNotifier->readFd;
+        pollFd.events = POLLIN;
+
+        while ((!isSignaled) && (waitTimeUs > 0))
+        {
+#ifdef __linux__
+            pollTimeout.tv_sec = waitTimeUs / ARNETWORK_SENDER_MICROSECONDS_PER_SECOND;
+            pollTimeout.tv_nsec = (waitTimeUs % ARNETWORK_SENDER_MICROSECONDS_PER_SECOND) * ARNETWORK_SENDER_NANOSECONDS_PER_MICROSECOND;
+            pollResult = ppoll (&pollFd, 1, &pollTimeout, NULL);
+#else
+            /* poll() has a millisecond resolution: the shorter waits are rounded up */
+            pollResult = poll (&pollFd, 1, (waitTimeUs + ARNETWORK_IOBUFFER_MICROSECONDS_PER_MILLISECOND - 1) / ARNETWORK_IOBUFFER_MICROSECONDS_PER_MILLISECOND);
+#endif
+            if (pollResult > 0)
+            {
+                ARNETWORK_Notifier_Clear (senderPtr->nextSendNotifier);
+                isSignaled = 1;
+            }
+            else
+            {
+                clock_gettime (CLOCK_MONOTONIC, &now);
+                waitTimeUs = ARNETWORK_Sender_ComputeTimespecUsTimeDiff (&now, &deadline);
+            }
+        }
+
+        /* the producers set hasNewData before to see the sender not spinning: the data signaled during the blocking wait are sent by this wake up */
+        if (senderPtr->waitStrategy == ARNETWORK_MANAGER_SENDER_WAIT_STRATEGY_SPIN_THEN_BLOCK)
+        {
+            __atomic_store_n (&(senderPtr->hasNewData), 0, __ATOMIC_SEQ_CST);
+        }
+    }
+}
+
+void ARNETWORK_Sender_Stop (ARNETWORK_Sender_t *senderPtr)
+{
+    /** -- Stop the sending -- */
+    senderPtr->isAlive = 0;
+}
+
+void ARNETWORK_Sender_SignalNewData (ARNETWORK_Sender_t *senderPtr)
+{
+    /** local declarations */
+    int isSpinning = 0;
+    int isWokenUp = 0;
+
+    /* a sender without its own thread is woken up by its driver ; the callback is called under the lock, so that its change waits the end of the call */
+    ARSAL_Mutex_Lock (&(senderPtr->wakeUpMutex));
+    if (senderPtr->wakeUpCallback != NULL)
+    {
+        senderPtr->wakeUpCallback (senderPtr->wakeUpCustomData);
+        isWokenUp = 1;
+    }
+    ARSAL_Mutex_Unlock (&(senderPtr->wakeUpMutex));
+
+    if (!isWokenUp)
+    {
+        if (senderPtr->waitStrategy == ARNETWORK_MANAGER_SENDER_WAIT_STRATEGY_SPIN_THEN_BLOCK)
+        {
+            /* a spinning sender sees the flag, the system call of the signal is not needed */
+            __atomic_store_n (&(senderPtr->hasNewData), 1, __ATOMIC_SEQ_CST);
+            isSpinning = __atomic_load_n (&(senderPtr->isSpinning), __ATOMIC_SEQ_CST);
+        }
+
+        if (!isSpinning)
+        {
+            ARNETWORK_Notifier_Signal (senderPtr->nextSendNotifier);
+        }
+    }
+}
+
+void ARNETWORK_Sender_SetWakeUpCallback (ARNETWORK_Sender_t *senderPtr, ARNETWORK_Sender_WakeUpCallback_t callback, void *customData)
+{
+    /** -- Set the callback waking up the driver of the sender -- */
+    ARSAL_Mutex_Lock (&(senderPtr->wakeUpMutex));
+    senderPtr->wakeUpCustomData = customData;
+    senderPtr->wakeUpCallback = callback;
+    ARSAL_Mutex_Unlock (&(senderPtr->wakeUpMutex));
+}
+
+int ARNETWORK_Sender_TrySendDirectly (ARNETWORK_Sender_t *senderPtr, ARNETWORK_IOBuffer_t *buffer)
+{
+    /** -- Try to send the data of a low latency buffer from the calling thread -- */
+
+    /** local declarations */
+    int isSent = 0;
+    int isRemoved = 1;
+
+    /* never wait the send path: if the sending thread (or another caller) holds it, or if the buffers are being changed, the data stay queued */
+    if (ARSAL_Mutex_Trylock (&(senderPtr->buffersMutex)) == 0)
+    {
+        if (ARSAL_Mutex_Trylock (&(senderPtr->sendMutex)) == 0)
+        {
+            if (ARNETWORK_IOBuffer_Lock (buffer) == ARNETWORK_OK)
+            {
+                /* the data are sent at once by the caller: the sending wait time of the buffer paces only the sending thread */
+                buffer->waitTimeCount = 0;
+                isRemoved = buffer->isRemoved;
+                ARNETWORK_IOBuffer_Unlock (buffer);
+            }
+
+            /* a buffer removed since the adding of the data is not sent anymore */
+            if (!isRemoved)
+            {
+                ARNETWORK_Sender_ProcessBufferToSend (senderPtr, buffer, 0);
+                senderPtr->networkALManager->send (senderPtr->networkALManager);
+            }
+
+            ARSAL_Mutex_Unlock (&(senderPtr->sendMutex));
+
+            /* the data can remain if the network buffer was full */
+            if ((!isRemoved) && (ARNETWORK_IOBuffer_Lock (buffer) == ARNETWORK_OK))
+            {
+                isSent = ARNETWORK_RingBuffer_IsEmpty (buffer->dataDescriptorRBuffer);
+                ARNETWORK_IOBuffer_Unlock (buffer);
+            }
+        }
+
+        ARSAL_Mutex_Unlock (&(senderPtr->buffersMutex));
+    }
+
+    return isSent;
+}
+
+eARNETWORK_ERROR ARNETWORK_Sender_SetWaitStrategy (ARNETWORK_Sender_t *senderPtr, eARNETWORK_MANAGER_SENDER_WAIT_STRATEGY strategy, int maxSpinTimeUs)
+{
+    /** -- Sets the wait strategy of the sender -- */
+
+    /** local declarations */
+    eARNETWORK_ERROR error = ARNETWORK_OK;
+
+    if ((strategy < ARNETWORK_MANAGER_SENDER_WAIT_STRATEGY_BLOCK) ||
+        (strategy >= ARNETWORK_MANAGER_SENDER_WAIT_STRATEGY_MAX) ||
+        ((strategy == ARNETWORK_MANAGER_SENDER_WAIT_STRATEGY_SPIN_THEN_BLOCK) && (maxSpinTimeUs <= 0)))
+    {
+        error = ARNETWORK_ERROR_BAD_PARAMETER;
+    }
+
+    if (error == ARNETWORK_OK)
+    {
+        if (strategy == ARNETWORK_MANAGER_SENDER_WAIT_STRATEGY_SPIN_THEN_BLOCK)
+        {
+            senderPtr->maxSpinTimeUs = maxSpinTimeUs;
+            senderPtr->spinTimeUs = maxSpinTimeUs;
+        }
+        senderPtr->waitStrategy = strategy;
+
+        /* wake up the sender to apply the strategy at its next wait */
+        ARNETWORK_Notifier_Signal (senderPtr->nextSendNotifier);
+    }
+
+    return error;
+}
+
+eARNETWORK_ERROR ARNETWORK_Sender_SetDelayedAck (ARNETWORK_Sender_t *senderPtr, int maxNumberOfAcks, int maxDelayUs)
+{
+    /** -- Sets the delayed acknowledgment policy of the sender -- */
+
+    /** local declarations */
+    eARNETWORK_ERROR error = ARNETWORK_OK;
+
+    if ((maxNumberOfAcks < 0) ||
+        (maxDelayUs < 0))
+    {
+        error = ARNETWORK_ERROR_BAD_PARAMETER;
+    }
+
+    if (error == ARNETWORK_OK)
+    {
+        ARSAL_Mutex_Lock (&(senderPtr->delayedAckMutex));
+        senderPtr->maxNumberOfDelayedAcks = maxNumberOfAcks;
+        senderPtr->maxAckDelayUs = maxDelayUs;
+
+        /** the acknowledgments already delayed are not kept beyond the new policy */
+        if ((senderPtr->numberOfPendingAcks > 0) &&
+            ((maxNumberOfAcks == 0) || (senderPtr->numberOfPendingAcks >= maxNumberOfAcks)))
+        {
+            ARNETWORK_Sender_SendDelayedAcks (senderPtr);
+        }
+        ARSAL_Mutex_Unlock (&(senderPtr->delayedAckMutex));
+
+        /* wake up the sender to send the acknowledgments or to apply the new delay at its next wait */
+        ARNETWORK_Sender_SignalNewData (senderPtr);
+    }
+
+    return error;
+}
+
+int ARNETWORK_Sender_DelayAck (ARNETWORK_Sender_t *senderPtr, int identifier, uint8_t seqNumber, int isImmediate)
+{
+    /** -- Delay an acknowledgment to coalesce it with others -- */
+
+    /** local declarations */
+    int isDelayed = 0;
+    int isSent = 0;
+    int isFirstPendingAck = 0;
+
+    ARSAL_Mutex_Lock (&(senderPtr->delayedAckMutex));
+
+    if (senderPtr->maxNumberOfDelayedAcks > 0)
+    {
+        isDelayed = 1;
+
+        /** a new sequence number of the same buffer replaces the pending one */
+        if (senderPtr->pendingAckSeqArr[identifier] < 0)
+        {
+            if (senderPtr->numberOfPendingAcks == 0)
+            {
+                ARSAL_Time_GetTime (&(senderPtr->firstPendingAckTime));
+                isFirstPendingAck = 1;
+            }
+            senderPtr->numberOfPendingAcks++;
+        }
+        senderPtr->pendingAckSeqArr[identifier] = seqNumber;
+
+        if ((isImmediate) || (senderPtr->numberOfPendingAcks >= senderPtr->maxNumberOfDelayedAcks))
+        {
+            isSent = ARNETWORK_Sender_SendDelayedAcks (senderPtr);
+        }
+    }
+
+    ARSAL_Mutex_Unlock (&(senderPtr->delayedAckMutex));
+
+    /* the sender sends the new frame, or starts the delay of the first pending acknowledgment */
+    if ((isSent) || (isFirstPendingAck))
+    {
+        ARNETWORK_Sender_SignalNewData (senderPtr);
+    }
+
+    return isDelayed;
+}
+
+void ARNETWORK_Sender_CoalescedAckReceived (ARNETWORK_Sender_t *senderPtr, const uint8_t *data, int dataSize)
+{
+    /** -- Receive the acknowledgments of a coalesced acknowledgments frame -- */
+
+    /** local declarations */
+    eARNETWORK_ERROR error = ARNETWORK_OK;
+    int offset = 0;
+
+    for (offset = 0; offset + ARNETWORK_SENDER_COALESCED_ACK_SIZE <= dataSize; offset += ARNETWORK_SENDER_COALESCED_ACK_SIZE)
+    {
+        if (data[offset] < senderPtr->networkALManager->maxIds)
+        {
+            error = ARNETWORK_Sender_AckReceived (senderPtr, data[offset], data[offset + 1]);
+        }
+        else
+        {
+            error = ARNETWORK_ERROR_ID_UNKNOWN;
+        }
+
+        if (error != ARNETWORK_OK)
+        {
+            ARSAL_PRINT (ARSAL_PRINT_DEBUG, ARNETWORK_SENDER_TAG, "Coalesced acknowledge of buffer %d, error: %s", data[offset], ARNETWORK_Error_ToString (error));
+        }
+    }
+}
+
+eARNETWORK_ERROR ARNETWORK_Sender_AckReceived (ARNETWORK_Sender_t *senderPtr, int identifier, uint8_t seqNumber)
+{
+    /** -- Receive an acknowledgment fo a data -- */
+
+    /** local declarations */
+    ARNETWORK_IOBuffer_t *inputBufferPtr = NULL;
+    eARNETWORK_ERROR error = ARNETWORK_OK;
+    struct timespec now;
+    int rttMs = -1;
+
+    inputBufferPtr = senderPtr->inputBufferPtrMap[identifier];
+
+    if (inputBufferPtr != NULL)
+    {
+        /** lock the IOBuffer */
+        error = ARNETWORK_IOBuffer_Lock (inputBufferPtr);
+
+        if (error == ARNETWORK_OK)
+        {
+            /**
+             *  Transmit the acknowledgment to the input buffer.
+             *     if the acknowledgment is suiarray the waiting data is popped
+             */
+            error = ARNETWORK_IOBuffer_AckReceived (inputBufferPtr, seqNumber);
+            ARNETWORK_Trace_Record (senderPtr->tracePtr, ARNETWORK_TRACE_ROLE_RECEIVER, ARNETWORK_TRACE_EVENT_ACK, identifier, seqNumber, 0, error);
+
+            /** measure the round trip time; the acknowledgment of a retried data is ambiguous and ignored */
+            if ((error == ARNETWORK_OK) && (!inputBufferPtr->isRetried) && (!inputBufferPtr->isFragmenting) && (ARNETWORK_Sender_IsThrottled (inputBufferPtr)))
+            {
+                ARSAL_Time_GetTime (&now);
+                rttMs = ARSAL_Time_ComputeTimespecMsTimeDiff (&(inputBufferPtr->ackSendTime), &now);
+            }
+
+            /** unlock the IOBuffer */
+            ARNETWORK_IOBuffer_Unlock (inputBufferPtr);
+
+            if (rttMs >= 0)
+            {
+                ARNETWORK_CongestionControl_OnRttSample (senderPtr->congestionControl, rttMs, &now);
+            }
+
+            /* Wake up the send thread to update the wait time of buffers */
+            ARNETWORK_Sender_SignalNewData (senderPtr);
+        }
+    }
+    else
+    {
+        error = ARNETWORK_ERROR_ID_UNKNOWN;
+    }
+
+    return error;
+}
+
+eARNETWORK_ERROR ARNETWORK_Sender_Flush (ARNETWORK_Sender_t *senderPtr)
+{
+    /** -- Flush all IoBuffer -- */
 
     /** local declarations */
     eARNETWORK_ERROR error = ARNETWORK_OK;
@@ -545,14 +1275,59 @@ eARNETWORK_ERROR ARNETWORK_Sender_Flush (ARNETWORK_Sender_t *senderPtr)
     return error;
 }
 
-void ARNETWORK_Sender_Reset (ARNETWORK_Sender_t *senderPtr)
+eARNETWORK_ERROR ARNETWORK_Sender_Reset (ARNETWORK_Sender_t *senderPtr)
 {
     /** -- Reset the Sender -- */
 
     /** local declarations */
+    eARNETWORK_ERROR error = ARNETWORK_OK;
+    int inputIndex = 0;
+    int identifier = 0;
+    ARNETWORK_IOBuffer_t *inputBufferTemp = NULL;
+
+    /** reset all input buffers, including the internal ones */
+    for (inputIndex = 0; (inputIndex < senderPtr->numberOfInputBuff + senderPtr->numberOfInternalInputBuff) && (error == ARNETWORK_OK); ++inputIndex)
+    {
+        inputBufferTemp = (inputIndex < senderPtr->numberOfInputBuff) ? senderPtr->inputBufferPtrArr[inputIndex] : senderPtr->internalInputBufferPtrArr[inputIndex - senderPtr->numberOfInputBuff];
 
-    /** flush all IoBuffer */
-    ARNETWORK_Sender_Flush (senderPtr);
+        /** lock the IOBuffer */
+        error = ARNETWORK_IOBuffer_Lock (inputBufferTemp);
+
+        if (error == ARNETWORK_OK)
+        {
+            /** reset the IoBuffer */
+            error = ARNETWORK_IOBuffer_Reset (inputBufferTemp);
+
+            /** unlock the IOBuffer */
+            ARNETWORK_IOBuffer_Unlock (inputBufferTemp);
+        }
+    }
+
+    /** forget the delayed acknowledgments */
+    ARSAL_Mutex_Lock (&(senderPtr->delayedAckMutex));
+    for (identifier = 0; identifier < senderPtr->networkALManager->maxIds; identifier++)
+    {
+        senderPtr->pendingAckSeqArr[identifier] = -1;
+    }
+    senderPtr->numberOfPendingAcks = 0;
+    ARSAL_Mutex_Unlock (&(senderPtr->delayedAckMutex));
+
+    /** forget the ping running and the latency measured ; the next ping is sent after minTimeBetweenPings */
+    ARSAL_Mutex_Lock (&(senderPtr->pingMutex));
+    senderPtr->isPingRunning = 0;
+    senderPtr->lastPingValue = -1;
+    ARSAL_Time_GetTime (&(senderPtr->pingStartTime));
+    ARSAL_Mutex_Unlock (&(senderPtr->pingMutex));
+
+    /** restart the congestion control and the timers */
+    ARNETWORK_CongestionControl_Reset (senderPtr->congestionControl);
+    ARSAL_Time_GetTime (&(senderPtr->lastProcessTime));
+    __atomic_store_n (&(senderPtr->hasNewData), 0, __ATOMIC_SEQ_CST);
+
+    /** the sending can be started again after a stop */
+    senderPtr->isAlive = 1;
+
+    return error;
 }
 
 /*****************************************
@@ -567,11 +1342,55 @@ eARNETWORK_ERROR ARNETWORK_Sender_AddToBuffer (ARNETWORK_Sender_t *senderPtr, AR
 
     /** local declarations */
     eARNETWORK_ERROR error = ARNETWORK_OK;
+    eARNETWORKAL_MANAGER_RETURN pushReturn = ARNETWORKAL_MANAGER_RETURN_DEFAULT;
     ARNETWORK_DataDescriptor_t dataDescriptor;
+    uint8_t *frameData = NULL;
+    int frameDataSize = 0;
+    int numberOfData = 1;
+    int dataIndex = 0;
+    int writtenSize = 0;
 
     /** pop data descriptor*/
     error = ARNETWORK_RingBuffer_Front (inputBufferPtr->dataDescriptorRBuffer, (uint8_t*) &dataDescriptor);
 
+    if ((error == ARNETWORK_OK) && (inputBufferPtr->isAggregating))
+    {
+        /** pack the data queued in the aggregation buffer ; a retry sends the same data again */
+        numberOfData = (isRetry) ? inputBufferPtr->numberOfDataInFrame : ARNETWORK_RingBuffer_GetNumberOfData (inputBufferPtr->dataDescriptorRBuffer);
+        if ((!isRetry) && (inputBufferPtr->isCreditFlowControlled) && (inputBufferPtr->credits > 0) && (inputBufferPtr->credits < numberOfData))
+        {
+            /** the peer can't store more data than its credits */
+            numberOfData = inputBufferPtr->credits;
+        }
+        for (dataIndex = 0; (dataIndex < numberOfData) && (writtenSize >= 0); dataIndex++)
+        {
+            ARNETWORK_RingBuffer_Get (inputBufferPtr->dataDescriptorRBuffer, dataIndex, (uint8_t*) &dataDescriptor);
+            writtenSize = ARNETWORK_IOBuffer_WriteAggregatedData (senderPtr->aggregationBuffer + frameDataSize, senderPtr->aggregationBufferSize - frameDataSize, dataDescriptor.data, dataDescriptor.dataSize);
+            if (writtenSize >= 0)
+            {
+                frameDataSize += writtenSize;
+            }
+            else
+            {
+                numberOfData = dataIndex;
+            }
+        }
+        frameData = senderPtr->aggregationBuffer;
+
+        if (numberOfData == 0)
+        {
+            /** the data is too large for a frame: it could never be sent */
+            ARSAL_PRINT (ARSAL_PRINT_ERROR, ARNETWORK_SENDER_TAG, "data of %d bytes too large to be aggregated in buffer %d", dataDescriptor.dataSize, inputBufferPtr->ID);
+            ARNETWORK_IOBuffer_PopDataWithCallBack (inputBufferPtr, ARNETWORK_MANAGER_CALLBACK_STATUS_CANCEL);
+            error = ARNETWORK_ERROR_BAD_PARAMETER;
+        }
+    }
+    else if (error == ARNETWORK_OK)
+    {
+        frameData = dataDescriptor.data;
+        frameDataSize = dataDescriptor.dataSize;
+    }
+
     if (error == ARNETWORK_OK)
     {
         ARNETWORKAL_Frame_t frame = { 0 };
@@ -582,16 +1401,241 @@ eARNETWORK_ERROR ARNETWORK_Sender_AddToBuffer (ARNETWORK_Sender_t *senderPtr, AR
         frame.type = inputBufferPtr->dataType;
         frame.id = inputBufferPtr->ID;
         frame.seq = inputBufferPtr->seq;
-        frame.size = offsetof (ARNETWORKAL_Frame_t, dataPtr) + dataDescriptor.dataSize;
-        frame.dataPtr = dataDescriptor.data;
-        if(senderPtr->networkALManager->pushFrame(senderPtr->networkALManager, &frame) == ARNETWORKAL_MANAGER_RETURN_DEFAULT)
+        frame.size = offsetof (ARNETWORKAL_Frame_t, dataPtr) + frameDataSize;
+        frame.dataPtr = frameData;
+        pushReturn = senderPtr->networkALManager->pushFrame(senderPtr->networkALManager, &frame);
+        if(pushReturn == ARNETWORKAL_MANAGER_RETURN_DEFAULT)
         {
+            inputBufferPtr->numberOfDataInFrame = numberOfData;
+            if (isRetry)
+            {
+                ARNETWORK_Trace_Record (senderPtr->tracePtr, ARNETWORK_TRACE_ROLE_SENDER, ARNETWORK_TRACE_EVENT_RETRY, frame.id, frame.seq, frameDataSize, inputBufferPtr->retryCount);
+            }
+            else
+            {
+                ARNETWORK_Trace_Record (senderPtr->tracePtr, ARNETWORK_TRACE_ROLE_SENDER, ARNETWORK_TRACE_EVENT_SEND, frame.id, frame.seq, frameDataSize, numberOfData);
+            }
+
             /** callback with sent status */
-            if (dataDescriptor.callback != NULL)
+            for (dataIndex = 0; dataIndex < numberOfData; dataIndex++)
             {
-                dataDescriptor.callback (inputBufferPtr->ID, dataDescriptor.data, dataDescriptor.customData, ARNETWORK_MANAGER_CALLBACK_STATUS_SENT);
+                ARNETWORK_RingBuffer_Get (inputBufferPtr->dataDescriptorRBuffer, dataIndex, (uint8_t*) &dataDescriptor);
+                ARNETWORK_IOBuffer_CallBack (inputBufferPtr, &dataDescriptor, dataDescriptor.data, ARNETWORK_MANAGER_CALLBACK_STATUS_SENT);
             }
         }
+        else if (pushReturn == ARNETWORKAL_MANAGER_RETURN_BUFFER_FULL)
+        {
+            /** keep the data in the input buffer, it will be sent when the network buffer is flushed */
+            if (isRetry == 0)
+            {
+                inputBufferPtr->seq--;
+            }
+            error = ARNETWORK_ERROR_BUFFER_SIZE;
+        }
+    }
+
+    return error;
+}
+
+void ARNETWORK_Sender_ProcessFragmentsToSend (ARNETWORK_Sender_t *senderPtr, ARNETWORK_IOBuffer_t *buffer, int hasWaitedUs)
+{
+    /** -- send the fragments of the messages of a fragmenting input buffer -- */
+
+    /** local declarations */
+    eARNETWORK_MANAGER_CALLBACK_RETURN callbackReturn = ARNETWORK_MANAGER_CALLBACK_RETURN_DEFAULT;
+    eARNETWORK_ERROR error = ARNETWORK_OK;
+    ARNETWORK_DataDescriptor_t dataDescriptor;
+    struct timespec now;
+    int fragmentIndex = 0;
+    int fragmentSize = ARNETWORK_Sender_GetFragmentSize (senderPtr);
+    int isBurstEnded = 0;
+    int hasSent = 0;
+
+    ARSAL_Time_GetTime (&now);
+
+    if (ARNETWORK_IOBuffer_IsWaitAck (buffer))
+    {
+        /** decrement the time to wait before considering as a timeout */
+        if ((buffer->ackWaitTimeCount > 0) && (hasWaitedUs > 0))
+        {
+            if (hasWaitedUs > buffer->ackWaitTimeCount)
+            {
+                buffer->ackWaitTimeCount = 0;
+            }
+            else
+            {
+                buffer->ackWaitTimeCount -= hasWaitedUs;
+            }
+        }
+
+        if (buffer->ackWaitTimeCount == 0)
+        {
+            if (buffer->retryCount == 0)
+            {
+                /** if there are timeout and too sending retry, the whole message is concerned */
+                ARSAL_PRINT (ARSAL_PRINT_DEBUG, ARNETWORK_SENDER_TAG, "!!! too retry of fragment %d of message %d !!!", buffer->firstUnackedFragmentIndex, buffer->messageNumber);
+                ARNETWORK_Trace_Record (senderPtr->tracePtr, ARNETWORK_TRACE_ROLE_SENDER, ARNETWORK_TRACE_EVENT_DROP, buffer->ID, buffer->fragmentSeqArr[buffer->firstUnackedFragmentIndex % buffer->sendingBurstSize], 0, ARNETWORK_TRACE_DROP_REASON_ACK_TIMEOUT);
+
+                callbackReturn = ARNETWORK_Sender_TimeOutCallback (senderPtr, buffer);
+
+                ARNETWORK_Sender_ManageTimeOut (senderPtr, buffer, callbackReturn);
+            }
+            else
+            {
+                /** if there is a timeout, retry to send the fragments of the window not acknowledged */
+                for (fragmentIndex = buffer->firstUnackedFragmentIndex; (fragmentIndex < buffer->nextFragmentIndex) && (error == ARNETWORK_OK); fragmentIndex++)
+                {
+                    if (buffer->fragmentSeqArr[fragmentIndex % buffer->sendingBurstSize] >= 0)
+                    {
+                        error = ARNETWORK_Sender_AddFragmentToBuffer (senderPtr, buffer, fragmentIndex, 1);
+                    }
+                }
+
+                if (error == ARNETWORK_OK)
+                {
+                    /** a timeout is a loss for the congestion control */
+                    if (ARNETWORK_Sender_IsThrottled (buffer))
+                    {
+                        ARNETWORK_CongestionControl_OnLoss (senderPtr->congestionControl, &now);
+                    }
+                    buffer->isRetried = 1;
+
+                    /** reset the timeout counter*/
+                    buffer->ackWaitTimeCount = buffer->ackTimeoutUs;
+
+                    /** decrement the number of retry still possible is retryCount isn't -1 */
+                    if (buffer->retryCount > 0)
+                    {
+                        -- (buffer->retryCount);
+                    }
+                }
+            }
+        }
+    }
+
+    if (buffer->waitTimeCount == 0)
+    {
+        /** send the new fragments, while the window of the fragments not acknowledged is not full */
+        while ((!isBurstEnded) && (ARNETWORK_IOBuffer_CanSendFragment (buffer)))
+        {
+            if ((ARNETWORK_Sender_IsThrottled (buffer)) &&
+                (!ARNETWORK_CongestionControl_CanSend (senderPtr->congestionControl, &now)))
+            {
+                /** the congestion window is full, the fragments will be sent later */
+                isBurstEnded = 1;
+            }
+            else if (buffer->numberOfFragments == 0)
+            {
+                /** start the sending of the next message */
+                ARNETWORK_RingBuffer_Front (buffer->dataDescriptorRBuffer, (uint8_t*) &dataDescriptor);
+                buffer->numberOfFragments = (dataDescriptor.dataSize + fragmentSize - 1) / fragmentSize;
+                if (buffer->numberOfFragments == 0)
+                {
+                    /** an empty message is sent in one empty fragment */
+                    buffer->numberOfFragments = 1;
+                }
+
+                if (buffer->numberOfFragments > ARNETWORK_IOBUFFER_FRAGMENT_NUMBER_MAX)
+                {
+                    /** the data is too large to be fragmented: it could never be sent */
+                    ARSAL_PRINT (ARSAL_PRINT_ERROR, ARNETWORK_SENDER_TAG, "data of %d bytes too large to be fragmented in buffer %d", dataDescriptor.dataSize, buffer->ID);
+                    buffer->numberOfFragments = 0;
+                    ARNETWORK_IOBuffer_PopDataWithCallBack (buffer, ARNETWORK_MANAGER_CALLBACK_STATUS_CANCEL);
+                }
+                else
+                {
+                    buffer->messageNumber++;
+                    buffer->nextFragmentIndex = 0;
+                    buffer->firstUnackedFragmentIndex = 0;
+                }
+            }
+            else if (ARNETWORK_Sender_AddFragmentToBuffer (senderPtr, buffer, buffer->nextFragmentIndex, 0) == ARNETWORK_OK)
+            {
+                if (!ARNETWORK_IOBuffer_IsWaitAck (buffer))
+                {
+                    /** wait the acknowledgement of the fragments from the first fragment of the window */
+                    buffer->isWaitAck = 1;
+                    buffer->ackWaitTimeCount = buffer->ackTimeoutUs;
+                    buffer->retryCount = buffer->numberOfRetry;
+                    buffer->ackSendTime = now;
+                    buffer->isRetried = 0;
+                }
+                buffer->nextFragmentIndex++;
+                hasSent = 1;
+            }
+            else
+            {
+                /** the network buffer is full, the fragment will be sent at the next pass */
+                isBurstEnded = 1;
+            }
+        }
+
+        if (hasSent)
+        {
+            buffer->waitTimeCount = buffer->sendingWaitTimeUs;
+        }
+    }
+}
+
+eARNETWORK_ERROR ARNETWORK_Sender_AddFragmentToBuffer (ARNETWORK_Sender_t *senderPtr, ARNETWORK_IOBuffer_t *inputBufferPtr, int fragmentIndex, int isRetry)
+{
+    /** -- add a fragment of the message being sent to the sender buffer -- */
+
+    /** local declarations */
+    eARNETWORK_ERROR error = ARNETWORK_OK;
+    eARNETWORKAL_MANAGER_RETURN pushReturn = ARNETWORKAL_MANAGER_RETURN_DEFAULT;
+    ARNETWORK_DataDescriptor_t dataDescriptor;
+    ARNETWORKAL_Frame_t frame = { 0 };
+    int fragmentSize = ARNETWORK_Sender_GetFragmentSize (senderPtr);
+    int offset = fragmentIndex * fragmentSize;
+    int payloadSize = 0;
+    int headerSize = 0;
+
+    error = ARNETWORK_RingBuffer_Front (inputBufferPtr->dataDescriptorRBuffer, (uint8_t*) &dataDescriptor);
+
+    if (error == ARNETWORK_OK)
+    {
+        /** the fragment is the header followed by its part of the data */
+        payloadSize = dataDescriptor.dataSize - offset;
+        if (payloadSize > fragmentSize)
+        {
+            payloadSize = fragmentSize;
+        }
+        headerSize = ARNETWORK_IOBuffer_WriteFragmentHeader (senderPtr->aggregationBuffer, inputBufferPtr->messageNumber, fragmentIndex, inputBufferPtr->numberOfFragments, fragmentSize);
+        memcpy (senderPtr->aggregationBuffer + headerSize, dataDescriptor.data + offset, payloadSize);
+
+        /** a retry sends the fragment again with its sequence number */
+        frame.type = inputBufferPtr->dataType;
+        frame.id = inputBufferPtr->ID;
+        frame.seq = (isRetry) ? (uint8_t) inputBufferPtr->fragmentSeqArr[fragmentIndex % inputBufferPtr->sendingBurstSize] : (uint8_t) (inputBufferPtr->seq + 1);
+        frame.size = offsetof (ARNETWORKAL_Frame_t, dataPtr) + headerSize + payloadSize;
+        frame.dataPtr = senderPtr->aggregationBuffer;
+        pushReturn = senderPtr->networkALManager->pushFrame(senderPtr->networkALManager, &frame);
+
+        if (pushReturn == ARNETWORKAL_MANAGER_RETURN_DEFAULT)
+        {
+            if (isRetry)
+            {
+                ARNETWORK_Trace_Record (senderPtr->tracePtr, ARNETWORK_TRACE_ROLE_SENDER, ARNETWORK_TRACE_EVENT_RETRY, frame.id, frame.seq, payloadSize, inputBufferPtr->retryCount);
+            }
+            else
+            {
+                inputBufferPtr->seq = frame.seq;
+                inputBufferPtr->fragmentSeqArr[fragmentIndex % inputBufferPtr->sendingBurstSize] = frame.seq;
+                ARNETWORK_Trace_Record (senderPtr->tracePtr, ARNETWORK_TRACE_ROLE_SENDER, ARNETWORK_TRACE_EVENT_SEND, frame.id, frame.seq, payloadSize, 1);
+
+                /** callback with sent status once the whole message is sent */
+                if (fragmentIndex == inputBufferPtr->numberOfFragments - 1)
+                {
+                    ARNETWORK_IOBuffer_CallBack (inputBufferPtr, &dataDescriptor, dataDescriptor.data, ARNETWORK_MANAGER_CALLBACK_STATUS_SENT);
+                }
+            }
+        }
+        else if (pushReturn == ARNETWORKAL_MANAGER_RETURN_BUFFER_FULL)
+        {
+            /** keep the fragment, it will be sent when the network buffer is flushed */
+            error = ARNETWORK_ERROR_BUFFER_SIZE;
+        }
     }
 
     return error;
@@ -609,9 +1653,12 @@ eARNETWORK_MANAGER_CALLBACK_RETURN ARNETWORK_Sender_TimeOutCallback (ARNETWORK_S
     ARNETWORK_RingBuffer_Front (inputBufferPtr->dataDescriptorRBuffer, (uint8_t*) &dataDescriptor);
 
     /** callback with timeout status*/
-    if (dataDescriptor.callback != NULL)
+    callbackRetrun = ARNETWORK_IOBuffer_CallBack (inputBufferPtr, &dataDescriptor, dataDescriptor.data, ARNETWORK_MANAGER_CALLBACK_STATUS_TIMEOUT);
+
+    /** the timeout of queued completions is decided by the policy of the buffer, the application can't answer synchronously */
+    if (inputBufferPtr->completionQueuePtr != NULL)
     {
-        callbackRetrun = dataDescriptor.callback (inputBufferPtr->ID, dataDescriptor.data, dataDescriptor.customData, ARNETWORK_MANAGER_CALLBACK_STATUS_TIMEOUT);
+        callbackRetrun = inputBufferPtr->timeoutPolicy;
     }
 
     return callbackRetrun;
@@ -622,6 +1669,9 @@ void ARNETWORK_Sender_ManageTimeOut (ARNETWORK_Sender_t *senderPtr, ARNETWORK_IO
     /**  -- Manager the return of the callback -- */
 
     /** local declarations */
+    int dataIndex = 0;
+    int inputIndex = 0;
+    ARNETWORK_IOBuffer_t *inputBufferTemp = NULL;
 
     switch (callbackReturn)
     {
@@ -631,17 +1681,33 @@ void ARNETWORK_Sender_ManageTimeOut (ARNETWORK_Sender_t *senderPtr, ARNETWORK_IO
         break;
 
     case ARNETWORK_MANAGER_CALLBACK_RETURN_DATA_POP :
-        /** pop the data*/
-        ARNETWORK_IOBuffer_PopDataWithCallBack (inputBufferPtr, ARNETWORK_MANAGER_CALLBACK_STATUS_CANCEL);
+        /** pop the data (all the data of an aggregate) */
+        for (dataIndex = 0; dataIndex < inputBufferPtr->numberOfDataInFrame; dataIndex++)
+        {
+            ARNETWORK_IOBuffer_PopDataWithCallBack (inputBufferPtr, ARNETWORK_MANAGER_CALLBACK_STATUS_CANCEL);
+        }
 
         /** force the waiting acknowledge at 0 */
         inputBufferPtr->isWaitAck = 0;
+        inputBufferPtr->numberOfFragments = 0;
 
         break;
 
     case ARNETWORK_MANAGER_CALLBACK_RETURN_FLUSH :
-        /** fluch all IOBuffers */
-        ARNETWORK_Sender_Flush (senderPtr);
+        /** fluch all IOBuffers ; the buffer of the timeout is already locked */
+        for (inputIndex = 0; inputIndex < senderPtr->numberOfInputBuff; inputIndex++)
+        {
+            inputBufferTemp = senderPtr->inputBufferPtrArr[inputIndex];
+            if (inputBufferTemp == inputBufferPtr)
+            {
+                ARNETWORK_IOBuffer_Flush (inputBufferTemp);
+            }
+            else if (ARNETWORK_IOBuffer_Lock (inputBufferTemp) == ARNETWORK_OK)
+            {
+                ARNETWORK_IOBuffer_Flush (inputBufferTemp);
+                ARNETWORK_IOBuffer_Unlock (inputBufferTemp);
+            }
+        }
         break;
 
     default:
@@ -678,15 +1744,215 @@ void ARNETWORK_Sender_GotPingAck (ARNETWORK_Sender_t *senderPtr, struct timespec
     {
         senderPtr->lastPingValue = ARSAL_Time_ComputeTimespecMsTimeDiff (startTime, endTime);
         senderPtr->isPingRunning = 0;
+        ARNETWORK_CongestionControl_OnRttSample (senderPtr->congestionControl, senderPtr->lastPingValue, endTime);
     }
     ARSAL_Mutex_Unlock (&(senderPtr->pingMutex));
 }
 
+int ARNETWORK_Sender_IsThrottled (ARNETWORK_IOBuffer_t *buffer)
+{
+    return ((buffer->ID >= ARNETWORK_MANAGER_INTERNAL_BUFFER_ID_MAX) &&
+            ((buffer->dataType == ARNETWORKAL_FRAME_TYPE_DATA) ||
+             (buffer->dataType == ARNETWORKAL_FRAME_TYPE_DATA_WITH_ACK)));
+}
+
 void ARNETWORK_Sender_SendPong (ARNETWORK_Sender_t *senderPtr, uint8_t *data, int dataSize)
 {
-    ARNETWORK_IOBuffer_t *inputBufferPtrTemp;
-    inputBufferPtrTemp = senderPtr->inputBufferPtrMap[ARNETWORK_MANAGER_INTERNAL_BUFFER_ID_PONG];
+    /** local declarations */
+    struct timespec pingTime;
+
+    /** only the timestamp of the ping is returned: the rest of the ping are the credits of the peer */
+    if (dataSize >= (int) sizeof (pingTime))
+    {
+        memcpy (&pingTime, data, sizeof (pingTime));
+        ARNETWORK_Sender_SendCredits (senderPtr, &pingTime);
+    }
+}
+
+void ARNETWORK_Sender_CreditReceived (ARNETWORK_Sender_t *senderPtr, int identifier, int credits)
+{
+    /** -- Receive the credits of an input buffer -- */
+
+    /** local declarations */
+    ARNETWORK_IOBuffer_t *inputBufferPtr = NULL;
+
+    if ((identifier >= 0) && (identifier < senderPtr->networkALManager->maxIds))
+    {
+        inputBufferPtr = senderPtr->inputBufferPtrMap[identifier];
+    }
+
+    if ((inputBufferPtr != NULL) && (ARNETWORK_IOBuffer_Lock (inputBufferPtr) == ARNETWORK_OK))
+    {
+        ARNETWORK_IOBuffer_CreditsReceived (inputBufferPtr, credits);
+        ARNETWORK_IOBuffer_Unlock (inputBufferPtr);
+
+        /* Wake up the send thread to send the data waiting credits */
+        if (credits > 0)
+        {
+            ARNETWORK_Sender_SignalNewData (senderPtr);
+        }
+    }
+}
+
+void ARNETWORK_Sender_CreditsReceived (ARNETWORK_Sender_t *senderPtr, const uint8_t *data, int dataSize)
+{
+    /** -- Receive the credits of a ping or pong frame -- */
+
+    /** local declarations */
+    int offset = 0;
+
+    for (offset = 0; offset + ARNETWORK_SENDER_CREDITS_SIZE <= dataSize; offset += ARNETWORK_SENDER_CREDITS_SIZE)
+    {
+        ARNETWORK_Sender_CreditReceived (senderPtr, data[offset], data[offset + 1]);
+    }
+}
+
+int ARNETWORK_Sender_GetMemoryFootprint (ARNETWORK_Sender_t *senderPtr)
+{
+    /** -- Get the memory allocated by the Sender -- */
+
+    /** local declarations */
+    int size = 0;
+
+    if (senderPtr != NULL)
+    {
+        size = ARNETWORK_Sender_GetNewMemoryFootprint (senderPtr->networkALManager);
+    }
+
+    return size;
+}
+
+int ARNETWORK_Sender_GetNewMemoryFootprint (ARNETWORKAL_Manager_t *networkALManager)
+{
+    /** -- Get the memory that the creation of a Sender will allocate -- */
+
+    /** local declarations */
+    int size = sizeof (ARNETWORK_Sender_t);
+
+    /** aggregation buffer, table of the delayed acknowledgments, ping and pong frames */
+    size += networkALManager->maxBufferSize;
+    size += networkALManager->maxIds * (sizeof (int) + ARNETWORK_SENDER_COALESCED_ACK_SIZE);
+    size += 2 * (sizeof (struct timespec) + networkALManager->maxIds * ARNETWORK_SENDER_CREDITS_SIZE);
+
+    size += sizeof (ARNETWORK_CongestionControl_t);
+    size += sizeof (ARNETWORK_Notifier_t);
+
+    return size;
+}
+
+int ARNETWORK_Sender_GetSendWaitTimeUs (ARNETWORK_IOBuffer_t *buffer)
+{
+    return ((ARNETWORK_IOBuffer_HasCredit (buffer)) || (buffer->creditProbeTimeCount < buffer->waitTimeCount)) ? buffer->waitTimeCount : buffer->creditProbeTimeCount;
+}
+
+int ARNETWORK_Sender_WriteCredits (ARNETWORK_Sender_t *senderPtr, uint8_t *data)
+{
+    /** -- write the credits of the output buffers -- */
+
+    /** local declarations */
+    int outputIndex = 0;
+    int dataSize = 0;
+    ARNETWORK_IOBuffer_t *outputBufferPtr = NULL;
+
+    for (outputIndex = 0; outputIndex < senderPtr->numberOfOutputBuff; outputIndex++)
+    {
+        outputBufferPtr = senderPtr->outputBufferPtrArr[outputIndex];
+        if ((outputBufferPtr->isCreditFlowControlled) && (ARNETWORK_IOBuffer_Lock (outputBufferPtr) == ARNETWORK_OK))
+        {
+            data[dataSize] = (uint8_t) outputBufferPtr->ID;
+            data[dataSize + 1] = (uint8_t) ARNETWORK_IOBuffer_AdvertiseCredits (outputBufferPtr);
+            dataSize += ARNETWORK_SENDER_CREDITS_SIZE;
+            ARNETWORK_IOBuffer_Unlock (outputBufferPtr);
+        }
+    }
+
+    return dataSize;
+}
+
+int ARNETWORK_Sender_IsCreditUpdateNeeded (ARNETWORK_Sender_t *senderPtr, int *isWaitingCredits)
+{
+    /** -- check if the peer must be told the credits of the output buffers -- */
+
+    /** local declarations */
+    int outputIndex = 0;
+    int isNeeded = 0;
+    ARNETWORK_IOBuffer_t *outputBufferPtr = NULL;
+
+    *isWaitingCredits = 0;
+    for (outputIndex = 0; outputIndex < senderPtr->numberOfOutputBuff; outputIndex++)
+    {
+        outputBufferPtr = senderPtr->outputBufferPtrArr[outputIndex];
+        if ((outputBufferPtr->isCreditFlowControlled) && (ARNETWORK_IOBuffer_Lock (outputBufferPtr) == ARNETWORK_OK))
+        {
+            if (outputBufferPtr->advertisedCredits < 0)
+            {
+                /** the credits are advertised from the start */
+                isNeeded = 1;
+            }
+            else if (outputBufferPtr->advertisedCredits == 0)
+            {
+                *isWaitingCredits = 1;
+                if (ARNETWORK_RingBuffer_GetFreeCellNumber (outputBufferPtr->dataDescriptorRBuffer) * 2 >= (int) outputBufferPtr->dataDescriptorRBuffer->numberOfCell)
+                {
+                    isNeeded = 1;
+                }
+            }
+            ARNETWORK_IOBuffer_Unlock (outputBufferPtr);
+        }
+    }
+
+    return isNeeded;
+}
+
+void ARNETWORK_Sender_SendCredits (ARNETWORK_Sender_t *senderPtr, const struct timespec *pingTime)
+{
+    /** -- queue a pong frame with the credits of the output buffers -- */
+
+    /** local declarations */
+    ARNETWORK_IOBuffer_t *inputBufferPtrTemp = senderPtr->inputBufferPtrMap[ARNETWORK_MANAGER_INTERNAL_BUFFER_ID_PONG];
+    int pongDataSize = 0;
+
     ARNETWORK_IOBuffer_Lock (inputBufferPtrTemp);
-    ARNETWORK_IOBuffer_AddData (inputBufferPtrTemp, data, dataSize, NULL, NULL, 1);
+    memcpy (senderPtr->pongData, pingTime, sizeof (*pingTime));
+    pongDataSize = sizeof (*pingTime) + ARNETWORK_Sender_WriteCredits (senderPtr, senderPtr->pongData + sizeof (*pingTime));
+    ARNETWORK_IOBuffer_AddData (inputBufferPtrTemp, senderPtr->pongData, pongDataSize, NULL, NULL, 1);
     ARNETWORK_IOBuffer_Unlock (inputBufferPtrTemp);
 }
+
+int ARNETWORK_Sender_SendDelayedAcks (ARNETWORK_Sender_t *senderPtr)
+{
+    /** -- pack the pending acknowledgments in one coalesced frame -- */
+
+    /** local declarations */
+    eARNETWORK_ERROR error = ARNETWORK_OK;
+    ARNETWORK_IOBuffer_t *ackBufferPtr = senderPtr->inputBufferPtrMap[ARNETWORK_MANAGER_INTERNAL_BUFFER_ID_ACK_COALESCED];
+    int identifier = 0;
+    int dataSize = 0;
+
+    for (identifier = 0; identifier < senderPtr->networkALManager->maxIds; identifier++)
+    {
+        if (senderPtr->pendingAckSeqArr[identifier] >= 0)
+        {
+            senderPtr->coalescedAckData[dataSize] = (uint8_t) identifier;
+            senderPtr->coalescedAckData[dataSize + 1] = (uint8_t) senderPtr->pendingAckSeqArr[identifier];
+            dataSize += ARNETWORK_SENDER_COALESCED_ACK_SIZE;
+            senderPtr->pendingAckSeqArr[identifier] = -1;
+        }
+    }
+    senderPtr->numberOfPendingAcks = 0;
+
+    error = ARNETWORK_IOBuffer_Lock (ackBufferPtr);
+    if (error == ARNETWORK_OK)
+    {
+        error = ARNETWORK_IOBuffer_AddData (ackBufferPtr, senderPtr->coalescedAckData, dataSize, NULL, NULL, 1);
+        ARNETWORK_IOBuffer_Unlock (ackBufferPtr);
+    }
+
+    /** the acknowledgments lost are as a frame lost: the data will be sent again by the peer */
+    if (error != ARNETWORK_OK)
+    {
+        ARSAL_PRINT (ARSAL_PRINT_DEBUG, ARNETWORK_SENDER_TAG, "Coalesced acknowledgments not sent, error: %s", ARNETWORK_Error_ToString (error));
+    }
+
+    return (error == ARNETWORK_OK);
+}
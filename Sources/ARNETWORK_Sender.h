@@ -41,6 +41,9 @@
 #include <libARNetworkAL/ARNETWORKAL_Manager.h>
 
 #include "ARNETWORK_IOBuffer.h"
+#include "ARNETWORK_CongestionControl.h"
+#include "ARNETWORK_Trace.h"
+#include "ARNETWORK_Notifier.h"
 
 #include <libARSAL/ARSAL_Time.h>
 
@@ -57,6 +60,32 @@
  */
 #define ARNETWORK_SENDER_PING_TIMEOUT_MS (1000)
 
+/**
+ * Ratio between the maximum and the minimum spin time of the spin then block wait strategy
+ */
+#define ARNETWORK_SENDER_SPIN_TIME_RANGE (16)
+
+/**
+ * Size of one acknowledgment in a coalesced acknowledgments frame : identifier of the buffer acknowledged, then sequence number
+ */
+#define ARNETWORK_SENDER_COALESCED_ACK_SIZE (2)
+
+/**
+ * @brief Size of the credits of one buffer in the ping frames : identifier of the buffer, then number of credits
+ */
+#define ARNETWORK_SENDER_CREDITS_SIZE (2)
+
+/**
+ * @brief Time, in microsecond, between two checks of the output buffers whose peer has no credit, to advertise their new credits
+ */
+#define ARNETWORK_SENDER_CREDIT_UPDATE_TIME_US (10000)
+
+/**
+ * @brief callback waking up the driver of a sender run without its own thread, when new data are available
+ * @param customData custom data given at the setting of the callback
+ */
+typedef void (*ARNETWORK_Sender_WakeUpCallback_t) (void *customData);
+
 /**
  * @brief sending manager
  * @warning before to be used the sender must be created through ARNETWORK_Sender_New()
@@ -72,8 +101,11 @@ typedef struct
     int numberOfInternalInputBuff;
     ARNETWORK_IOBuffer_t **inputBufferPtrMap; /**< address of the array storing the inputBuffers by their identifier */
 
-    ARSAL_Mutex_t nextSendMutex; /**< Mutex for the nextSendCond condition */
-    ARSAL_Cond_t nextSendCond; /**< Condition to wait on to force synchronous send */
+    ARNETWORK_Notifier_t *nextSendNotifier; /**< Notifier polled between two sends, signaled by the new data to send them at once */
+
+    ARSAL_Mutex_t sendMutex; /**< Mutex to take before to push and send frames with the networkALManager */
+    ARSAL_Mutex_t buffersMutex; /**< Mutex held during the processing of the buffers ; taken with the one of the receiver to change the arrays of buffers */
+    int isLowLatencyDirectSend; /**< Indicator of direct send of the low latency data by the thread adding them (1 = true | 0 = false) */
 
     int isAlive; /**< Indicator of aliving used for kill the thread calling the ARNETWORK_Sender_ThreadRun function (1 = alive | 0 = dead). Must be accessed through ARNETWORK_Sender_Stop()*/
 
@@ -83,7 +115,37 @@ typedef struct
     int isPingRunning; /**< Boolean-like. 1 if a ping is in progress, else 0 */
     int minTimeBetweenPings; /**< Minimum time to wait between pings. Negative value mean no ping */
 
-    int minimumTimeBetweenSendsMs; /**< Minimum time to wait between network sends */
+    int minimumTimeBetweenSendsUs; /**< Minimum time, in microsecond, to wait between network sends */
+    struct timespec lastProcessTime; /**< Time of the last processing of the input buffers */
+
+    ARNETWORK_Sender_WakeUpCallback_t wakeUpCallback; /**< Callback replacing the signal of the nextSendNotifier, for a sender run without its own thread ; NULL if not used */
+    void *wakeUpCustomData; /**< Custom data given to the wakeUpCallback */
+    ARSAL_Mutex_t wakeUpMutex; /**< Mutex protecting the wakeUpCallback and its wakeUpCustomData, held during the calls of the callback */
+
+    ARNETWORK_CongestionControl_t *congestionControl; /**< Congestion control of the data and data with ack buffers */
+    ARNETWORK_Trace_t *tracePtr; /**< Pointer on the trace of the Manager ; NULL if not used */
+
+    uint8_t *aggregationBuffer; /**< Buffer used to pack the data of the aggregating buffers */
+    int aggregationBufferSize; /**< Size of the aggregation buffer */
+
+    eARNETWORK_MANAGER_SENDER_WAIT_STRATEGY waitStrategy; /**< Wait strategy between two sends */
+    int maxSpinTimeUs; /**< Maximum spin time before blocking, in microsecond */
+    int spinTimeUs; /**< Current (adaptive) spin time before blocking, in microsecond */
+    int isSpinning; /**< Boolean-like. 1 while the sender spins, the producers do not need to signal it. Must be accessed with atomic operations */
+    int hasNewData; /**< Boolean-like. Set by the producers before they check isSpinning ; cleared by the sender before it spins and after its blocking wait. Must be accessed with atomic operations */
+
+    ARSAL_Mutex_t delayedAckMutex; /**< Mutex to lock all delayed acknowledgment values */
+    int maxNumberOfDelayedAcks; /**< Number of pending acknowledgments triggering the sending of a coalesced frame ; 0 if the acknowledgments are not delayed */
+    int maxAckDelayUs; /**< Maximum time, in microsecond, an acknowledgment can be delayed */
+    int *pendingAckSeqArr; /**< Sequence number to acknowledge, by identifier of buffer ; -1 if no acknowledgment is pending */
+    int numberOfPendingAcks; /**< Number of pending acknowledgments */
+    struct timespec firstPendingAckTime; /**< Time at which the oldest pending acknowledgment has been delayed */
+    uint8_t *coalescedAckData; /**< Buffer used to pack the pending acknowledgments in one frame */
+
+    ARNETWORK_IOBuffer_t **outputBufferPtrArr; /**< address of the array of pointers of output buffer, whose credits are advertised ; set by the Manager */
+    int numberOfOutputBuff;
+    uint8_t *pingData; /**< Buffer used to write the ping frames, with the credits of the output buffers */
+    uint8_t *pongData; /**< Buffer used to write the pong frames, with the credits of the output buffers ; used with the pong buffer locked */
 
 }ARNETWORK_Sender_t;
 
@@ -121,15 +183,43 @@ void ARNETWORK_Sender_Delete (ARNETWORK_Sender_t **senderPtrAddr);
  */
 void* ARNETWORK_Sender_ThreadRun (void* data);
 
+/**
+ * @brief Compute the time to wait before the next processing of the input buffers
+ * @details Used by ARNETWORK_Sender_ThreadRun(), and by the drivers of a sender run without its own thread.
+ * @param senderPtr the pointer on the Sender
+ * @return time to wait, in microsecond ; 0 if the input buffers must be processed at once
+ * @see ARNETWORK_Sender_Process()
+ */
+int ARNETWORK_Sender_GetWaitTimeUs (ARNETWORK_Sender_t *senderPtr);
+
+/**
+ * @brief Process the input buffers once: send the data, the pings and the acknowledgments due
+ * @details Used by ARNETWORK_Sender_ThreadRun(), and by the drivers of a sender run without its own thread.
+ * @warning must not be called by several threads at once
+ * @param senderPtr the pointer on the Sender
+ * @see ARNETWORK_Sender_GetWaitTimeUs()
+ */
+void ARNETWORK_Sender_Process (ARNETWORK_Sender_t *senderPtr);
+
+/**
+ * @brief Set the callback waking up the driver of a sender run without its own thread
+ * @details returns once the calls of the previous callback in progress are done: its custom data is not used anymore
+ * @warning must not be called with a lock taken by the callback
+ * @param senderPtr the pointer on the Sender
+ * @param callback the callback replacing the signal of the sending thread ; NULL to signal the sending thread
+ * @param customData custom data given to the callback
+ */
+void ARNETWORK_Sender_SetWakeUpCallback (ARNETWORK_Sender_t *senderPtr, ARNETWORK_Sender_WakeUpCallback_t callback, void *customData);
+
 /**
  * @brief Process a buffer in the send loop
  * This function is called internally by the ARNETWORK_Sender_ThreadRun() function.
  * It should not be called anywhere else (not thread safe, not reentrant ...)
  * @param senderPtr the pointer on the Sender
  * @param buffer the buffer to process
- * @param hasWaited flag to indicate that a milisecond has passed since the last call for this buffer
+ * @param hasWaitedUs time, in microsecond, elapsed since the last call for this buffer
  */
-void ARNETWORK_Sender_ProcessBufferToSend (ARNETWORK_Sender_t *senderPtr, ARNETWORK_IOBuffer_t *buffer, int hasWaited);
+void ARNETWORK_Sender_ProcessBufferToSend (ARNETWORK_Sender_t *senderPtr, ARNETWORK_IOBuffer_t *buffer, int hasWaitedUs);
 
 /**
  * @brief Stop the sending
@@ -145,6 +235,56 @@ void ARNETWORK_Sender_Stop (ARNETWORK_Sender_t *senderPtr);
  */
 void ARNETWORK_Sender_SignalNewData (ARNETWORK_Sender_t *senderPtr);
 
+/**
+ * @brief Try to send the data of a low latency buffer from the calling thread
+ * @details The data are pushed and sent only if the send path and the buffers are free ; otherwise the sending thread must be signaled.
+ * The sending wait time of the buffer is not applied to the data sent directly.
+ * @warning The IOBuffer must not be locked by the caller
+ * @param senderPtr pointer on the Sender
+ * @param buffer the low latency input buffer
+ * @return 1 if all the data of the buffer have been sent, otherwise 0
+ */
+int ARNETWORK_Sender_TrySendDirectly (ARNETWORK_Sender_t *senderPtr, ARNETWORK_IOBuffer_t *buffer);
+
+/**
+ * @brief Sets the wait strategy of the sender
+ * @param senderPtr pointer on the Sender
+ * @param strategy the wait strategy
+ * @param maxSpinTimeUs maximum spin time before blocking, in microsecond (used by the spin then block strategy)
+ * @return error eARNETWORK_ERROR
+ */
+eARNETWORK_ERROR ARNETWORK_Sender_SetWaitStrategy (ARNETWORK_Sender_t *senderPtr, eARNETWORK_MANAGER_SENDER_WAIT_STRATEGY strategy, int maxSpinTimeUs);
+
+/**
+ * @brief Sets the delayed acknowledgment policy of the sender
+ * @details the pending acknowledgments are sent in one coalesced frame when maxNumberOfAcks are pending or when the oldest was delayed for maxDelayUs.
+ * Disabling the policy sends the pending acknowledgments.
+ * @param senderPtr pointer on the Sender
+ * @param maxNumberOfAcks number of pending acknowledgments triggering the sending ; 0 to send each acknowledgment alone and immediately
+ * @param maxDelayUs maximum time, in microsecond, an acknowledgment can be delayed
+ * @return error eARNETWORK_ERROR
+ */
+eARNETWORK_ERROR ARNETWORK_Sender_SetDelayedAck (ARNETWORK_Sender_t *senderPtr, int maxNumberOfAcks, int maxDelayUs);
+
+/**
+ * @brief Delays an acknowledgment to coalesce it with others
+ * @details Called by a libARNetwork/receiver for each data with acknowledgment received.
+ * @param senderPtr the pointer on the Sender
+ * @param[in] identifier identifier of the buffer of the data to acknowledge
+ * @param[in] seqNumber sequence number of the data to acknowledge
+ * @param[in] isImmediate 1 to send the pending acknowledgments now, 0 to wait the delayed acknowledgment policy
+ * @return 1 if the acknowledgment is taken in charge, 0 if the acknowledgments are not delayed and must be sent alone
+ */
+int ARNETWORK_Sender_DelayAck (ARNETWORK_Sender_t *senderPtr, int identifier, uint8_t seqNumber, int isImmediate);
+
+/**
+ * @brief Receive the acknowledgments of a coalesced acknowledgments frame
+ * @param senderPtr the pointer on the Sender
+ * @param[in] data payload of the frame : pairs of identifier and sequence number
+ * @param[in] dataSize size of the payload
+ */
+void ARNETWORK_Sender_CoalescedAckReceived (ARNETWORK_Sender_t *senderPtr, const uint8_t *data, int dataSize);
+
 /**
  * @brief Receive an acknowledgment fo a data.
  * @details Called by a libARNetwork/receiver to transmit an acknowledgment.
@@ -163,10 +303,15 @@ eARNETWORK_ERROR ARNETWORK_Sender_AckReceived (ARNETWORK_Sender_t *senderPtr, in
 eARNETWORK_ERROR ARNETWORK_Sender_Flush (ARNETWORK_Sender_t *senderPtr);
 
 /**
- * @brief reset the Sender
+ * @brief reset the Sender to its state of creation, keeping its memory and its settings
+ * @details All input buffers, including the internal ones, are reset ; the delayed acknowledgments, the ping, the congestion control and the timers are reset.
+ * The Sender is alive again: the thread calling ARNETWORK_Sender_ThreadRun() can be started again after a stop.
+ * @warning the processing of the sender must be blocked by its buffersMutex
  * @param senderPtr the pointer on the Sender
+ * @return eARNETWORK_ERROR
+ * @see ARNETWORK_IOBuffer_Reset()
  */
-void ARNETWORK_Sender_Reset (ARNETWORK_Sender_t *senderPtr);
+eARNETWORK_ERROR ARNETWORK_Sender_Reset (ARNETWORK_Sender_t *senderPtr);
 
 /**
  * @brief Gets the estimated sender latency
@@ -187,12 +332,53 @@ int ARNETWORK_Sender_GetPing (ARNETWORK_Sender_t *senderPtr);
  */
 void ARNETWORK_Sender_GotPingAck (ARNETWORK_Sender_t *senderPtr, struct timespec *startTime, struct timespec *endTime);
 
+/**
+ * @brief Check if a buffer is throttled by the congestion control
+ * @note Only the data and data with ack buffers of the user are throttled. The low latency buffers, the acknowledgments and the internal buffers are always sent as soon as possible.
+ * @param buffer the input buffer
+ * @return 1 if the buffer is throttled, otherwise 0
+ */
+int ARNETWORK_Sender_IsThrottled (ARNETWORK_IOBuffer_t *buffer);
+
 /**
  * @brief Send a ping reply (a pong)
  *
- * @param data The timestamp that was included in the ping request
- * @param dataSize The size of the timestamp
+ * The pong returns the timestamp of the ping, followed by the credits of the output buffers controlled by credits
+ *
+ * @param data The payload of the ping request, starting with its timestamp
+ * @param dataSize The size of the payload
  */
 void ARNETWORK_Sender_SendPong (ARNETWORK_Sender_t *senderPtr, uint8_t *data, int dataSize);
 
+/**
+ * @brief Receive the credits of an input buffer, advertised by the peer
+ * @param senderPtr the pointer on the Sender
+ * @param[in] identifier identifier of the input buffer
+ * @param[in] credits number of data the peer can store
+ */
+void ARNETWORK_Sender_CreditReceived (ARNETWORK_Sender_t *senderPtr, int identifier, int credits);
+
+/**
+ * @brief Receive the credits advertised by the peer in a ping or pong frame
+ * @param senderPtr the pointer on the Sender
+ * @param[in] data credits of the frame, after its timestamp : pairs of identifier and number of credits
+ * @param[in] dataSize size of the credits
+ */
+void ARNETWORK_Sender_CreditsReceived (ARNETWORK_Sender_t *senderPtr, const uint8_t *data, int dataSize);
+
+/**
+ * @brief Gets the memory allocated by the Sender, without the buffers it sends
+ * @param senderPtr the pointer on the Sender
+ * @return Size in byte of the memory allocated by the Sender ; 0 if senderPtr is NULL
+ */
+int ARNETWORK_Sender_GetMemoryFootprint (ARNETWORK_Sender_t *senderPtr);
+
+/**
+ * @brief Gets the memory that the creation of a Sender will allocate, without the buffers it sends
+ * @param networkALManager the pointer on the manager of the network abstraction layer of the Sender
+ * @return Size in byte of the memory allocated by ARNETWORK_Sender_New()
+ * @see ARNETWORK_Sender_GetMemoryFootprint()
+ */
+int ARNETWORK_Sender_GetNewMemoryFootprint (ARNETWORKAL_Manager_t *networkALManager);
+
 #endif /** _ARNETWORK_SENDER_PRIVATE_H_ */
@@ -0,0 +1,343 @@
+/*
+    Copyright (C) 2014 Parrot SA
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions
+    are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in
+      the documentation and/or other materials provided with the 
+      distribution.
+    * Neither the name of Parrot nor the names
+      of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written
+      permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+    "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+    LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+    FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+    COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+    INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+    BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+    OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED 
+    AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+    OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+    OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+    SUCH DAMAGE.
+*/
+/**
+ * @file ARNETWORK_Trace.c
+ * @brief lock-free binary trace of the sending and the receiving paths
+ * @date 19/10/2026
+ **/
+
+/*****************************************
+ *
+ *             include file :
+ *
+ *****************************************/
+
+#include <stdlib.h>
+#include <unistd.h>
+#include <errno.h>
+
+#include <libARSAL/ARSAL_Print.h>
+#include <libARSAL/ARSAL_Mutex.h>
+#include <libARSAL/ARSAL_Time.h>
+
+#include <libARNetwork/ARNETWORK_Error.h>
+#include <libARNetwork/ARNETWORK_Trace.h>
+
+#include "ARNETWORK_Trace.h"
+
+/*****************************************
+ *
+ *             define :
+ *
+ *****************************************/
+
+#define ARNETWORK_TRACE_TAG "ARNETWORK_Trace"
+
+/*****************************************
+ *
+ *             private header:
+ *
+ *****************************************/
+
+/**
+ * @brief write all the bytes of a buffer in a file descriptor
+ * @param[in] fd file descriptor
+ * @param[in] buffer buffer to write
+ * @param[in] size size of the buffer
+ * @return ARNETWORK_OK or ARNETWORK_ERROR if the write failed
+ */
+static eARNETWORK_ERROR ARNETWORK_Trace_Write (int fd, const void *buffer, size_t size);
+
+/**
+ * @brief get the number of entries of a ring
+ * @param[in] numberOfEntries number of entries requested
+ * @return numberOfEntries rounded up to a power of 2
+ */
+static uint32_t ARNETWORK_Trace_GetRingSize (int numberOfEntries);
+
+/*****************************************
+ *
+ *             implementation :
+ *
+ *****************************************/
+
+ARNETWORK_Trace_t* ARNETWORK_Trace_New (void)
+{
+    /** -- Create a new trace -- */
+
+    /** local declarations */
+    ARNETWORK_Trace_t *tracePtr = calloc (1, sizeof (ARNETWORK_Trace_t));
+
+    if (tracePtr != NULL)
+    {
+        if (ARSAL_Mutex_Init (&(tracePtr->mutex)) != 0)
+        {
+            ARSAL_PRINT (ARSAL_PRINT_ERROR, ARNETWORK_TRACE_TAG, "error: %s", ARNETWORK_Error_ToString (ARNETWORK_ERROR_MUTEX));
+            free (tracePtr);
+            tracePtr = NULL;
+        }
+    }
+
+    return tracePtr;
+}
+
+void ARNETWORK_Trace_Delete (ARNETWORK_Trace_t **tracePtrAddr)
+{
+    /** -- Delete the trace -- */
+
+    /** local declarations */
+    int role = 0;
+
+    if (tracePtrAddr != NULL)
+    {
+        if ((*tracePtrAddr) != NULL)
+        {
+            for (role = 0; role < ARNETWORK_TRACE_ROLE_MAX; role++)
+            {
+                free ((*tracePtrAddr)->ringArr[role].entryArr);
+            }
+            ARSAL_Mutex_Destroy (&((*tracePtrAddr)->mutex));
+
+            free (*tracePtrAddr);
+        }
+        *tracePtrAddr = NULL;
+    }
+}
+
+eARNETWORK_ERROR ARNETWORK_Trace_Enable (ARNETWORK_Trace_t *tracePtr, int numberOfEntries)
+{
+    /** -- Enable or disable the recording of the trace -- */
+
+    /** local declarations */
+    eARNETWORK_ERROR error = ARNETWORK_OK;
+    uint32_t ringSize = 0;
+    int role = 0;
+
+    if ((tracePtr == NULL) || (numberOfEntries < 0) || (numberOfEntries > ARNETWORK_TRACE_NUMBER_OF_ENTRIES_MAX))
+    {
+        error = ARNETWORK_ERROR_BAD_PARAMETER;
+    }
+
+    if (error == ARNETWORK_OK)
+    {
+        ARSAL_Mutex_Lock (&(tracePtr->mutex));
+
+        if (numberOfEntries == 0)
+        {
+            __atomic_store_n (&(tracePtr->isEnabled), 0, __ATOMIC_RELEASE);
+        }
+        else
+        {
+            /** the rings are allocated once: a recording thread can still use them after a disabling */
+            if (tracePtr->ringArr[0].entryArr == NULL)
+            {
+                ringSize = ARNETWORK_Trace_GetRingSize (numberOfEntries);
+
+                for (role = 0; (role < ARNETWORK_TRACE_ROLE_MAX) && (error == ARNETWORK_OK); role++)
+                {
+                    tracePtr->ringArr[role].entryArr = calloc (ringSize, sizeof (ARNETWORK_TraceEntry_t));
+                    tracePtr->ringArr[role].numberOfEntries = ringSize;
+                    tracePtr->ringArr[role].writeIndex = 0;
+                    if (tracePtr->ringArr[role].entryArr == NULL)
+                    {
+                        error = ARNETWORK_ERROR_ALLOC;
+                    }
+                }
+
+                if (error != ARNETWORK_OK)
+                {
+                    for (role = 0; role < ARNETWORK_TRACE_ROLE_MAX; role++)
+                    {
+                        free (tracePtr->ringArr[role].entryArr);
+                        tracePtr->ringArr[role].entryArr = NULL;
+                    }
+                }
+            }
+
+            if (error == ARNETWORK_OK)
+            {
+                __atomic_store_n (&(tracePtr->isEnabled), 1, __ATOMIC_RELEASE);
+            }
+        }
+
+        ARSAL_Mutex_Unlock (&(tracePtr->mutex));
+    }
+
+    return error;
+}
+
+int ARNETWORK_Trace_GetMemoryFootprint (ARNETWORK_Trace_t *tracePtr, int numberOfEntries)
+{
+    /** -- Get the memory allocated by the trace -- */
+
+    /** local declarations */
+    int size = 0;
+
+    if (tracePtr != NULL)
+    {
+        size = sizeof (ARNETWORK_Trace_t);
+
+        ARSAL_Mutex_Lock (&(tracePtr->mutex));
+
+        if (tracePtr->ringArr[0].entryArr != NULL)
+        {
+            size += ARNETWORK_TRACE_ROLE_MAX * tracePtr->ringArr[0].numberOfEntries * sizeof (ARNETWORK_TraceEntry_t);
+        }
+        else if ((numberOfEntries > 0) && (numberOfEntries <= ARNETWORK_TRACE_NUMBER_OF_ENTRIES_MAX))
+        {
+            size += ARNETWORK_TRACE_ROLE_MAX * ARNETWORK_Trace_GetRingSize (numberOfEntries) * sizeof (ARNETWORK_TraceEntry_t);
+        }
+
+        ARSAL_Mutex_Unlock (&(tracePtr->mutex));
+    }
+
+    return size;
+}
+
+eARNETWORK_ERROR ARNETWORK_Trace_Dump (ARNETWORK_Trace_t *tracePtr, int fd)
+{
+    /** -- Write the entries of the trace in a file descriptor -- */
+
+    /** local declarations */
+    eARNETWORK_ERROR error = ARNETWORK_OK;
+    ARNETWORK_TraceFileHeader_t fileHeader;
+    ARNETWORK_TraceRingHeader_t ringHeader;
+    ARNETWORK_TraceRing_t *ring = NULL;
+    uint32_t writeIndex = 0;
+    uint32_t firstIndex = 0;
+    uint32_t startOffset = 0;
+    struct timespec now;
+    int role = 0;
+
+    if ((tracePtr == NULL) || (fd < 0))
+    {
+        error = ARNETWORK_ERROR_BAD_PARAMETER;
+    }
+
+    if (error == ARNETWORK_OK)
+    {
+        ARSAL_Mutex_Lock (&(tracePtr->mutex));
+
+        ARSAL_Time_GetTime (&now);
+        fileHeader.magic = ARNETWORK_TRACE_FILE_MAGIC;
+        fileHeader.version = ARNETWORK_TRACE_FILE_VERSION;
+        fileHeader.entrySize = sizeof (ARNETWORK_TraceEntry_t);
+        fileHeader.numberOfRings = (tracePtr->ringArr[0].entryArr != NULL) ? ARNETWORK_TRACE_ROLE_MAX : 0;
+        fileHeader.dumpTimeUs = (uint32_t) (now.tv_sec * 1000000 + now.tv_nsec / 1000);
+        error = ARNETWORK_Trace_Write (fd, &fileHeader, sizeof (fileHeader));
+
+        for (role = 0; (role < (int) fileHeader.numberOfRings) && (error == ARNETWORK_OK); role++)
+        {
+            ring = &(tracePtr->ringArr[role]);
+            writeIndex = __atomic_load_n (&(ring->writeIndex), __ATOMIC_ACQUIRE);
+
+            ringHeader.role = role;
+            ringHeader.numberOfEntries = (writeIndex < ring->numberOfEntries) ? writeIndex : ring->numberOfEntries;
+            ringHeader.numberOfLostEntries = writeIndex - ringHeader.numberOfEntries;
+            error = ARNETWORK_Trace_Write (fd, &ringHeader, sizeof (ringHeader));
+
+            /** the entries, from the oldest to the newest, are in two parts if the ring has wrapped */
+            firstIndex = writeIndex - ringHeader.numberOfEntries;
+            startOffset = firstIndex & (ring->numberOfEntries - 1);
+            if ((error == ARNETWORK_OK) && (ringHeader.numberOfEntries > 0))
+            {
+                if (startOffset + ringHeader.numberOfEntries <= ring->numberOfEntries)
+                {
+                    error = ARNETWORK_Trace_Write (fd, &(ring->entryArr[startOffset]), ringHeader.numberOfEntries * sizeof (ARNETWORK_TraceEntry_t));
+                }
+                else
+                {
+                    error = ARNETWORK_Trace_Write (fd, &(ring->entryArr[startOffset]), (ring->numberOfEntries - startOffset) * sizeof (ARNETWORK_TraceEntry_t));
+                    if (error == ARNETWORK_OK)
+                    {
+                        error = ARNETWORK_Trace_Write (fd, ring->entryArr, (startOffset + ringHeader.numberOfEntries - ring->numberOfEntries) * sizeof (ARNETWORK_TraceEntry_t));
+                    }
+                }
+            }
+        }
+
+        ARSAL_Mutex_Unlock (&(tracePtr->mutex));
+    }
+
+    return error;
+}
+
+/*****************************************
+ *
+ *             private implementation:
+ *
+ *****************************************/
+
+static eARNETWORK_ERROR ARNETWORK_Trace_Write (int fd, const void *buffer, size_t size)
+{
+    /** -- write all the bytes of a buffer in a file descriptor -- */
+
+    /** local declarations */
+    eARNETWORK_ERROR error = ARNETWORK_OK;
+    const uint8_t *data = buffer;
+    ssize_t written = 0;
+
+    while ((size > 0) && (error == ARNETWORK_OK))
+    {
+        written = write (fd, data, size);
+        if (written > 0)
+        {
+            data += written;
+            size -= written;
+        }
+        else if ((written < 0) && (errno == EINTR))
+        {
+            /** interrupted, write again */
+        }
+        else
+        {
+            ARSAL_PRINT (ARSAL_PRINT_ERROR, ARNETWORK_TRACE_TAG, "trace dump write error, errno %d", errno);
+            error = ARNETWORK_ERROR;
+        }
+    }
+
+    return error;
+}
+
+static uint32_t ARNETWORK_Trace_GetRingSize (int numberOfEntries)
+{
+    /** -- get the number of entries of a ring -- */
+
+    /** local declarations */
+    uint32_t ringSize = 1;
+
+    while (ringSize < (uint32_t) numberOfEntries)
+    {
+        ringSize <<= 1;
+    }
+
+    return ringSize;
+}
@@ -0,0 +1,152 @@
+/*
+    Copyright (C) 2014 Parrot SA
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions
+    are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in
+      the documentation and/or other materials provided with the 
+      distribution.
+    * Neither the name of Parrot nor the names
+      of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written
+      permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+    "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+    LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+    FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+    COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+    INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+    BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+    OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED 
+    AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+    OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+    OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+    SUCH DAMAGE.
+*/
+/**
+ * @file ARNETWORK_Trace.h
+ * @brief lock-free binary trace of the sending and the receiving paths
+ * @date 19/10/2026
+ */
+
+#ifndef _ARNETWORK_TRACE_PRIVATE_H_
+#define _ARNETWORK_TRACE_PRIVATE_H_
+
+#include <libARSAL/ARSAL_Mutex.h>
+#include <libARSAL/ARSAL_Time.h>
+#include <libARNetwork/ARNETWORK_Error.h>
+#include <libARNetwork/ARNETWORK_Trace.h>
+
+/**
+ * Maximum number of entries of a ring
+ */
+#define ARNETWORK_TRACE_NUMBER_OF_ENTRIES_MAX (1 << 20)
+
+/**
+ * @brief ring of the entries recorded by the threads of one role
+ */
+typedef struct
+{
+    ARNETWORK_TraceEntry_t *entryArr; /**< array of the entries */
+    uint32_t numberOfEntries; /**< number of entries of the array ; power of 2 */
+    uint32_t writeIndex; /**< index of the next entry to write, modulo 2^32 ; incremented atomically to reserve an entry */
+
+}ARNETWORK_TraceRing_t;
+
+/**
+ * @brief binary trace of the Manager
+ * @details The recording is lock-free: an entry is reserved by an atomic increment, then written without formatting.
+ * @warning before to be used the trace must be created through ARNETWORK_Trace_New()
+ * @post after its using the trace must be deleted through ARNETWORK_Trace_Delete()
+ */
+typedef struct
+{
+    int isEnabled; /**< Indicator of recording (1 = true | 0 = false) ; accessed atomically */
+    ARNETWORK_TraceRing_t ringArr[ARNETWORK_TRACE_ROLE_MAX]; /**< one ring by role */
+    ARSAL_Mutex_t mutex; /**< Mutex to take to enable or dump the trace */
+
+}ARNETWORK_Trace_t;
+
+/**
+ * @brief Create a new trace, disabled
+ * @warning This function allocate memory
+ * @post ARNETWORK_Trace_Delete() must be called to delete the trace and free the memory allocated
+ * @return Pointer on the new trace
+ * @see ARNETWORK_Trace_Delete()
+ */
+ARNETWORK_Trace_t* ARNETWORK_Trace_New (void);
+
+/**
+ * @brief Delete the trace
+ * @warning This function free memory
+ * @param tracePtrAddr address of the pointer on the trace to delete
+ * @see ARNETWORK_Trace_New()
+ */
+void ARNETWORK_Trace_Delete (ARNETWORK_Trace_t **tracePtrAddr);
+
+/**
+ * @brief Enable or disable the recording of the trace
+ * @details The rings are allocated at the first enabling, and kept until the deletion of the trace.
+ * @param tracePtr the pointer on the trace
+ * @param[in] numberOfEntries number of entries of each ring, rounded up to a power of 2 ; only used at the first enabling ; 0 to disable the recording
+ * @return eARNETWORK_ERROR
+ */
+eARNETWORK_ERROR ARNETWORK_Trace_Enable (ARNETWORK_Trace_t *tracePtr, int numberOfEntries);
+
+/**
+ * @brief Get the memory allocated by the trace
+ * @param tracePtr the pointer on the trace
+ * @param[in] numberOfEntries number of entries of each ring given to the first enabling, if the rings are not allocated yet ; 0 to get the current memory
+ * @return Size in byte of the memory allocated, or to be allocated, by the trace ; 0 if tracePtr is NULL
+ */
+int ARNETWORK_Trace_GetMemoryFootprint (ARNETWORK_Trace_t *tracePtr, int numberOfEntries);
+
+/**
+ * @brief Write the entries of the trace in a file descriptor
+ * @param tracePtr the pointer on the trace
+ * @param[in] fd file descriptor in which the trace is written
+ * @return eARNETWORK_ERROR
+ * @see ARNETWORK_TraceFileHeader_t
+ */
+eARNETWORK_ERROR ARNETWORK_Trace_Dump (ARNETWORK_Trace_t *tracePtr, int fd);
+
+/**
+ * @brief Record an entry in the trace, if it is enabled
+ * @note lock-free, can be called from any thread
+ * @param tracePtr the pointer on the trace ; can be NULL
+ * @param[in] role role of the thread recording the entry
+ * @param[in] event event recorded
+ * @param[in] bufferID identifier of the buffer concerned
+ * @param[in] seq sequence number
+ * @param[in] size size
+ * @param[in] info information depending on the event
+ * @see eARNETWORK_TRACE_EVENT
+ */
+static inline void ARNETWORK_Trace_Record (ARNETWORK_Trace_t *tracePtr, eARNETWORK_TRACE_ROLE role, eARNETWORK_TRACE_EVENT event, int bufferID, int seq, int size, int info)
+{
+    ARNETWORK_TraceRing_t *ring = NULL;
+    ARNETWORK_TraceEntry_t *entry = NULL;
+    struct timespec now;
+
+    if ((tracePtr != NULL) && (__atomic_load_n (&(tracePtr->isEnabled), __ATOMIC_ACQUIRE)))
+    {
+        ring = &(tracePtr->ringArr[role]);
+        entry = &(ring->entryArr[__atomic_fetch_add (&(ring->writeIndex), 1, __ATOMIC_RELAXED) & (ring->numberOfEntries - 1)]);
+
+        ARSAL_Time_GetTime (&now);
+        entry->timeUs = (uint32_t) (now.tv_sec * 1000000 + now.tv_nsec / 1000);
+        entry->event = event;
+        entry->bufferID = bufferID;
+        entry->seq = seq;
+        entry->role = role;
+        entry->size = size;
+        entry->info = info;
+    }
+}
+
+#endif /** _ARNETWORK_TRACE_PRIVATE_H_ */
@@ -0,0 +1,282 @@
+/*
+    Copyright (C) 2014 Parrot SA
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions
+    are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in
+      the documentation and/or other materials provided with the 
+      distribution.
+    * Neither the name of Parrot nor the names
+      of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written
+      permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+    "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+    LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+    FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+    COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+    INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+    BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+    OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED 
+    AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+    OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+    OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+    SUCH DAMAGE.
+*/
+/**
+ * @file arenaTest.c
+ * @brief libARNetwork TestBench comparing the creation of a Manager with malloc and in one arena
+ * @date 19/10/2026
+ */
+
+/*****************************************
+ *
+ *             include file :
+ *
+ *****************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <libARSAL/ARSAL_Print.h>
+#include <libARSAL/ARSAL_Time.h>
+
+#include <libARNetworkAL/ARNETWORKAL_Manager.h>
+#include <libARNetworkAL/ARNETWORKAL_Frame.h>
+
+#include <libARNetwork/ARNETWORK_Manager.h>
+#include <libARNetwork/ARNETWORK_IOBufferParam.h>
+
+/*****************************************
+ *
+ *             define :
+ *
+ *****************************************/
+
+#define ARENATEST_TAG "ArenaTest"
+
+#define ARENATEST_PING_DELAY (-1) // Ping disabled
+
+#define ARENATEST_NUMBER_OF_INPUT 32
+#define ARENATEST_NUMBER_OF_OUTPUT 32
+#define ARENATEST_FIRST_ID 10
+
+#define ARENATEST_NUMBER_OF_CREATION 100
+#define ARENATEST_NUMBER_OF_FLUSH 200
+
+#define ARENATEST_RECEIVER_TIMEOUT_SEC 5
+#define ARENATEST_PORT1 12345
+#define ARENATEST_PORT2 54321
+#define ARENATEST_ADRR_IP "127.0.0.1"
+
+/** the layouts of buffers measured */
+typedef struct
+{
+    int numberOfCell; /**< number of cells of each buffer */
+    int dataCopyMaxSize; /**< size of the cells of each buffer */
+
+}ARENATEST_Layout_t;
+
+/** the time measured for one way of creation */
+typedef struct
+{
+    int firstCreationUs; /**< time of the first creation, in microsecond */
+    int creationUs; /**< mean time of a creation, in microsecond */
+    int flushUs; /**< mean time of ARENATEST_NUMBER_OF_FLUSH flushes, in microsecond */
+
+}ARENATEST_Result_t;
+
+void ARENATEST_InitParamIOBuffer (ARNETWORK_IOBufferParam_t *inputArr, ARNETWORK_IOBufferParam_t *outputArr, const ARENATEST_Layout_t *layout);
+
+int ARENATEST_TimeDiffUs (const struct timespec *startTime, const struct timespec *endTime);
+
+eARNETWORK_ERROR ARENATEST_Measure (ARNETWORKAL_Manager_t *networkALManager, ARNETWORK_IOBufferParam_t *inputArr, ARNETWORK_IOBufferParam_t *outputArr, int isArena, ARENATEST_Result_t *result);
+
+/*****************************************
+ *
+ *          implementation :
+ *
+ *****************************************/
+
+int main(int argc, char *argv[])
+{
+    /** local declarations */
+    ARNETWORKAL_Manager_t *networkALManager = NULL;
+    eARNETWORK_ERROR error = ARNETWORK_OK;
+    eARNETWORKAL_ERROR specificError = ARNETWORKAL_OK;
+    ARENATEST_Layout_t layoutArr[] = {{256, 256}, {16, 64}};
+    int numberOfLayout = sizeof (layoutArr) / sizeof (layoutArr[0]);
+    int layoutIndex = 0;
+    ARENATEST_Result_t mallocResult;
+    ARENATEST_Result_t arenaResult;
+    int ret = 0;
+
+    ARNETWORK_IOBufferParam_t paramInput[ARENATEST_NUMBER_OF_INPUT];
+    ARNETWORK_IOBufferParam_t paramOutput[ARENATEST_NUMBER_OF_OUTPUT];
+
+    ARSAL_PRINT (ARSAL_PRINT_WARNING, ARENATEST_TAG, " -- libARNetwork TestBench arena --");
+
+    /** the network is only used by the managers created, no data is sent */
+    networkALManager = ARNETWORKAL_Manager_New(&specificError);
+    if(specificError == ARNETWORKAL_OK)
+    {
+        specificError = ARNETWORKAL_Manager_InitWifiNetwork(networkALManager, ARENATEST_ADRR_IP, ARENATEST_PORT1, ARENATEST_PORT2, ARENATEST_RECEIVER_TIMEOUT_SEC);
+    }
+
+    if(specificError != ARNETWORKAL_OK)
+    {
+        ARSAL_PRINT (ARSAL_PRINT_WARNING, ARENATEST_TAG, "Can't init Wifi Network = %d", specificError);
+        error = ARNETWORK_ERROR;
+    }
+
+    /** the first creations of the process are measured first: the arena is measured first on a layout and second on the other one */
+    while ((error == ARNETWORK_OK) && (layoutIndex < numberOfLayout))
+    {
+        ARENATEST_InitParamIOBuffer (paramInput, paramOutput, &(layoutArr[layoutIndex]));
+
+        if ((layoutIndex % 2) == 0)
+        {
+            error = ARENATEST_Measure (networkALManager, paramInput, paramOutput, 1, &arenaResult);
+            if (error == ARNETWORK_OK)
+            {
+                error = ARENATEST_Measure (networkALManager, paramInput, paramOutput, 0, &mallocResult);
+            }
+        }
+        else
+        {
+            error = ARENATEST_Measure (networkALManager, paramInput, paramOutput, 0, &mallocResult);
+            if (error == ARNETWORK_OK)
+            {
+                error = ARENATEST_Measure (networkALManager, paramInput, paramOutput, 1, &arenaResult);
+            }
+        }
+
+        if (error == ARNETWORK_OK)
+        {
+            ARSAL_PRINT (ARSAL_PRINT_WARNING, ARENATEST_TAG, " ");
+            ARSAL_PRINT (ARSAL_PRINT_WARNING, ARENATEST_TAG, " %d inputs and %d outputs of %d cells x %d bytes :", ARENATEST_NUMBER_OF_INPUT, ARENATEST_NUMBER_OF_OUTPUT, layoutArr[layoutIndex].numberOfCell, layoutArr[layoutIndex].dataCopyMaxSize);
+            ARSAL_PRINT (ARSAL_PRINT_WARNING, ARENATEST_TAG, "    malloc : first creation %d us, creation %d us, %d flushes %d us", mallocResult.firstCreationUs, mallocResult.creationUs, ARENATEST_NUMBER_OF_FLUSH, mallocResult.flushUs);
+            ARSAL_PRINT (ARSAL_PRINT_WARNING, ARENATEST_TAG, "    arena  : first creation %d us, creation %d us, %d flushes %d us", arenaResult.firstCreationUs, arenaResult.creationUs, ARENATEST_NUMBER_OF_FLUSH, arenaResult.flushUs);
+        }
+
+        layoutIndex++;
+    }
+
+    ARSAL_PRINT (ARSAL_PRINT_WARNING, ARENATEST_TAG, " ");
+
+    if (error == ARNETWORK_OK)
+    {
+        ARSAL_PRINT (ARSAL_PRINT_WARNING, ARENATEST_TAG, " # -- Good result of the test bench -- #");
+    }
+    else
+    {
+        ARSAL_PRINT (ARSAL_PRINT_WARNING, ARENATEST_TAG, " # -- Bad result of the test bench -- #");
+        ARSAL_PRINT (ARSAL_PRINT_WARNING, ARENATEST_TAG, "    libARNetwork error : %s", ARNETWORK_Error_ToString (error));
+        ret = -1;
+    }
+
+    /** delete */
+    if (specificError == ARNETWORKAL_OK)
+    {
+        ARNETWORKAL_Manager_CloseWifiNetwork (networkALManager);
+    }
+    ARNETWORKAL_Manager_Delete (&networkALManager);
+
+    return ret;
+}
+
+void ARENATEST_InitParamIOBuffer (ARNETWORK_IOBufferParam_t *inputArr, ARNETWORK_IOBufferParam_t *outputArr, const ARENATEST_Layout_t *layout)
+{
+    /** initialization of the buffer parameters */
+
+    /** local declarations */
+    int index = 0;
+
+    for (index = 0; index < ARENATEST_NUMBER_OF_INPUT; index++)
+    {
+        ARNETWORK_IOBufferParam_DefaultInit (&(inputArr[index]));
+        inputArr[index].ID = ARENATEST_FIRST_ID + index;
+        inputArr[index].dataType = ARNETWORKAL_FRAME_TYPE_DATA;
+        inputArr[index].numberOfCell = layout->numberOfCell;
+        inputArr[index].dataCopyMaxSize = layout->dataCopyMaxSize;
+    }
+
+    for (index = 0; index < ARENATEST_NUMBER_OF_OUTPUT; index++)
+    {
+        ARNETWORK_IOBufferParam_DefaultInit (&(outputArr[index]));
+        outputArr[index].ID = ARENATEST_FIRST_ID + ARENATEST_NUMBER_OF_INPUT + index;
+        outputArr[index].dataType = ARNETWORKAL_FRAME_TYPE_DATA;
+        outputArr[index].numberOfCell = layout->numberOfCell;
+        outputArr[index].dataCopyMaxSize = layout->dataCopyMaxSize;
+    }
+}
+
+int ARENATEST_TimeDiffUs (const struct timespec *startTime, const struct timespec *endTime)
+{
+    /** -- time between two dates, in microsecond -- */
+
+    return (int) ((endTime->tv_sec - startTime->tv_sec) * 1000000 + (endTime->tv_nsec - startTime->tv_nsec) / 1000);
+}
+
+eARNETWORK_ERROR ARENATEST_Measure (ARNETWORKAL_Manager_t *networkALManager, ARNETWORK_IOBufferParam_t *inputArr, ARNETWORK_IOBufferParam_t *outputArr, int isArena, ARENATEST_Result_t *result)
+{
+    /** -- measure the creation of a Manager and the walk of all its buffers -- */
+
+    /** local declarations */
+    eARNETWORK_ERROR error = ARNETWORK_OK;
+    ARNETWORK_Manager_t *managerPtr = NULL;
+    struct timespec startTime;
+    struct timespec endTime;
+    int creationIndex = 0;
+    int flushIndex = 0;
+    int creationUs = 0;
+    int totalCreationUs = 0;
+    int totalFlushUs = 0;
+
+    while ((error == ARNETWORK_OK) && (creationIndex < ARENATEST_NUMBER_OF_CREATION))
+    {
+        ARSAL_Time_GetTime (&startTime);
+        if (isArena)
+        {
+            managerPtr = ARNETWORK_Manager_NewWithArena (networkALManager, ARENATEST_NUMBER_OF_INPUT, inputArr, ARENATEST_NUMBER_OF_OUTPUT, outputArr, ARENATEST_PING_DELAY, NULL, NULL, NULL, 0, 0, &error);
+        }
+        else
+        {
+            managerPtr = ARNETWORK_Manager_New (networkALManager, ARENATEST_NUMBER_OF_INPUT, inputArr, ARENATEST_NUMBER_OF_OUTPUT, outputArr, ARENATEST_PING_DELAY, NULL, NULL, &error);
+        }
+        ARSAL_Time_GetTime (&endTime);
+
+        creationUs = ARENATEST_TimeDiffUs (&startTime, &endTime);
+        if (creationIndex == 0)
+        {
+            result->firstCreationUs = creationUs;
+        }
+        totalCreationUs += creationUs;
+
+        /** walk all the buffers of the manager */
+        if (error == ARNETWORK_OK)
+        {
+            ARSAL_Time_GetTime (&startTime);
+            for (flushIndex = 0; flushIndex < ARENATEST_NUMBER_OF_FLUSH; flushIndex++)
+            {
+                ARNETWORK_Manager_Flush (managerPtr);
+            }
+            ARSAL_Time_GetTime (&endTime);
+
+            totalFlushUs += ARENATEST_TimeDiffUs (&startTime, &endTime);
+        }
+
+        ARNETWORK_Manager_Delete (&managerPtr);
+        creationIndex++;
+    }
+
+    result->creationUs = totalCreationUs / ARENATEST_NUMBER_OF_CREATION;
+    result->flushUs = totalFlushUs / ARENATEST_NUMBER_OF_CREATION;
+
+    return error;
+}
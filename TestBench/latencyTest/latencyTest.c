@@ -0,0 +1,418 @@
+/*
+    Copyright (C) 2014 Parrot SA
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions
+    are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in
+      the documentation and/or other materials provided with the 
+      distribution.
+    * Neither the name of Parrot nor the names
+      of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written
+      permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+    "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+    LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+    FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+    COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+    INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+    BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+    OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED 
+    AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+    OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+    OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+    SUCH DAMAGE.
+*/
+/**
+ * @file latencyTest.c
+ * @brief libARNetwork TestBench comparing the latency and the CPU usage of the sender wait strategies and of the low latency direct send
+ * @date 19/10/2026
+ */
+
+/*****************************************
+ *
+ *             include file :
+ *
+ *****************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <libARSAL/ARSAL_Print.h>
+#include <libARSAL/ARSAL_Thread.h>
+#include <libARSAL/ARSAL_Time.h>
+
+#include <libARNetworkAL/ARNETWORKAL_Manager.h>
+#include <libARNetworkAL/ARNETWORKAL_Frame.h>
+
+#include <libARNetwork/ARNETWORK_Manager.h>
+#include <libARNetwork/ARNETWORK_IOBufferParam.h>
+
+#include <unistd.h>
+#include <fcntl.h>
+#include <sys/resource.h>
+
+/*****************************************
+ *
+ *             define :
+ *
+ *****************************************/
+
+#define LATENCYTEST_TAG "LatencyTest"
+
+#define LATENCYTEST_PING_DELAY (0) // Use default value
+
+#define LATENCYTEST_NUMBER_DATA_SENT 2000
+#define LATENCYTEST_MAXIMUM_SPIN_TIME_US 200
+#define LATENCYTEST_SENDING_PERIOD_US 1000
+#define LATENCYTEST_NUMBER_OF_CELL 256
+#define LATENCYTEST_READING_TIMEOUT_MS 1000
+#define LATENCYTEST_TRACE_NUMBER_OF_ENTRIES 16384
+
+#define LATENCYTEST_RECEIVER_TIMEOUT_SEC 5
+#define LATENCYTEST_PORT1 12345
+#define LATENCYTEST_PORT2 54321
+#define LATENCYTEST_ADRR_IP "127.0.0.1"
+
+#define LATENCYTEST_NUMBER_OF_INPUT 1
+#define LATENCYTEST_NUMBER_OF_OUTPUT 1
+
+/** define of the ioBuffer identifiers */
+typedef enum
+{
+    ID_IOBUFFER_LOW_LATENCY = 10,
+
+}eID_IOBUFFER;
+
+/**
+ * @brief result of a measure
+ */
+typedef struct
+{
+    ARNETWORK_Manager_t *managerPtr; /**< manager reading the data */
+    int numberOfData; /**< number of data to read */
+    int numberOfDataReceived; /**< number of data read */
+    long long latencySumUs; /**< sum of the latencies of the data read */
+    int latencyMaxUs; /**< maximum latency of the data read */
+
+}LATENCYTEST_Reading_t;
+
+void LATENCYTEST_InitParamIOBuffer (ARNETWORK_IOBufferParam_t *inputArr, ARNETWORK_IOBufferParam_t *outputArr);
+
+void* LATENCYTEST_DataReadingRun (void *data);
+
+eARNETWORK_MANAGER_CALLBACK_RETURN LATENCYTEST_DataCallback (int OutBufferId, uint8_t *dataPtr, void *customData, eARNETWORK_MANAGER_CALLBACK_STATUS status);
+
+int LATENCYTEST_GetCpuTimeUs (void);
+
+int LATENCYTEST_Measure (ARNETWORK_Manager_t *senderManagerPtr, ARNETWORK_Manager_t *readerManagerPtr, eARNETWORK_MANAGER_SENDER_WAIT_STRATEGY strategy, int maxSpinTimeUs, int isDirectSend, int numberOfData);
+
+/*****************************************
+ *
+ *          implementation :
+ *
+ *****************************************/
+
+int main(int argc, char *argv[])
+{
+    /** local declarations */
+    ARNETWORKAL_Manager_t *networkALManager1 = NULL;
+    ARNETWORKAL_Manager_t *networkALManager2 = NULL;
+    ARNETWORK_Manager_t *manager1 = NULL;
+    ARNETWORK_Manager_t *manager2 = NULL;
+    ARSAL_Thread_t managerSendingThread1 = NULL;
+    ARSAL_Thread_t managerReceiverThread1 = NULL;
+    ARSAL_Thread_t managerSendingThread2 = NULL;
+    ARSAL_Thread_t managerReceiverThread2 = NULL;
+    eARNETWORK_ERROR error = ARNETWORK_OK;
+    eARNETWORKAL_ERROR specificError = ARNETWORKAL_OK;
+    int maxSpinTimeUs = LATENCYTEST_MAXIMUM_SPIN_TIME_US;
+    int numberOfData = LATENCYTEST_NUMBER_DATA_SENT;
+    int errorBlock = -1;
+    int errorSpin = -1;
+    int errorDirectSend = -1;
+    int ret = 0;
+    const char *traceFilePath = NULL;
+    int traceFd = -1;
+
+    ARNETWORK_IOBufferParam_t paramInput[LATENCYTEST_NUMBER_OF_INPUT];
+    ARNETWORK_IOBufferParam_t paramOutput[LATENCYTEST_NUMBER_OF_OUTPUT];
+
+    if (argc > 1)
+    {
+        maxSpinTimeUs = atoi (argv[1]);
+    }
+    if (argc > 2)
+    {
+        numberOfData = atoi (argv[2]);
+    }
+    if (argc > 3)
+    {
+        /** record the trace of both managers and dump it in this file, to decode with traceDecoder */
+        traceFilePath = argv[3];
+    }
+
+    LATENCYTEST_InitParamIOBuffer (paramInput, paramOutput);
+
+    ARSAL_PRINT (ARSAL_PRINT_WARNING, LATENCYTEST_TAG, " -- libARNetwork TestBench latency --");
+
+    /** create the sending manager */
+    networkALManager1 = ARNETWORKAL_Manager_New(&specificError);
+    if(specificError == ARNETWORKAL_OK)
+    {
+        specificError = ARNETWORKAL_Manager_InitWifiNetwork(networkALManager1, LATENCYTEST_ADRR_IP, LATENCYTEST_PORT1, LATENCYTEST_PORT2, LATENCYTEST_RECEIVER_TIMEOUT_SEC);
+    }
+
+    if(specificError == ARNETWORKAL_OK)
+    {
+        manager1 = ARNETWORK_Manager_New(networkALManager1, LATENCYTEST_NUMBER_OF_INPUT, paramInput, 0, NULL, LATENCYTEST_PING_DELAY, NULL, NULL, &error);
+    }
+    else
+    {
+        ARSAL_PRINT (ARSAL_PRINT_WARNING, LATENCYTEST_TAG, "Manager 1 : Can't init Wifi Network = %d", specificError);
+        error = ARNETWORK_ERROR;
+    }
+
+    /** create the reading manager */
+    if (error == ARNETWORK_OK)
+    {
+        networkALManager2 = ARNETWORKAL_Manager_New(&specificError);
+        if(specificError == ARNETWORKAL_OK)
+        {
+            specificError = ARNETWORKAL_Manager_InitWifiNetwork(networkALManager2, LATENCYTEST_ADRR_IP, LATENCYTEST_PORT2, LATENCYTEST_PORT1, LATENCYTEST_RECEIVER_TIMEOUT_SEC);
+        }
+
+        if(specificError == ARNETWORKAL_OK)
+        {
+            manager2 = ARNETWORK_Manager_New(networkALManager2, 0, NULL, LATENCYTEST_NUMBER_OF_OUTPUT, paramOutput, LATENCYTEST_PING_DELAY, NULL, NULL, &error);
+        }
+        else
+        {
+            ARSAL_PRINT (ARSAL_PRINT_WARNING, LATENCYTEST_TAG, "Manager 2 : Can't init Wifi Network = %d", specificError);
+            error = ARNETWORK_ERROR;
+        }
+    }
+
+    if ((error == ARNETWORK_OK) && (traceFilePath != NULL))
+    {
+        error = ARNETWORK_Manager_SetTrace (manager1, LATENCYTEST_TRACE_NUMBER_OF_ENTRIES);
+        if (error == ARNETWORK_OK)
+        {
+            error = ARNETWORK_Manager_SetTrace (manager2, LATENCYTEST_TRACE_NUMBER_OF_ENTRIES);
+        }
+    }
+
+    if (error == ARNETWORK_OK)
+    {
+        /** create the threads */
+        ARSAL_Thread_Create (&managerReceiverThread1, (ARSAL_Thread_Routine_t) ARNETWORK_Manager_ReceivingThreadRun, manager1);
+        ARSAL_Thread_Create (&managerReceiverThread2, (ARSAL_Thread_Routine_t) ARNETWORK_Manager_ReceivingThreadRun, manager2);
+        ARSAL_Thread_Create (&managerSendingThread1, (ARSAL_Thread_Routine_t) ARNETWORK_Manager_SendingThreadRun, manager1);
+        ARSAL_Thread_Create (&managerSendingThread2, (ARSAL_Thread_Routine_t) ARNETWORK_Manager_SendingThreadRun, manager2);
+
+        /** measure the same transfer with the default wait strategy, then with the spin then block strategy, then with the direct send */
+        errorBlock = LATENCYTEST_Measure (manager1, manager2, ARNETWORK_MANAGER_SENDER_WAIT_STRATEGY_BLOCK, maxSpinTimeUs, 0, numberOfData);
+        errorSpin = LATENCYTEST_Measure (manager1, manager2, ARNETWORK_MANAGER_SENDER_WAIT_STRATEGY_SPIN_THEN_BLOCK, maxSpinTimeUs, 0, numberOfData);
+        errorDirectSend = LATENCYTEST_Measure (manager1, manager2, ARNETWORK_MANAGER_SENDER_WAIT_STRATEGY_BLOCK, maxSpinTimeUs, 1, numberOfData);
+
+        /** stop all therad */
+        ARNETWORK_Manager_Stop (manager1);
+        ARNETWORK_Manager_Stop (manager2);
+
+        ARNETWORKAL_Manager_Unlock (networkALManager1);
+        ARNETWORKAL_Manager_Unlock (networkALManager2);
+
+        ARSAL_Thread_Join (managerSendingThread1, NULL);
+        ARSAL_Thread_Join (managerSendingThread2, NULL);
+        ARSAL_Thread_Join (managerReceiverThread1, NULL);
+        ARSAL_Thread_Join (managerReceiverThread2, NULL);
+
+        ARSAL_Thread_Destroy (&managerSendingThread1);
+        ARSAL_Thread_Destroy (&managerSendingThread2);
+        ARSAL_Thread_Destroy (&managerReceiverThread1);
+        ARSAL_Thread_Destroy (&managerReceiverThread2);
+
+        ARNETWORKAL_Manager_CloseWifiNetwork (networkALManager1);
+        ARNETWORKAL_Manager_CloseWifiNetwork (networkALManager2);
+    }
+
+    if ((error == ARNETWORK_OK) && (traceFilePath != NULL))
+    {
+        /** dump the traces of the sending manager then of the reading manager */
+        traceFd = open (traceFilePath, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+        if (traceFd >= 0)
+        {
+            error = ARNETWORK_Manager_DumpTrace (manager1, traceFd);
+            if (error == ARNETWORK_OK)
+            {
+                error = ARNETWORK_Manager_DumpTrace (manager2, traceFd);
+            }
+            close (traceFd);
+        }
+        else
+        {
+            ARSAL_PRINT (ARSAL_PRINT_ERROR, LATENCYTEST_TAG, "can't open the trace file %s", traceFilePath);
+            error = ARNETWORK_ERROR;
+        }
+    }
+
+    if ((error == ARNETWORK_OK) && (errorBlock == 0) && (errorSpin == 0) && (errorDirectSend == 0))
+    {
+        ARSAL_PRINT (ARSAL_PRINT_WARNING, LATENCYTEST_TAG, " # -- Good result of the test bench -- #");
+    }
+    else
+    {
+        ARSAL_PRINT (ARSAL_PRINT_WARNING, LATENCYTEST_TAG, " # -- Bad result of the test bench -- #");
+        ARSAL_PRINT (ARSAL_PRINT_WARNING, LATENCYTEST_TAG, "    libARNetwork error : %s", ARNETWORK_Error_ToString (error));
+        ret = -1;
+    }
+
+    /** delete */
+    ARNETWORK_Manager_Delete (&manager1);
+    ARNETWORK_Manager_Delete (&manager2);
+    ARNETWORKAL_Manager_Delete (&networkALManager1);
+    ARNETWORKAL_Manager_Delete (&networkALManager2);
+
+    return ret;
+}
+
+void LATENCYTEST_InitParamIOBuffer (ARNETWORK_IOBufferParam_t *inputArr, ARNETWORK_IOBufferParam_t *outputArr)
+{
+    /** initialization of the buffer parameters */
+
+    /** input ID_IOBUFFER_LOW_LATENCY ; the data are sent as soon as possible */
+    ARNETWORK_IOBufferParam_DefaultInit (&(inputArr[0]));
+    inputArr[0].ID = ID_IOBUFFER_LOW_LATENCY;
+    inputArr[0].dataType = ARNETWORKAL_FRAME_TYPE_DATA_LOW_LATENCY;
+    inputArr[0].sendingWaitTimeMs = 0;
+    inputArr[0].numberOfCell = LATENCYTEST_NUMBER_OF_CELL;
+    inputArr[0].dataCopyMaxSize = sizeof(struct timespec);
+
+    /** output */
+    ARNETWORK_IOBufferParam_DefaultInit (&(outputArr[0]));
+    outputArr[0].ID = ID_IOBUFFER_LOW_LATENCY;
+    outputArr[0].dataType = ARNETWORKAL_FRAME_TYPE_DATA_LOW_LATENCY;
+    outputArr[0].numberOfCell = LATENCYTEST_NUMBER_OF_CELL;
+    outputArr[0].dataCopyMaxSize = sizeof(struct timespec);
+}
+
+void* LATENCYTEST_DataReadingRun (void *data)
+{
+    /** -- thread run read data -- */
+
+    /** local declarations */
+    LATENCYTEST_Reading_t *readingPtr = (LATENCYTEST_Reading_t *) data;
+    struct timespec sendTime;
+    struct timespec now;
+    int readSize = 0;
+    int latencyUs = 0;
+
+    while ((readingPtr->numberOfDataReceived < readingPtr->numberOfData) &&
+           (ARNETWORK_Manager_ReadDataWithTimeout (readingPtr->managerPtr, ID_IOBUFFER_LOW_LATENCY, (uint8_t*) &sendTime, sizeof(sendTime), &readSize, LATENCYTEST_READING_TIMEOUT_MS) == ARNETWORK_OK))
+    {
+        ARSAL_Time_GetTime (&now);
+        latencyUs = (int) ((now.tv_sec - sendTime.tv_sec) * 1000000 + (now.tv_nsec - sendTime.tv_nsec) / 1000);
+        readingPtr->latencySumUs += latencyUs;
+        if (latencyUs > readingPtr->latencyMaxUs)
+        {
+            readingPtr->latencyMaxUs = latencyUs;
+        }
+        readingPtr->numberOfDataReceived++;
+    }
+
+    return NULL;
+}
+
+eARNETWORK_MANAGER_CALLBACK_RETURN LATENCYTEST_DataCallback (int OutBufferId, uint8_t *dataPtr, void *customData, eARNETWORK_MANAGER_CALLBACK_STATUS status)
+{
+    /** -- callback of the data sent ; the data are copied, nothing to free -- */
+    return ARNETWORK_MANAGER_CALLBACK_RETURN_DEFAULT;
+}
+
+int LATENCYTEST_GetCpuTimeUs (void)
+{
+    /** -- get the CPU time used by the process (all threads) -- */
+
+    /** local declarations */
+    struct rusage usage;
+    int cpuTimeUs = 0;
+
+    if (getrusage (RUSAGE_SELF, &usage) == 0)
+    {
+        cpuTimeUs = (int) ((usage.ru_utime.tv_sec + usage.ru_stime.tv_sec) * 1000000 + usage.ru_utime.tv_usec + usage.ru_stime.tv_usec);
+    }
+
+    return cpuTimeUs;
+}
+
+int LATENCYTEST_Measure (ARNETWORK_Manager_t *senderManagerPtr, ARNETWORK_Manager_t *readerManagerPtr, eARNETWORK_MANAGER_SENDER_WAIT_STRATEGY strategy, int maxSpinTimeUs, int isDirectSend, int numberOfData)
+{
+    /** -- measure the latency of data sent periodically, and the CPU time used -- */
+
+    /** local declarations */
+    LATENCYTEST_Reading_t reading;
+    ARSAL_Thread_t dataReadingThread = NULL;
+    eARNETWORK_ERROR error = ARNETWORK_OK;
+    struct timespec startTime;
+    struct timespec endTime;
+    struct timespec sendTime;
+    int dataIndex = 0;
+    int cpuTimeUs = 0;
+    int durationMs = 0;
+    int ret = -1;
+
+    reading.managerPtr = readerManagerPtr;
+    reading.numberOfData = numberOfData;
+    reading.numberOfDataReceived = 0;
+    reading.latencySumUs = 0;
+    reading.latencyMaxUs = 0;
+
+    error = ARNETWORK_Manager_SetSenderWaitStrategy (senderManagerPtr, strategy, maxSpinTimeUs);
+    if (error == ARNETWORK_OK)
+    {
+        error = ARNETWORK_Manager_SetLowLatencyDirectSend (senderManagerPtr, isDirectSend);
+    }
+
+    if (error == ARNETWORK_OK)
+    {
+        ARSAL_Thread_Create (&dataReadingThread, (ARSAL_Thread_Routine_t) LATENCYTEST_DataReadingRun, &reading);
+
+        ARSAL_Time_GetTime (&startTime);
+        cpuTimeUs = LATENCYTEST_GetCpuTimeUs ();
+
+        /** send a timestamp periodically, the sender is idle between two data */
+        for (dataIndex = 0; dataIndex < numberOfData; dataIndex++)
+        {
+            ARSAL_Time_GetTime (&sendTime);
+            ARNETWORK_Manager_SendData (senderManagerPtr, ID_IOBUFFER_LOW_LATENCY, (uint8_t*) &sendTime, sizeof(sendTime), NULL, &(LATENCYTEST_DataCallback), 1);
+            usleep (LATENCYTEST_SENDING_PERIOD_US);
+        }
+
+        ARSAL_Thread_Join (dataReadingThread, NULL);
+        ARSAL_Thread_Destroy (&dataReadingThread);
+
+        cpuTimeUs = LATENCYTEST_GetCpuTimeUs () - cpuTimeUs;
+        ARSAL_Time_GetTime (&endTime);
+        durationMs = ARSAL_Time_ComputeTimespecMsTimeDiff (&startTime, &endTime);
+
+        if ((reading.numberOfDataReceived > 0) && (durationMs > 0))
+        {
+            ARSAL_PRINT (ARSAL_PRINT_WARNING, LATENCYTEST_TAG, "wait strategy %d, direct send %d : %d/%d data | latency average %lld us, max %d us | CPU %d %%",
+                         strategy, isDirectSend, reading.numberOfDataReceived, numberOfData,
+                         reading.latencySumUs / reading.numberOfDataReceived, reading.latencyMaxUs,
+                         (int) (((long long) cpuTimeUs / 10) / durationMs));
+            ret = 0;
+        }
+    }
+    else
+    {
+        ARSAL_PRINT (ARSAL_PRINT_WARNING, LATENCYTEST_TAG, "wait strategy %d, direct send %d : error %s", strategy, isDirectSend, ARNETWORK_Error_ToString (error));
+    }
+
+    return ret;
+}
@@ -0,0 +1,384 @@
+/*
+    Copyright (C) 2014 Parrot SA
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions
+    are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in
+      the documentation and/or other materials provided with the 
+      distribution.
+    * Neither the name of Parrot nor the names
+      of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written
+      permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+    "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+    LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+    FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+    COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+    INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+    BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+    OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED 
+    AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+    OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+    OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+    SUCH DAMAGE.
+*/
+/**
+ * @file throughputTest.c
+ * @brief libARNetwork TestBench measuring the throughput of a data buffer
+ * @date 19/10/2026
+ */
+
+/*****************************************
+ *
+ *             include file :
+ *
+ *****************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <libARSAL/ARSAL_Print.h>
+#include <libARSAL/ARSAL_Thread.h>
+#include <libARSAL/ARSAL_Time.h>
+
+#include <libARNetworkAL/ARNETWORKAL_Manager.h>
+#include <libARNetworkAL/ARNETWORKAL_Frame.h>
+
+#include <libARNetwork/ARNETWORK_Manager.h>
+#include <libARNetwork/ARNETWORK_IOBufferParam.h>
+
+#include <unistd.h>
+
+/*****************************************
+ *
+ *             define :
+ *
+ *****************************************/
+
+#define THROUGHPUTTEST_TAG "ThroughputTest"
+
+#define THROUGHPUTTEST_PING_DELAY (0) // Use default value
+
+#define THROUGHPUTTEST_NUMBER_DATA_SENT 10000
+#define THROUGHPUTTEST_BURST_SIZE 32
+#define THROUGHPUTTEST_SENDING_WAIT_TIME_US 250
+#define THROUGHPUTTEST_MINIMUM_TIME_BETWEEN_SENDS_US 0
+#define THROUGHPUTTEST_NUMBER_OF_CELL 256
+#define THROUGHPUTTEST_SENDING_SLEEP_TIME_US 100
+#define THROUGHPUTTEST_READING_TIMEOUT_MS 1000
+
+#define THROUGHPUTTEST_RECEIVER_TIMEOUT_SEC 5
+#define THROUGHPUTTEST_PORT1 12345
+#define THROUGHPUTTEST_PORT2 54321
+#define THROUGHPUTTEST_ADRR_IP "127.0.0.1"
+
+#define THROUGHPUTTEST_NUMBER_OF_INPUT 3
+#define THROUGHPUTTEST_NUMBER_OF_OUTPUT 3
+
+/** define of the ioBuffer identifiers */
+typedef enum
+{
+    ID_IOBUFFER_DATA_NO_BURST = 10,
+    ID_IOBUFFER_DATA_BURST,
+    ID_IOBUFFER_DATA_SUB_MILLISECOND,
+
+}eID_IOBUFFER;
+
+typedef struct
+{
+    ARNETWORK_Manager_t *managerPtr;
+    int ID; /**< identifier of the buffer to fill */
+    int numberOfData; /**< number of data to send */
+    int numberOfDataSent; /**< number of data sent */
+
+}THROUGHPUTTEST_Sending_t;
+
+void THROUGHPUTTEST_InitParamIOBuffer (ARNETWORK_IOBufferParam_t *inputArr, ARNETWORK_IOBufferParam_t *outputArr, int burstSize);
+
+void* THROUGHPUTTEST_DataSendingRun (void *data);
+
+eARNETWORK_MANAGER_CALLBACK_RETURN THROUGHPUTTEST_DataCallback (int OutBufferId, uint8_t *dataPtr, void *customData, eARNETWORK_MANAGER_CALLBACK_STATUS status);
+
+int THROUGHPUTTEST_Measure (ARNETWORK_Manager_t *senderManagerPtr, ARNETWORK_Manager_t *readerManagerPtr, int ID, int numberOfData);
+
+/*****************************************
+ *
+ *          implementation :
+ *
+ *****************************************/
+
+int main(int argc, char *argv[])
+{
+    /** local declarations */
+    ARNETWORKAL_Manager_t *networkALManager1 = NULL;
+    ARNETWORKAL_Manager_t *networkALManager2 = NULL;
+    ARNETWORK_Manager_t *manager1 = NULL;
+    ARNETWORK_Manager_t *manager2 = NULL;
+    ARSAL_Thread_t managerSendingThread1 = NULL;
+    ARSAL_Thread_t managerReceiverThread1 = NULL;
+    ARSAL_Thread_t managerSendingThread2 = NULL;
+    ARSAL_Thread_t managerReceiverThread2 = NULL;
+    eARNETWORK_ERROR error = ARNETWORK_OK;
+    eARNETWORKAL_ERROR specificError = ARNETWORKAL_OK;
+    int burstSize = THROUGHPUTTEST_BURST_SIZE;
+    int numberOfData = THROUGHPUTTEST_NUMBER_DATA_SENT;
+    int rateNoBurst = 0;
+    int rateBurst = 0;
+    int rateSubMillisecond = 0;
+    int ret = 0;
+
+    ARNETWORK_IOBufferParam_t paramInput[THROUGHPUTTEST_NUMBER_OF_INPUT];
+    ARNETWORK_IOBufferParam_t paramOutput[THROUGHPUTTEST_NUMBER_OF_OUTPUT];
+
+    if (argc > 1)
+    {
+        burstSize = atoi (argv[1]);
+    }
+    if (argc > 2)
+    {
+        numberOfData = atoi (argv[2]);
+    }
+
+    THROUGHPUTTEST_InitParamIOBuffer (paramInput, paramOutput, burstSize);
+
+    ARSAL_PRINT (ARSAL_PRINT_WARNING, THROUGHPUTTEST_TAG, " -- libARNetwork TestBench throughput --");
+
+    /** create the sending manager */
+    networkALManager1 = ARNETWORKAL_Manager_New(&specificError);
+    if(specificError == ARNETWORKAL_OK)
+    {
+        specificError = ARNETWORKAL_Manager_InitWifiNetwork(networkALManager1, THROUGHPUTTEST_ADRR_IP, THROUGHPUTTEST_PORT1, THROUGHPUTTEST_PORT2, THROUGHPUTTEST_RECEIVER_TIMEOUT_SEC);
+    }
+
+    if(specificError == ARNETWORKAL_OK)
+    {
+        manager1 = ARNETWORK_Manager_New(networkALManager1, THROUGHPUTTEST_NUMBER_OF_INPUT, paramInput, 0, NULL, THROUGHPUTTEST_PING_DELAY, NULL, NULL, &error);
+    }
+    else
+    {
+        ARSAL_PRINT (ARSAL_PRINT_WARNING, THROUGHPUTTEST_TAG, "Manager 1 : Can't init Wifi Network = %d", specificError);
+        error = ARNETWORK_ERROR;
+    }
+
+    /** let the sub millisecond buffer be sent at its rate */
+    if (error == ARNETWORK_OK)
+    {
+        error = ARNETWORK_Manager_SetMinimumTimeBetweenSendsUs (manager1, THROUGHPUTTEST_MINIMUM_TIME_BETWEEN_SENDS_US);
+    }
+
+    /** create the reading manager */
+    if (error == ARNETWORK_OK)
+    {
+        networkALManager2 = ARNETWORKAL_Manager_New(&specificError);
+        if(specificError == ARNETWORKAL_OK)
+        {
+            specificError = ARNETWORKAL_Manager_InitWifiNetwork(networkALManager2, THROUGHPUTTEST_ADRR_IP, THROUGHPUTTEST_PORT2, THROUGHPUTTEST_PORT1, THROUGHPUTTEST_RECEIVER_TIMEOUT_SEC);
+        }
+
+        if(specificError == ARNETWORKAL_OK)
+        {
+            manager2 = ARNETWORK_Manager_New(networkALManager2, 0, NULL, THROUGHPUTTEST_NUMBER_OF_OUTPUT, paramOutput, THROUGHPUTTEST_PING_DELAY, NULL, NULL, &error);
+        }
+        else
+        {
+            ARSAL_PRINT (ARSAL_PRINT_WARNING, THROUGHPUTTEST_TAG, "Manager 2 : Can't init Wifi Network = %d", specificError);
+            error = ARNETWORK_ERROR;
+        }
+    }
+
+    if (error == ARNETWORK_OK)
+    {
+        /** create the threads */
+        ARSAL_Thread_Create (&managerReceiverThread1, (ARSAL_Thread_Routine_t) ARNETWORK_Manager_ReceivingThreadRun, manager1);
+        ARSAL_Thread_Create (&managerReceiverThread2, (ARSAL_Thread_Routine_t) ARNETWORK_Manager_ReceivingThreadRun, manager2);
+        ARSAL_Thread_Create (&managerSendingThread1, (ARSAL_Thread_Routine_t) ARNETWORK_Manager_SendingThreadRun, manager1);
+        ARSAL_Thread_Create (&managerSendingThread2, (ARSAL_Thread_Routine_t) ARNETWORK_Manager_SendingThreadRun, manager2);
+
+        /** measure the same transfer without and with burst */
+        rateNoBurst = THROUGHPUTTEST_Measure (manager1, manager2, ID_IOBUFFER_DATA_NO_BURST, numberOfData);
+        rateBurst = THROUGHPUTTEST_Measure (manager1, manager2, ID_IOBUFFER_DATA_BURST, numberOfData);
+        rateSubMillisecond = THROUGHPUTTEST_Measure (manager1, manager2, ID_IOBUFFER_DATA_SUB_MILLISECOND, numberOfData);
+
+        /** stop all therad */
+        ARNETWORK_Manager_Stop (manager1);
+        ARNETWORK_Manager_Stop (manager2);
+
+        ARNETWORKAL_Manager_Unlock (networkALManager1);
+        ARNETWORKAL_Manager_Unlock (networkALManager2);
+
+        ARSAL_Thread_Join (managerSendingThread1, NULL);
+        ARSAL_Thread_Join (managerSendingThread2, NULL);
+        ARSAL_Thread_Join (managerReceiverThread1, NULL);
+        ARSAL_Thread_Join (managerReceiverThread2, NULL);
+
+        ARSAL_Thread_Destroy (&managerSendingThread1);
+        ARSAL_Thread_Destroy (&managerSendingThread2);
+        ARSAL_Thread_Destroy (&managerReceiverThread1);
+        ARSAL_Thread_Destroy (&managerReceiverThread2);
+
+        ARNETWORKAL_Manager_CloseWifiNetwork (networkALManager1);
+        ARNETWORKAL_Manager_CloseWifiNetwork (networkALManager2);
+    }
+
+    /** print result */
+    ARSAL_PRINT (ARSAL_PRINT_WARNING, THROUGHPUTTEST_TAG, " ");
+    ARSAL_PRINT (ARSAL_PRINT_WARNING, THROUGHPUTTEST_TAG, " sendingBurstSize 1 : %d data/s", rateNoBurst);
+    ARSAL_PRINT (ARSAL_PRINT_WARNING, THROUGHPUTTEST_TAG, " sendingBurstSize %d : %d data/s", burstSize, rateBurst);
+    ARSAL_PRINT (ARSAL_PRINT_WARNING, THROUGHPUTTEST_TAG, " sendingWaitTimeUs %d : %d data/s", THROUGHPUTTEST_SENDING_WAIT_TIME_US, rateSubMillisecond);
+    ARSAL_PRINT (ARSAL_PRINT_WARNING, THROUGHPUTTEST_TAG, " ");
+
+    if ((error == ARNETWORK_OK) && (rateNoBurst > 0) && (rateBurst > 0) && (rateSubMillisecond > 0))
+    {
+        ARSAL_PRINT (ARSAL_PRINT_WARNING, THROUGHPUTTEST_TAG, " # -- Good result of the test bench -- #");
+    }
+    else
+    {
+        ARSAL_PRINT (ARSAL_PRINT_WARNING, THROUGHPUTTEST_TAG, " # -- Bad result of the test bench -- #");
+        ARSAL_PRINT (ARSAL_PRINT_WARNING, THROUGHPUTTEST_TAG, "    libARNetwork error : %s", ARNETWORK_Error_ToString (error));
+        ret = -1;
+    }
+
+    /** delete */
+    ARNETWORK_Manager_Delete (&manager1);
+    ARNETWORK_Manager_Delete (&manager2);
+    ARNETWORKAL_Manager_Delete (&networkALManager1);
+    ARNETWORKAL_Manager_Delete (&networkALManager2);
+
+    return ret;
+}
+
+void THROUGHPUTTEST_InitParamIOBuffer (ARNETWORK_IOBufferParam_t *inputArr, ARNETWORK_IOBufferParam_t *outputArr, int burstSize)
+{
+    /** initialization of the buffer parameters */
+
+    /** input ID_IOBUFFER_DATA_NO_BURST */
+    ARNETWORK_IOBufferParam_DefaultInit (&(inputArr[0]));
+    inputArr[0].ID = ID_IOBUFFER_DATA_NO_BURST;
+    inputArr[0].dataType = ARNETWORKAL_FRAME_TYPE_DATA;
+    inputArr[0].numberOfCell = THROUGHPUTTEST_NUMBER_OF_CELL;
+    inputArr[0].dataCopyMaxSize = sizeof(int);
+
+    /** input ID_IOBUFFER_DATA_BURST */
+    ARNETWORK_IOBufferParam_DefaultInit (&(inputArr[1]));
+    inputArr[1].ID = ID_IOBUFFER_DATA_BURST;
+    inputArr[1].dataType = ARNETWORKAL_FRAME_TYPE_DATA;
+    inputArr[1].numberOfCell = THROUGHPUTTEST_NUMBER_OF_CELL;
+    inputArr[1].dataCopyMaxSize = sizeof(int);
+    inputArr[1].sendingBurstSize = burstSize;
+
+    /** input ID_IOBUFFER_DATA_SUB_MILLISECOND */
+    ARNETWORK_IOBufferParam_DefaultInit (&(inputArr[2]));
+    inputArr[2].ID = ID_IOBUFFER_DATA_SUB_MILLISECOND;
+    inputArr[2].dataType = ARNETWORKAL_FRAME_TYPE_DATA;
+    inputArr[2].numberOfCell = THROUGHPUTTEST_NUMBER_OF_CELL;
+    inputArr[2].dataCopyMaxSize = sizeof(int);
+    inputArr[2].sendingWaitTimeUs = THROUGHPUTTEST_SENDING_WAIT_TIME_US;
+
+    /** outputs */
+    ARNETWORK_IOBufferParam_DefaultInit (&(outputArr[0]));
+    outputArr[0].ID = ID_IOBUFFER_DATA_NO_BURST;
+    outputArr[0].dataType = ARNETWORKAL_FRAME_TYPE_DATA;
+    outputArr[0].numberOfCell = THROUGHPUTTEST_NUMBER_OF_CELL;
+    outputArr[0].dataCopyMaxSize = sizeof(int);
+
+    ARNETWORK_IOBufferParam_DefaultInit (&(outputArr[1]));
+    outputArr[1].ID = ID_IOBUFFER_DATA_BURST;
+    outputArr[1].dataType = ARNETWORKAL_FRAME_TYPE_DATA;
+    outputArr[1].numberOfCell = THROUGHPUTTEST_NUMBER_OF_CELL;
+    outputArr[1].dataCopyMaxSize = sizeof(int);
+
+    ARNETWORK_IOBufferParam_DefaultInit (&(outputArr[2]));
+    outputArr[2].ID = ID_IOBUFFER_DATA_SUB_MILLISECOND;
+    outputArr[2].dataType = ARNETWORKAL_FRAME_TYPE_DATA;
+    outputArr[2].numberOfCell = THROUGHPUTTEST_NUMBER_OF_CELL;
+    outputArr[2].dataCopyMaxSize = sizeof(int);
+}
+
+void* THROUGHPUTTEST_DataSendingRun (void *data)
+{
+    /** -- thread run send data -- */
+
+    /** local declarations */
+    THROUGHPUTTEST_Sending_t *sendingPtr = (THROUGHPUTTEST_Sending_t *) data;
+    eARNETWORK_ERROR error = ARNETWORK_OK;
+
+    while (sendingPtr->numberOfDataSent < sendingPtr->numberOfData)
+    {
+        error = ARNETWORK_Manager_SendData (sendingPtr->managerPtr, sendingPtr->ID, (uint8_t*) &(sendingPtr->numberOfDataSent), sizeof(int), NULL, &(THROUGHPUTTEST_DataCallback), 1);
+        if (error == ARNETWORK_OK)
+        {
+            sendingPtr->numberOfDataSent++;
+        }
+        else
+        {
+            /** the input buffer is full, wait the sender */
+            usleep (THROUGHPUTTEST_SENDING_SLEEP_TIME_US);
+        }
+    }
+
+    return NULL;
+}
+
+eARNETWORK_MANAGER_CALLBACK_RETURN THROUGHPUTTEST_DataCallback (int OutBufferId, uint8_t *dataPtr, void *customData, eARNETWORK_MANAGER_CALLBACK_STATUS status)
+{
+    /** -- callback of the data sent ; the data are copied, nothing to free -- */
+    return ARNETWORK_MANAGER_CALLBACK_RETURN_DEFAULT;
+}
+
+int THROUGHPUTTEST_Measure (ARNETWORK_Manager_t *senderManagerPtr, ARNETWORK_Manager_t *readerManagerPtr, int ID, int numberOfData)
+{
+    /** -- measure the number of data received per second on a buffer -- */
+
+    /** local declarations */
+    THROUGHPUTTEST_Sending_t sending;
+    ARSAL_Thread_t dataSendingThread = NULL;
+    struct timespec startTime;
+    struct timespec endTime;
+    int numberOfDataReceived = 0;
+    int numberOfOutOfOrder = 0;
+    int lastData = -1;
+    int readData = 0;
+    int readSize = 0;
+    int durationMs = 0;
+    int rate = 0;
+
+    sending.managerPtr = senderManagerPtr;
+    sending.ID = ID;
+    sending.numberOfData = numberOfData;
+    sending.numberOfDataSent = 0;
+
+    ARSAL_Time_GetTime (&startTime);
+    ARSAL_Thread_Create (&dataSendingThread, (ARSAL_Thread_Routine_t) THROUGHPUTTEST_DataSendingRun, &sending);
+
+    /** read until the last data or until the reading timeout (data not acknowledged can be lost) */
+    while ((lastData < numberOfData - 1) &&
+           (ARNETWORK_Manager_ReadDataWithTimeout (readerManagerPtr, ID, (uint8_t*) &readData, sizeof(int), &readSize, THROUGHPUTTEST_READING_TIMEOUT_MS) == ARNETWORK_OK))
+    {
+        if (readData <= lastData)
+        {
+            numberOfOutOfOrder++;
+        }
+        lastData = readData;
+        numberOfDataReceived++;
+    }
+
+    ARSAL_Time_GetTime (&endTime);
+    ARSAL_Thread_Join (dataSendingThread, NULL);
+    ARSAL_Thread_Destroy (&dataSendingThread);
+
+    durationMs = ARSAL_Time_ComputeTimespecMsTimeDiff (&startTime, &endTime);
+    if ((durationMs > 0) && (numberOfOutOfOrder == 0))
+    {
+        rate = (int) (((long long) numberOfDataReceived * 1000) / durationMs);
+    }
+
+    ARSAL_PRINT (ARSAL_PRINT_WARNING, THROUGHPUTTEST_TAG, "buffer %d : %d data sent | %d data received | %d out of order | %d ms", ID, sending.numberOfDataSent, numberOfDataReceived, numberOfOutOfOrder, durationMs);
+
+    return rate;
+}
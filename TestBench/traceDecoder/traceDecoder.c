@@ -0,0 +1,255 @@
+/*
+    Copyright (C) 2014 Parrot SA
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions
+    are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in
+      the documentation and/or other materials provided with the 
+      distribution.
+    * Neither the name of Parrot nor the names
+      of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written
+      permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+    "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+    LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+    FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+    COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+    INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+    BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+    OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED 
+    AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+    OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+    OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+    SUCH DAMAGE.
+*/
+/**
+ * @file traceDecoder.c
+ * @brief offline decoder of the binary traces written by ARNETWORK_Manager_DumpTrace()
+ * @date 19/10/2026
+ */
+
+/*****************************************
+ *
+ *             include file :
+ *
+ *****************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <libARNetwork/ARNETWORK_Trace.h>
+
+/*****************************************
+ *
+ *             define :
+ *
+ *****************************************/
+
+/**
+ * @brief entry of a dump, with its age at the time of the dump used to merge the rings
+ */
+typedef struct
+{
+    ARNETWORK_TraceEntry_t entry; /**< entry read */
+    uint32_t ageUs; /**< time between the entry and the dump */
+    uint32_t index; /**< index of the entry in the dump, to keep the order of the entries of same age */
+
+}TRACEDECODER_Entry_t;
+
+static const char *TRACEDECODER_RoleNames[ARNETWORK_TRACE_ROLE_MAX] = { "APP", "SND", "RCV" };
+static const char *TRACEDECODER_EventNames[ARNETWORK_TRACE_EVENT_MAX] = { "ENQUEUE", "SEND", "RETRY", "ACK", "RECEIVE", "PUSH", "DROP" };
+static const char *TRACEDECODER_DropReasonNames[ARNETWORK_TRACE_DROP_REASON_MAX] = { "input full", "output full", "old frame", "ack timeout" };
+
+int TRACEDECODER_CompareEntries (const void *first, const void *second);
+
+int TRACEDECODER_DecodeDump (FILE *file, int dumpIndex);
+
+void TRACEDECODER_PrintEntry (const ARNETWORK_TraceEntry_t *entry, uint32_t timeUs);
+
+/*****************************************
+ *
+ *          implementation :
+ *
+ *****************************************/
+
+int main (int argc, char *argv[])
+{
+    /** local declarations */
+    FILE *file = NULL;
+    int dumpIndex = 0;
+    int result = 0;
+
+    if (argc < 2)
+    {
+        fprintf (stderr, "usage: %s <trace dump file>\n", argv[0]);
+        return 1;
+    }
+
+    file = fopen (argv[1], "rb");
+    if (file == NULL)
+    {
+        fprintf (stderr, "can't open %s\n", argv[1]);
+        return 1;
+    }
+
+    /** a file can contain many dumps, one after the other */
+    while ((result == 0) && (!feof (file)))
+    {
+        result = TRACEDECODER_DecodeDump (file, dumpIndex);
+        dumpIndex++;
+    }
+
+    fclose (file);
+
+    /** the end of the file is reached at the start of a dump */
+    return (result > 0) ? 0 : 1;
+}
+
+int TRACEDECODER_CompareEntries (const void *first, const void *second)
+{
+    const TRACEDECODER_Entry_t *firstEntry = first;
+    const TRACEDECODER_Entry_t *secondEntry = second;
+
+    /** the oldest entries first */
+    if (firstEntry->ageUs != secondEntry->ageUs)
+    {
+        return (firstEntry->ageUs > secondEntry->ageUs) ? -1 : 1;
+    }
+    return (firstEntry->index < secondEntry->index) ? -1 : 1;
+}
+
+int TRACEDECODER_DecodeDump (FILE *file, int dumpIndex)
+{
+    /** -- decode a dump ; return 0 if decoded, 1 at the end of the file, -1 on error -- */
+
+    /** local declarations */
+    ARNETWORK_TraceFileHeader_t fileHeader;
+    ARNETWORK_TraceRingHeader_t ringHeader;
+    TRACEDECODER_Entry_t *entryArr = NULL;
+    TRACEDECODER_Entry_t *newEntryArr = NULL;
+    uint32_t numberOfEntries = 0;
+    uint32_t ringIndex = 0;
+    uint32_t entryIndex = 0;
+    uint32_t firstTimeUs = 0;
+    int result = 0;
+
+    if (fread (&fileHeader, sizeof (fileHeader), 1, file) != 1)
+    {
+        return 1;
+    }
+
+    if ((fileHeader.magic != ARNETWORK_TRACE_FILE_MAGIC) || (fileHeader.version != ARNETWORK_TRACE_FILE_VERSION) || (fileHeader.entrySize != sizeof (ARNETWORK_TraceEntry_t)))
+    {
+        fprintf (stderr, "dump %d: bad header (magic 0x%08X, version %u, entry size %u)\n", dumpIndex, fileHeader.magic, fileHeader.version, fileHeader.entrySize);
+        return -1;
+    }
+
+    printf ("-- dump %d --\n", dumpIndex);
+
+    /** read the rings */
+    for (ringIndex = 0; (ringIndex < fileHeader.numberOfRings) && (result == 0); ringIndex++)
+    {
+        if (fread (&ringHeader, sizeof (ringHeader), 1, file) != 1)
+        {
+            result = -1;
+        }
+        else
+        {
+            if (ringHeader.numberOfLostEntries > 0)
+            {
+                printf ("ring %s: %u entries lost\n", (ringHeader.role < ARNETWORK_TRACE_ROLE_MAX) ? TRACEDECODER_RoleNames[ringHeader.role] : "?", ringHeader.numberOfLostEntries);
+            }
+
+            newEntryArr = realloc (entryArr, (numberOfEntries + ringHeader.numberOfEntries) * sizeof (TRACEDECODER_Entry_t));
+            if ((newEntryArr == NULL) && (numberOfEntries + ringHeader.numberOfEntries > 0))
+            {
+                result = -1;
+            }
+            else
+            {
+                entryArr = newEntryArr;
+            }
+
+            for (entryIndex = 0; (entryIndex < ringHeader.numberOfEntries) && (result == 0); entryIndex++)
+            {
+                if (fread (&(entryArr[numberOfEntries].entry), sizeof (ARNETWORK_TraceEntry_t), 1, file) == 1)
+                {
+                    entryArr[numberOfEntries].ageUs = fileHeader.dumpTimeUs - entryArr[numberOfEntries].entry.timeUs;
+                    entryArr[numberOfEntries].index = numberOfEntries;
+                    numberOfEntries++;
+                }
+                else
+                {
+                    result = -1;
+                }
+            }
+        }
+    }
+
+    if (result != 0)
+    {
+        fprintf (stderr, "dump %d: truncated\n", dumpIndex);
+    }
+    else
+    {
+        /** merge the rings by time ; the times are modulo 2^32 us, so the dump must cover less than 71 minutes */
+        qsort (entryArr, numberOfEntries, sizeof (TRACEDECODER_Entry_t), TRACEDECODER_CompareEntries);
+
+        if (numberOfEntries > 0)
+        {
+            firstTimeUs = entryArr[0].entry.timeUs;
+        }
+        for (entryIndex = 0; entryIndex < numberOfEntries; entryIndex++)
+        {
+            TRACEDECODER_PrintEntry (&(entryArr[entryIndex].entry), entryArr[entryIndex].entry.timeUs - firstTimeUs);
+        }
+    }
+
+    free (entryArr);
+
+    return result;
+}
+
+void TRACEDECODER_PrintEntry (const ARNETWORK_TraceEntry_t *entry, uint32_t timeUs)
+{
+    /** -- print an entry -- */
+
+    printf ("%10u.%06u %s %-7s id:%3u seq:%3u size:%5d",
+            timeUs / 1000000, timeUs % 1000000,
+            (entry->role < ARNETWORK_TRACE_ROLE_MAX) ? TRACEDECODER_RoleNames[entry->role] : "?",
+            (entry->event < ARNETWORK_TRACE_EVENT_MAX) ? TRACEDECODER_EventNames[entry->event] : "?",
+            entry->bufferID, entry->seq, entry->size);
+
+    switch (entry->event)
+    {
+    case ARNETWORK_TRACE_EVENT_SEND:
+        printf (" data:%d\n", entry->info);
+        break;
+
+    case ARNETWORK_TRACE_EVENT_RETRY:
+        printf (" retries left:%d\n", entry->info);
+        break;
+
+    case ARNETWORK_TRACE_EVENT_ACK:
+        printf (" error:%d\n", entry->info);
+        break;
+
+    case ARNETWORK_TRACE_EVENT_RECEIVE:
+        printf (" type:%d\n", entry->info);
+        break;
+
+    case ARNETWORK_TRACE_EVENT_DROP:
+        printf (" reason:%s\n", ((entry->info >= 0) && (entry->info < ARNETWORK_TRACE_DROP_REASON_MAX)) ? TRACEDECODER_DropReasonNames[entry->info] : "?");
+        break;
+
+    default:
+        printf ("\n");
+        break;
+    }
+}